@@ -31,8 +31,7 @@ public class AzSpeech : ModuleRules
 			"DeveloperSettings",
 			"AudioCaptureCore",
 			"AssetRegistry",
-			"Projects",
-			"Json"
+			"Projects"
 		});
 
 		if (Target.bBuildEditor) PrivateDependencyModuleNames.Add("UnrealEd");
@@ -0,0 +1,127 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/AzSpeechAudioBuffer.h"
+#include <atomic>
+
+namespace AzSpeechAudioBufferStats
+{
+	std::atomic<int64> NumSharedBuffers = 0;
+	std::atomic<int64> SharedBytes = 0;
+	std::atomic<int64> NumCopies = 0;
+	std::atomic<int64> CopiedBytes = 0;
+}
+
+FAzSpeechAudioBuffer::FAzSpeechAudioBuffer(const std::shared_ptr<std::vector<uint8_t>>& InData)
+	: FAzSpeechAudioBuffer(InData, InData ? InData->data() : nullptr, InData ? static_cast<int32>(InData->size()) : 0)
+{
+}
+
+FAzSpeechAudioBuffer::FAzSpeechAudioBuffer(const std::shared_ptr<const void>& InOwner, const uint8* InData, const int32 InNum)
+{
+	if (!InOwner || !InData || InNum <= 0)
+	{
+		return;
+	}
+
+	Data = std::shared_ptr<const uint8>(InOwner, InData);
+	DataNum = InNum;
+
+	++AzSpeechAudioBufferStats::NumSharedBuffers;
+	AzSpeechAudioBufferStats::SharedBytes += DataNum;
+}
+
+FAzSpeechAudioBuffer FAzSpeechAudioBuffer::FromArray(TArray<uint8>&& InData)
+{
+	// The allocation of the array is moved to the shared owner: The data pointer stays the same
+	const auto NewData = std::make_shared<TArray<uint8>>(MoveTemp(InData));
+	return FAzSpeechAudioBuffer(NewData, NewData->GetData(), NewData->Num());
+}
+
+FAzSpeechAudioBuffer FAzSpeechAudioBuffer::Concatenate(const TArray<FAzSpeechAudioBuffer>& Chunks)
+{
+	if (Chunks.Num() <= 1)
+	{
+		return Chunks.Num() == 1 ? Chunks[0] : FAzSpeechAudioBuffer();
+	}
+
+	int64 TotalSize = 0;
+	for (const FAzSpeechAudioBuffer& Chunk : Chunks)
+	{
+		TotalSize += Chunk.Num();
+	}
+
+	const auto NewData = std::make_shared<std::vector<uint8_t>>();
+	NewData->reserve(TotalSize);
+
+	for (const FAzSpeechAudioBuffer& Chunk : Chunks)
+	{
+		NewData->insert(NewData->end(), Chunk.GetData(), Chunk.GetData() + Chunk.Num());
+	}
+
+	RegisterCopy(TotalSize);
+
+	FAzSpeechAudioBuffer Output;
+	Output.Data = std::shared_ptr<const uint8>(NewData, NewData->data());
+	Output.DataNum = static_cast<int32>(NewData->size());
+
+	return Output;
+}
+
+const uint8* FAzSpeechAudioBuffer::GetData() const
+{
+	return Data.get();
+}
+
+const int32 FAzSpeechAudioBuffer::Num() const
+{
+	return DataNum;
+}
+
+const bool FAzSpeechAudioBuffer::IsEmpty() const
+{
+	return Num() == 0;
+}
+
+TArrayView<const uint8> FAzSpeechAudioBuffer::GetView() const
+{
+	return TArrayView<const uint8>(GetData(), Num());
+}
+
+TArray<uint8> FAzSpeechAudioBuffer::ToArray() const
+{
+	if (IsEmpty())
+	{
+		return TArray<uint8>();
+	}
+
+	RegisterCopy(Num());
+
+	return TArray<uint8>(GetData(), Num());
+}
+
+const FAzSpeechAudioBufferStats FAzSpeechAudioBuffer::GetStats()
+{
+	FAzSpeechAudioBufferStats Output;
+	Output.NumSharedBuffers = AzSpeechAudioBufferStats::NumSharedBuffers;
+	Output.SharedBytes = AzSpeechAudioBufferStats::SharedBytes;
+	Output.NumCopies = AzSpeechAudioBufferStats::NumCopies;
+	Output.CopiedBytes = AzSpeechAudioBufferStats::CopiedBytes;
+
+	return Output;
+}
+
+void FAzSpeechAudioBuffer::ResetStats()
+{
+	AzSpeechAudioBufferStats::NumSharedBuffers = 0;
+	AzSpeechAudioBufferStats::SharedBytes = 0;
+	AzSpeechAudioBufferStats::NumCopies = 0;
+	AzSpeechAudioBufferStats::CopiedBytes = 0;
+}
+
+void FAzSpeechAudioBuffer::RegisterCopy(const int64 NumBytes)
+{
+	++AzSpeechAudioBufferStats::NumCopies;
+	AzSpeechAudioBufferStats::CopiedBytes += NumBytes;
+}
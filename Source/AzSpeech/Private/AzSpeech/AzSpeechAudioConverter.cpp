@@ -0,0 +1,292 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/AzSpeechAudioConverter.h"
+#include "LogAzSpeech.h"
+
+DECLARE_CYCLE_STAT(TEXT("Convert Audio"), STAT_AzSpeech_ConvertAudio, STATGROUP_AzSpeech);
+
+namespace AzSpeechAudioConverter
+{
+	int32 GreatestCommonDivisor(int32 A, int32 B)
+	{
+		while (B != 0)
+		{
+			const int32 Remainder = A % B;
+			A = B;
+			B = Remainder;
+		}
+
+		return A;
+	}
+
+	float Sinc(const double Value)
+	{
+		return FMath::IsNearlyZero(Value) ? 1.f : static_cast<float>(FMath::Sin(PI * Value) / (PI * Value));
+	}
+
+	float BlackmanWindow(const int32 Index, const int32 Length)
+	{
+		const double Position = 2.0 * PI * Index / (Length - 1);
+		return static_cast<float>(0.42 - 0.5 * FMath::Cos(Position) + 0.08 * FMath::Cos(2.0 * Position));
+	}
+
+	float DotProduct(const float* const Samples, const float* const Coefficients)
+	{
+		VectorRegister Sum = VectorZero();
+		for (int32 Tap = 0; Tap < FAzSpeechAudioConverter::TapsPerPhase; Tap += 4)
+		{
+			Sum = VectorMultiplyAdd(VectorLoad(Samples + Tap), VectorLoad(Coefficients + Tap), Sum);
+		}
+
+		alignas(16) float Lanes[4];
+		VectorStoreAligned(Sum, Lanes);
+
+		return Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+	}
+}
+
+FAzSpeechAudioConverter::FAzSpeechAudioConverter(const int32 InInputSampleRate, const int32 InNumInputChannels, const int32 InOutputSampleRate,
+                                                 const int32 InMaxInputFrames)
+	: InputSampleRate(FMath::Max(InInputSampleRate, 1)), NumInputChannels(FMath::Max(InNumInputChannels, 1)),
+	  OutputSampleRate(FMath::Max(InOutputSampleRate, 1)), MaxInputFrames(FMath::Max(InMaxInputFrames, 1))
+{
+	bPassThrough = InputSampleRate == OutputSampleRate;
+
+	const int32 Divisor = AzSpeechAudioConverter::GreatestCommonDivisor(InputSampleRate, OutputSampleRate);
+	if (OutputSampleRate / Divisor <= MaxPhases)
+	{
+		NumPhases = OutputSampleRate / Divisor;
+		Step = InputSampleRate / Divisor;
+	}
+	else
+	{
+		NumPhases = MaxPhases;
+		Step = FMath::Max(1, FMath::RoundToInt(static_cast<double>(InputSampleRate) * MaxPhases / OutputSampleRate));
+
+		UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Resampling from %d Hz to %d Hz with %d phases: The output rate will be approximated"),
+		       *FString(__FUNCTION__), InputSampleRate, OutputSampleRate, MaxPhases);
+	}
+
+	if (!bPassThrough)
+	{
+		BuildFilter();
+	}
+
+	// Enough for the history of the previous block and a full block of input
+	Window.SetNumZeroed(MaxInputFrames + TapsPerPhase + FMath::DivideAndRoundUp(Step, NumPhases) + 1);
+
+	Reset();
+}
+
+const int32 FAzSpeechAudioConverter::GetMaxOutputFrames(const int32 NumInputFrames) const
+{
+	if (bPassThrough)
+	{
+		return NumInputFrames;
+	}
+
+	// Each block can write one sample more than its share of the input
+	const int32 NumBlocks = FMath::DivideAndRoundUp(FMath::Max(NumInputFrames, 1), MaxInputFrames);
+	return static_cast<int32>((static_cast<int64>(NumInputFrames) + NumBlocks) * NumPhases / Step) + 2 * NumBlocks;
+}
+
+const int32 FAzSpeechAudioConverter::Process(const float* const InAudio, const int32 NumInputFrames, const TArrayView<float> OutAudio)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_ConvertAudio);
+
+	if (!InAudio || NumInputFrames <= 0)
+	{
+		return 0;
+	}
+
+	int32 NumWritten = 0;
+
+	// Long inputs are split in blocks that fit the window and the remaining output
+	for (int32 Frame = 0; Frame < NumInputFrames;)
+	{
+		int32 NumBlockFrames = FMath::Min(NumInputFrames - Frame, MaxInputFrames);
+		while (NumBlockFrames > 0 && GetMaxOutputFrames(NumBlockFrames) > OutAudio.Num() - NumWritten)
+		{
+			NumBlockFrames /= 2;
+		}
+
+		if (NumBlockFrames <= 0)
+		{
+			UE_LOG(LogAzSpeech_Internal, Warning, TEXT("%s: Output buffer too small: %d input frames dropped"), *FString(__FUNCTION__),
+			       NumInputFrames - Frame);
+			break;
+		}
+
+		NumWritten += Process_Internal(InAudio + static_cast<int64>(Frame) * NumInputChannels, NumBlockFrames, OutAudio.GetData() + NumWritten,
+		                               OutAudio.Num() - NumWritten);
+		Frame += NumBlockFrames;
+	}
+
+	return NumWritten;
+}
+
+void FAzSpeechAudioConverter::Reset()
+{
+	// Starts with a silent history: The filter delay is filled with zeros instead of waiting for the first samples
+	NumWindowSamples = bPassThrough ? 0 : TapsPerPhase - 1;
+	FMemory::Memzero(Window.GetData(), Window.Num() * sizeof(float));
+
+	WindowStart = 0;
+	Phase = 0;
+}
+
+const int32 FAzSpeechAudioConverter::GetInputSampleRate() const
+{
+	return InputSampleRate;
+}
+
+const int32 FAzSpeechAudioConverter::GetNumInputChannels() const
+{
+	return NumInputChannels;
+}
+
+const int32 FAzSpeechAudioConverter::GetOutputSampleRate() const
+{
+	return OutputSampleRate;
+}
+
+void FAzSpeechAudioConverter::Downmix(const float* const InAudio, const int32 NumFrames, const int32 NumChannels, float* const OutAudio)
+{
+	if (NumChannels <= 1)
+	{
+		FMemory::Memcpy(OutAudio, InAudio, NumFrames * sizeof(float));
+		return;
+	}
+
+	int32 Frame = 0;
+
+	if (NumChannels == 2)
+	{
+		const VectorRegister Half = VectorSetFloat1(0.5f);
+
+		// Two vectors with 4 stereo frames: Left and right channels are separated by the shuffles
+		for (; Frame + 4 <= NumFrames; Frame += 4)
+		{
+			const VectorRegister First = VectorLoad(InAudio + Frame * 2);
+			const VectorRegister Second = VectorLoad(InAudio + Frame * 2 + 4);
+
+			const VectorRegister Left = VectorShuffle(First, Second, 0, 2, 0, 2);
+			const VectorRegister Right = VectorShuffle(First, Second, 1, 3, 1, 3);
+
+			VectorStore(VectorMultiply(VectorAdd(Left, Right), Half), OutAudio + Frame);
+		}
+	}
+
+	const float ChannelGain = 1.f / static_cast<float>(NumChannels);
+	for (; Frame < NumFrames; ++Frame)
+	{
+		float Sum = 0.f;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			Sum += InAudio[Frame * NumChannels + Channel];
+		}
+
+		OutAudio[Frame] = Sum * ChannelGain;
+	}
+}
+
+void FAzSpeechAudioConverter::FloatToInt16(const float* const InAudio, const int32 NumSamples, int16* const OutAudio)
+{
+	const VectorRegister Min = VectorSetFloat1(-1.f);
+	const VectorRegister Max = VectorSetFloat1(1.f);
+	const VectorRegister Scale = VectorSetFloat1(32767.f);
+
+	int32 Index = 0;
+	for (; Index + 4 <= NumSamples; Index += 4)
+	{
+		const VectorRegister Scaled = VectorMultiply(VectorMin(VectorMax(VectorLoad(InAudio + Index), Min), Max), Scale);
+
+		alignas(16) int32 Lanes[4];
+		VectorIntStore(VectorFloatToInt(Scaled), Lanes);
+
+		OutAudio[Index] = static_cast<int16>(Lanes[0]);
+		OutAudio[Index + 1] = static_cast<int16>(Lanes[1]);
+		OutAudio[Index + 2] = static_cast<int16>(Lanes[2]);
+		OutAudio[Index + 3] = static_cast<int16>(Lanes[3]);
+	}
+
+	for (; Index < NumSamples; ++Index)
+	{
+		OutAudio[Index] = static_cast<int16>(FMath::Clamp(InAudio[Index], -1.f, 1.f) * 32767.f);
+	}
+}
+
+void FAzSpeechAudioConverter::BuildFilter()
+{
+	// Windowed sinc low pass at the upsampled rate: Cuts below the Nyquist frequency of the lowest rate
+	const int32 Length = NumPhases * TapsPerPhase;
+	const double Cutoff = 0.5 * FMath::Min(1.0, static_cast<double>(OutputSampleRate) / InputSampleRate) / NumPhases * 0.9;
+	const double Center = (Length - 1) * 0.5;
+
+	TArray<float> Prototype;
+	Prototype.SetNumUninitialized(Length);
+
+	for (int32 Index = 0; Index < Length; ++Index)
+	{
+		Prototype[Index] = static_cast<float>(2.0 * Cutoff) * AzSpeechAudioConverter::Sinc(2.0 * Cutoff * (Index - Center)) *
+			AzSpeechAudioConverter::BlackmanWindow(Index, Length);
+	}
+
+	Coefficients.SetNumUninitialized(Length);
+
+	for (int32 PhaseIndex = 0; PhaseIndex < NumPhases; ++PhaseIndex)
+	{
+		float* const PhaseCoefficients = Coefficients.GetData() + PhaseIndex * TapsPerPhase;
+
+		float Sum = 0.f;
+		for (int32 Tap = 0; Tap < TapsPerPhase; ++Tap)
+		{
+			PhaseCoefficients[Tap] = Prototype[PhaseIndex + (TapsPerPhase - 1 - Tap) * NumPhases];
+			Sum += PhaseCoefficients[Tap];
+		}
+
+		// Unity gain on every phase: Avoids a ripple at the phase rate on constant signals
+		const float Gain = FMath::Abs(Sum) > KINDA_SMALL_NUMBER ? 1.f / Sum : 0.f;
+		for (int32 Tap = 0; Tap < TapsPerPhase; ++Tap)
+		{
+			PhaseCoefficients[Tap] *= Gain;
+		}
+	}
+}
+
+const int32 FAzSpeechAudioConverter::Process_Internal(const float* const InAudio, const int32 NumInputFrames, float* const OutAudio, const int32 MaxOutput)
+{
+	if (bPassThrough)
+	{
+		const int32 NumFrames = FMath::Min(NumInputFrames, MaxOutput);
+		Downmix(InAudio, NumFrames, NumInputChannels, OutAudio);
+
+		return NumFrames;
+	}
+
+	check(NumWindowSamples + NumInputFrames <= Window.Num());
+
+	Downmix(InAudio, NumInputFrames, NumInputChannels, Window.GetData() + NumWindowSamples);
+	NumWindowSamples += NumInputFrames;
+
+	int32 NumWritten = 0;
+	while (WindowStart + TapsPerPhase <= NumWindowSamples && NumWritten < MaxOutput)
+	{
+		OutAudio[NumWritten++] = AzSpeechAudioConverter::DotProduct(Window.GetData() + WindowStart, Coefficients.GetData() + Phase * TapsPerPhase);
+
+		Phase += Step;
+		WindowStart += Phase / NumPhases;
+		Phase %= NumPhases;
+	}
+
+	// Keeps only the samples needed by the next windows
+	const int32 NumConsumed = FMath::Min(WindowStart, NumWindowSamples);
+	NumWindowSamples -= NumConsumed;
+	WindowStart -= NumConsumed;
+
+	FMemory::Memmove(Window.GetData(), Window.GetData() + NumConsumed, NumWindowSamples * sizeof(float));
+
+	return NumWritten;
+}
@@ -0,0 +1,293 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/AzSpeechAudioInputDeviceRegistry.h"
+#include "LogAzSpeech.h"
+#include <AudioCaptureCore.h>
+#include <Async/Async.h>
+#include <Misc/CoreDelegates.h>
+
+#if PLATFORM_WINDOWS
+#include <Windows/AllowWindowsPlatformTypes.h>
+#include <mmdeviceapi.h>
+#include <Windows/HideWindowsPlatformTypes.h>
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("Enumerate Audio Input Devices"), STAT_AzSpeech_EnumerateAudioInputDevices, STATGROUP_AzSpeech);
+
+#if PLATFORM_WINDOWS
+/**
+ * Receives the endpoint notifications of the Windows audio devices: Called from a system thread
+ */
+class FAzSpeechDeviceNotificationClient final : public IMMNotificationClient
+{
+public:
+	explicit FAzSpeechDeviceNotificationClient(const TWeakPtr<FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe>& InRegistry) : Registry(InRegistry)
+	{
+	}
+
+	const bool Register()
+	{
+		if (FAILED(CoCreateInstance(__uuidof(MMDeviceEnumerator), nullptr, CLSCTX_ALL, __uuidof(IMMDeviceEnumerator), reinterpret_cast<void**>(&
+			DeviceEnumerator))))
+		{
+			DeviceEnumerator = nullptr;
+			return false;
+		}
+
+		return SUCCEEDED(DeviceEnumerator->RegisterEndpointNotificationCallback(this));
+	}
+
+	void Unregister()
+	{
+		if (DeviceEnumerator)
+		{
+			DeviceEnumerator->UnregisterEndpointNotificationCallback(this);
+			DeviceEnumerator->Release();
+			DeviceEnumerator = nullptr;
+		}
+	}
+
+	// IMMNotificationClient interface
+	virtual HRESULT STDMETHODCALLTYPE OnDeviceStateChanged([[maybe_unused]] LPCWSTR DeviceId, [[maybe_unused]] DWORD NewState) override
+	{
+		return RequestRefresh();
+	}
+
+	virtual HRESULT STDMETHODCALLTYPE OnDeviceAdded([[maybe_unused]] LPCWSTR DeviceId) override
+	{
+		return RequestRefresh();
+	}
+
+	virtual HRESULT STDMETHODCALLTYPE OnDeviceRemoved([[maybe_unused]] LPCWSTR DeviceId) override
+	{
+		return RequestRefresh();
+	}
+
+	virtual HRESULT STDMETHODCALLTYPE OnDefaultDeviceChanged(const EDataFlow Flow, [[maybe_unused]] ERole Role,
+	                                                         [[maybe_unused]] LPCWSTR DefaultDeviceId) override
+	{
+		return Flow == eCapture || Flow == eAll ? RequestRefresh() : S_OK;
+	}
+
+	virtual HRESULT STDMETHODCALLTYPE OnPropertyValueChanged([[maybe_unused]] LPCWSTR DeviceId, [[maybe_unused]] const PROPERTYKEY Key) override
+	{
+		return S_OK;
+	}
+	// End of IMMNotificationClient interface
+
+	// IUnknown interface: The lifetime is managed by the registry
+	virtual HRESULT STDMETHODCALLTYPE QueryInterface(REFIID Riid, void** OutObject) override
+	{
+		if (Riid == __uuidof(IUnknown) || Riid == __uuidof(IMMNotificationClient))
+		{
+			*OutObject = static_cast<IMMNotificationClient*>(this);
+			return S_OK;
+		}
+
+		*OutObject = nullptr;
+		return E_NOINTERFACE;
+	}
+
+	virtual ULONG STDMETHODCALLTYPE AddRef() override
+	{
+		return 1;
+	}
+
+	virtual ULONG STDMETHODCALLTYPE Release() override
+	{
+		return 1;
+	}
+	// End of IUnknown interface
+
+private:
+	HRESULT RequestRefresh() const
+	{
+		if (const TSharedPtr<FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe> PinnedRegistry = Registry.Pin())
+		{
+			PinnedRegistry->RequestRefresh();
+		}
+
+		return S_OK;
+	}
+
+	TWeakPtr<FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe> Registry;
+	IMMDeviceEnumerator* DeviceEnumerator = nullptr;
+};
+#endif
+
+const FAzSpeechAudioInputDeviceInfo* FAzSpeechAudioInputDeviceSnapshot::Find(const FString& DeviceID) const
+{
+	if (const int32* const Index = DeviceIndices.Find(FAzSpeechAudioInputDeviceInfo(FString(), DeviceID).GetDeviceID()))
+	{
+		return &Devices[*Index];
+	}
+
+	// Partial IDs were accepted by the previous lookup
+	return Devices.FindByPredicate([&DeviceID](const FAzSpeechAudioInputDeviceInfo& Device)
+	{
+		return Device.GetDeviceID().Contains(DeviceID);
+	});
+}
+
+FAzSpeechAudioInputDeviceRegistry::FAzSpeechAudioInputDeviceRegistry() = default;
+
+FAzSpeechAudioInputDeviceRegistry::~FAzSpeechAudioInputDeviceRegistry()
+{
+	Shutdown();
+}
+
+void FAzSpeechAudioInputDeviceRegistry::Initialize()
+{
+	check(IsInGameThread());
+
+#if PLATFORM_WINDOWS
+	NotificationClient = new FAzSpeechDeviceNotificationClient(AsShared());
+	if (!NotificationClient->Register())
+	{
+		UE_LOG(LogAzSpeech_Internal, Warning, TEXT("%s: Failed to register the audio device notifications: Devices will only be refreshed on demand"),
+		       *FString(__FUNCTION__));
+	}
+#endif
+
+	// Devices may be connected while the application is in the background
+	ApplicationReactivatedHandle = FCoreDelegates::ApplicationHasReactivatedDelegate.AddThreadSafeSP(
+		this, &FAzSpeechAudioInputDeviceRegistry::RequestRefresh);
+
+	RequestRefresh();
+}
+
+void FAzSpeechAudioInputDeviceRegistry::Shutdown()
+{
+	if (bIsShuttingDown.exchange(true))
+	{
+		return;
+	}
+
+	FCoreDelegates::ApplicationHasReactivatedDelegate.Remove(ApplicationReactivatedHandle);
+
+#if PLATFORM_WINDOWS
+	if (NotificationClient)
+	{
+		NotificationClient->Unregister();
+		delete NotificationClient;
+		NotificationClient = nullptr;
+	}
+#endif
+}
+
+const std::shared_ptr<const FAzSpeechAudioInputDeviceSnapshot> FAzSpeechAudioInputDeviceRegistry::GetSnapshot()
+{
+	if (std::shared_ptr<const FAzSpeechAudioInputDeviceSnapshot> Output = std::atomic_load_explicit(&Snapshot, std::memory_order_acquire))
+	{
+		return Output;
+	}
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Audio input devices not enumerated yet: Enumerating synchronously"), *FString(__FUNCTION__));
+
+	Refresh();
+
+	return std::atomic_load_explicit(&Snapshot, std::memory_order_acquire);
+}
+
+void FAzSpeechAudioInputDeviceRegistry::RequestRefresh()
+{
+	if (bIsShuttingDown)
+	{
+		return;
+	}
+
+	// Notifications usually come in bursts: A single refresh runs at a time and reruns once if there were new requests meanwhile
+	bRefreshRequested = true;
+	if (bIsRefreshing.exchange(true))
+	{
+		return;
+	}
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis = TWeakPtr<FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe>(AsShared())]
+	{
+		while (const TSharedPtr<FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe> PinnedThis = WeakThis.Pin())
+		{
+			if (PinnedThis->bIsShuttingDown || !PinnedThis->bRefreshRequested.exchange(false))
+			{
+				PinnedThis->bIsRefreshing = false;
+
+				// A request may have arrived between the check and the reset
+				if (!PinnedThis->bRefreshRequested || PinnedThis->bIsShuttingDown || PinnedThis->bIsRefreshing.exchange(true))
+				{
+					break;
+				}
+
+				continue;
+			}
+
+			PinnedThis->Refresh();
+		}
+	});
+}
+
+const TArray<FAzSpeechAudioInputDeviceInfo> FAzSpeechAudioInputDeviceRegistry::EnumerateDevices()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_EnumerateAudioInputDevices);
+
+	TArray<FAzSpeechAudioInputDeviceInfo> Output;
+	TArray<Audio::FCaptureDeviceInfo> Internal_Devices;
+
+	// The capture devices are enumerated with COM on Windows: Background threads need to initialize it
+	const bool bInitializedCOM = FPlatformMisc::CoInitialize();
+
+	if (Audio::FAudioCapture AudioCapture; AudioCapture.GetCaptureDevicesAvailable(Internal_Devices) <= 0)
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: There's no available audio input devices"), *FString(__FUNCTION__));
+	}
+	else
+	{
+		UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Result: Success"), *FString(__FUNCTION__));
+
+		for (const Audio::FCaptureDeviceInfo& DeviceInfo : Internal_Devices)
+		{
+			Output.Add(FAzSpeechAudioInputDeviceInfo(DeviceInfo.DeviceName, DeviceInfo.DeviceId));
+			UE_LOG(LogAzSpeech_Debugging, Display, TEXT("%s: Found available audio input device: %s - %s"), *FString(__FUNCTION__),
+			       *Output.Last().DeviceName, *Output.Last().GetAudioInputDeviceEndpointID());
+		}
+	}
+
+	if (bInitializedCOM)
+	{
+		FPlatformMisc::CoUninitialize();
+	}
+
+	return Output;
+}
+
+void FAzSpeechAudioInputDeviceRegistry::Refresh()
+{
+	const std::shared_ptr<FAzSpeechAudioInputDeviceSnapshot> NewSnapshot = std::make_shared<FAzSpeechAudioInputDeviceSnapshot>();
+	NewSnapshot->Devices = EnumerateDevices();
+
+	NewSnapshot->DeviceIndices.Reserve(NewSnapshot->Devices.Num());
+	for (int32 Index = 0; Index < NewSnapshot->Devices.Num(); ++Index)
+	{
+		NewSnapshot->DeviceIndices.Add(NewSnapshot->Devices[Index].GetDeviceID(), Index);
+	}
+
+	const std::shared_ptr<const FAzSpeechAudioInputDeviceSnapshot> PreviousSnapshot = std::atomic_exchange_explicit(
+		&Snapshot, std::shared_ptr<const FAzSpeechAudioInputDeviceSnapshot>(NewSnapshot), std::memory_order_acq_rel);
+
+	// The first enumeration isn't a change: There were no devices known before
+	if (!PreviousSnapshot || PreviousSnapshot->Devices == NewSnapshot->Devices || bIsShuttingDown)
+	{
+		return;
+	}
+
+	UE_LOG(LogAzSpeech, Display, TEXT("%s: Audio input devices changed. Available devices: %d"), *FString(__FUNCTION__), NewSnapshot->Devices.Num());
+
+	AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakPtr<FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe>(AsShared())]
+	{
+		if (const TSharedPtr<FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe> PinnedThis = WeakThis.Pin())
+		{
+			PinnedThis->OnDevicesChanged.Broadcast();
+		}
+	});
+}
@@ -0,0 +1,217 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/AzSpeechBlendShapeTimeline.h"
+#include "AzSpeech/AzSpeechVisemeTrack.h"
+#include "LogAzSpeech.h"
+#include <Algo/BinarySearch.h>
+
+DECLARE_CYCLE_STAT(TEXT("Sample Blend Shape Timeline"), STAT_AzSpeech_SampleBlendShapeTimeline, STATGROUP_AzSpeech);
+
+FAzSpeechBlendShapeTimeline::FAzSpeechBlendShapeTimeline(const float InFrameRate) : FrameDuration(1000.f / FMath::Max(InFrameRate, 1.f))
+{
+}
+
+void FAzSpeechBlendShapeTimeline::Append(const int32 FrameIndex, const int64 AudioOffsetMilliseconds, const TArrayView<const float> InWeights,
+                                         const int32 InNumBlendShapes)
+{
+	if (InNumBlendShapes <= 0 || InWeights.Num() < InNumBlendShapes)
+	{
+		return;
+	}
+
+	if (NumBlendShapes == 0)
+	{
+		NumBlendShapes = InNumBlendShapes;
+	}
+
+	if (InNumBlendShapes != NumBlendShapes)
+	{
+		UE_LOG(LogAzSpeech_Internal, Warning, TEXT("%s: Ignoring frames with %d blend shapes: The timeline uses %d blend shapes"), *FString(__FUNCTION__),
+		       InNumBlendShapes, NumBlendShapes);
+		return;
+	}
+
+	const int32 NumFrames = InWeights.Num() / NumBlendShapes;
+
+	FrameTimes.Reserve(FrameTimes.Num() + NumFrames);
+	Weights.Reserve(Weights.Num() + NumFrames * NumBlendShapes);
+
+	for (int32 Index = 0; Index < NumFrames; ++Index)
+	{
+		const float FrameTime = GetFrameTime(FrameIndex + Index, AudioOffsetMilliseconds);
+		const float* const FrameWeights = InWeights.GetData() + Index * NumBlendShapes;
+
+		// Frames are received in order: Only out of order frames pay for the insertion
+		if (FrameTimes.Num() == 0 || FrameTime > FrameTimes.Last())
+		{
+			FrameTimes.Add(FrameTime);
+			Weights.Append(FrameWeights, NumBlendShapes);
+			continue;
+		}
+
+		const int32 InsertIndex = Algo::LowerBound(FrameTimes, FrameTime);
+		if (FrameTimes.IsValidIndex(InsertIndex) && FMath::IsNearlyEqual(FrameTimes[InsertIndex], FrameTime))
+		{
+			// Same frame received twice: Keep the most recent weights
+			FMemory::Memcpy(Weights.GetData() + InsertIndex * NumBlendShapes, FrameWeights, NumBlendShapes * sizeof(float));
+			continue;
+		}
+
+		FrameTimes.Insert(FrameTime, InsertIndex);
+		Weights.Insert(FrameWeights, NumBlendShapes, InsertIndex * NumBlendShapes);
+	}
+}
+
+void FAzSpeechBlendShapeTimeline::Update(const FAzSpeechVisemeTrack& Track)
+{
+	// The track was replaced by a new one, e.g. the task was restarted
+	if (Track.Num() < NumConsumedVisemes)
+	{
+		Empty();
+	}
+
+	AppendTrack(Track, NumConsumedVisemes);
+	NumConsumedVisemes = Track.Num();
+}
+
+void FAzSpeechBlendShapeTimeline::Update(const TAzSpeechSegmentList<FAzSpeechVisemeTrack>& VisemeBatches)
+{
+	// The batches don't extend the consumed ones: The list was replaced by a new one, e.g. the task was restarted, even if it has more batches
+	if (!VisemeBatches.Contains(LastConsumedBatch))
+	{
+		Empty();
+	}
+
+	VisemeBatches.ForEach([this](const FAzSpeechVisemeTrack& VisemeBatch)
+	{
+		AppendTrack(VisemeBatch, 0);
+	}, NumConsumedBatches);
+
+	NumConsumedBatches = VisemeBatches.Num();
+	LastConsumedBatch = VisemeBatches.GetLastHandle();
+}
+
+void FAzSpeechBlendShapeTimeline::Empty()
+{
+	FrameTimes.Empty();
+	Weights.Empty();
+	NumBlendShapes = 0;
+	TimeBase = 0.0;
+	bHasTimeBase = false;
+	NumConsumedVisemes = 0;
+	NumConsumedBatches = 0;
+	LastConsumedBatch = TAzSpeechSegmentList<FAzSpeechVisemeTrack>::FHandle();
+}
+
+const bool FAzSpeechBlendShapeTimeline::Sample(const float TimeMilliseconds, TArray<float>& OutWeights) const
+{
+	OutWeights.SetNumUninitialized(NumBlendShapes, false);
+
+	return Sample(TimeMilliseconds, TArrayView<float>(OutWeights));
+}
+
+const bool FAzSpeechBlendShapeTimeline::Sample(const float TimeMilliseconds, const TArrayView<float> OutWeights) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_SampleBlendShapeTimeline);
+
+	if (FrameTimes.Num() == 0 || OutWeights.Num() < NumBlendShapes)
+	{
+		return false;
+	}
+
+	// First frame with a time greater than the sample time: The sample is between this frame and the previous one
+	const int32 NextFrame = Algo::UpperBound(FrameTimes, TimeMilliseconds);
+
+	if (NextFrame == 0 || NextFrame == FrameTimes.Num())
+	{
+		const TArrayView<const float> ClampedWeights = GetFrameWeights(NextFrame == 0 ? 0 : FrameTimes.Num() - 1);
+		FMemory::Memcpy(OutWeights.GetData(), ClampedWeights.GetData(), NumBlendShapes * sizeof(float));
+		return true;
+	}
+
+	const int32 PreviousFrame = NextFrame - 1;
+	const float Alpha = (TimeMilliseconds - FrameTimes[PreviousFrame]) / (FrameTimes[NextFrame] - FrameTimes[PreviousFrame]);
+
+	const float* const From = Weights.GetData() + PreviousFrame * NumBlendShapes;
+	const float* const To = Weights.GetData() + NextFrame * NumBlendShapes;
+	float* const Output = OutWeights.GetData();
+
+	// Lerp 4 curves at a time: From + (To - From) * Alpha
+	const VectorRegister VectorAlpha = VectorSetFloat1(Alpha);
+
+	int32 Index = 0;
+	for (; Index + 4 <= NumBlendShapes; Index += 4)
+	{
+		const VectorRegister VectorFrom = VectorLoad(From + Index);
+		const VectorRegister VectorTo = VectorLoad(To + Index);
+
+		VectorStore(VectorMultiplyAdd(VectorSubtract(VectorTo, VectorFrom), VectorAlpha, VectorFrom), Output + Index);
+	}
+
+	for (; Index < NumBlendShapes; ++Index)
+	{
+		Output[Index] = FMath::Lerp(From[Index], To[Index], Alpha);
+	}
+
+	return true;
+}
+
+const int32 FAzSpeechBlendShapeTimeline::GetNumFrames() const
+{
+	return FrameTimes.Num();
+}
+
+const int32 FAzSpeechBlendShapeTimeline::GetNumBlendShapes() const
+{
+	return NumBlendShapes;
+}
+
+const float FAzSpeechBlendShapeTimeline::GetDuration() const
+{
+	return FrameTimes.Num() > 0 ? FrameTimes.Last() : 0.f;
+}
+
+TArrayView<const float> FAzSpeechBlendShapeTimeline::GetFrameWeights(const int32 FrameIndex) const
+{
+	if (!FrameTimes.IsValidIndex(FrameIndex))
+	{
+		return TArrayView<const float>();
+	}
+
+	return TArrayView<const float>(Weights.GetData() + FrameIndex * NumBlendShapes, NumBlendShapes);
+}
+
+TArrayView<const float> FAzSpeechBlendShapeTimeline::GetWeights() const
+{
+	return Weights;
+}
+
+TArrayView<const float> FAzSpeechBlendShapeTimeline::GetFrameTimes() const
+{
+	return FrameTimes;
+}
+
+void FAzSpeechBlendShapeTimeline::AppendTrack(const FAzSpeechVisemeTrack& Track, const int32 FirstIndex)
+{
+	for (int32 Index = FirstIndex; Index < Track.Num(); ++Index)
+	{
+		if (Track.GetNumFrames(Index) > 0)
+		{
+			Append(Track.GetFrameIndex(Index), Track.GetAudioOffsetMilliseconds(Index), Track.GetBlendShapes(Index), Track.GetNumBlendShapes());
+		}
+	}
+}
+
+const float FAzSpeechBlendShapeTimeline::GetFrameTime(const int32 FrameIndex, const int64 AudioOffsetMilliseconds)
+{
+	// The frame index counts from the start of the animation: The audio offset of the first chunk received places it in the audio
+	if (!bHasTimeBase)
+	{
+		TimeBase = FMath::Max(0.0, static_cast<double>(AudioOffsetMilliseconds) - static_cast<double>(FrameIndex) * FrameDuration);
+		bHasTimeBase = true;
+	}
+
+	return static_cast<float>(TimeBase + static_cast<double>(FrameIndex) * FrameDuration);
+}
@@ -4,12 +4,33 @@
 
 #include "AzSpeech/AzSpeechEngineSubsystem.h"
 #include "AzSpeech/Tasks/Synthesis/Bases/AzSpeechSpeechSynthesisBase.h"
+#include "AzSpeech/Tasks/Synthesis/WarmUpSynthesizerAsync.h"
+#include "AzSpeech/Runnables/Bases/AzSpeechRunnablePool.h"
+#include "AzSpeech/Runnables/Bases/AzSpeechEventQueue.h"
+#include "AzSpeech/Runnables/Synthesis/AzSpeechSynthesizerPool.h"
+#include "AzSpeech/Cache/AzSpeechSynthesisCache.h"
+#include "AzSpeech/Cache/AzSpeechSynthesisDiskCache.h"
+#include "AzSpeech/Cache/AzSpeechVoiceCatalog.h"
+#include "AzSpeech/AzSpeechAudioInputDeviceRegistry.h"
+#include "AzSpeech/AzSpeechSettings.h"
+#include "AzSpeech/AzSpeechHelper.h"
+#include "AzSpeech/AzSpeechAudioBuffer.h"
+#include "AzSpeechInternalFuncs.h"
 #include "LogAzSpeech.h"
 
 #ifdef UE_INLINE_GENERATED_CPP_BY_NAME
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechEngineSubsystem)
 #endif
 
+namespace AzSpeechEngineSubsystem
+{
+	// Seconds between the checks of idle pooled synthesizers: The pool is also checked on each acquire and release
+	constexpr double SynthesizerPoolEvictionInterval = 1.0;
+
+	// Seconds between the saves of the disk cache index: The lookups and writes only mark it as changed
+	constexpr double SynthesisDiskCacheFlushInterval = 10.0;
+}
+
 UAzSpeechEngineSubsystem::UAzSpeechEngineSubsystem()
 	: UEngineSubsystem(), RegisteredTasks()
 {
@@ -19,6 +40,50 @@ void UAzSpeechEngineSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	const UAzSpeechSettings* const Settings = UAzSpeechSettings::Get();
+
+	if (Settings->bUseSharedThreadPool)
+	{
+		RunnablePool = MakeShared<FAzSpeechRunnablePool, ESPMode::ThreadSafe>(Settings->ThreadPoolSize,
+		                                                                      AzSpeech::Internal::GetCPUThreadPriority(Settings->TasksThreadPriority));
+	}
+
+	if (Settings->bUseBatchedEventDispatch)
+	{
+		EventQueue = MakeShared<FAzSpeechEventQueue, ESPMode::ThreadSafe>();
+	}
+
+	if (Settings->bEnableSynthesizerPool)
+	{
+		SynthesizerPool = MakeShared<FAzSpeechSynthesizerPool, ESPMode::ThreadSafe>(Settings->SynthesizerPoolSize, Settings->SynthesizerPoolIdleTimeout,
+		                                                                            Settings->bPreConnectPooledSynthesizers);
+	}
+
+	if (Settings->bEnableSynthesisCache)
+	{
+		SynthesisCache = MakeShared<FAzSpeechSynthesisCache, ESPMode::ThreadSafe>(static_cast<int64>(Settings->SynthesisCacheMemoryBudget) * 1024 * 1024);
+	}
+
+	if (Settings->bEnableSynthesisDiskCache)
+	{
+		SynthesisDiskCache = MakeShared<FAzSpeechSynthesisDiskCache, ESPMode::ThreadSafe>(UAzSpeechHelper::GetAzSpeechCacheBaseDir(),
+		                                                                                  static_cast<int64>(Settings->SynthesisDiskCacheSize) * 1024 * 1024);
+		SynthesisDiskCache->LoadIndexAsync();
+	}
+
+	const FString VoiceCatalogFileName = Settings->bEnableVoiceCatalogDiskCache
+		                                     ? UAzSpeechHelper::QualifyFileExtension(UAzSpeechHelper::GetAzSpeechCacheBaseDir(), TEXT("Voices"), TEXT("azsv"))
+		                                     : FString();
+
+	VoiceCatalog = MakeShared<FAzSpeechVoiceCatalog, ESPMode::ThreadSafe>(VoiceCatalogFileName,
+	                                                                      FTimespan::FromHours(static_cast<double>(Settings->VoiceCatalogTimeToLive)));
+	VoiceCatalog->OnVoicesUpdated.AddUObject(this, &UAzSpeechEngineSubsystem::OnVoiceCatalogUpdatedNative);
+	VoiceCatalog->LoadAsync();
+
+	AudioInputDeviceRegistry = MakeShared<FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe>();
+	AudioInputDeviceRegistry->OnDevicesChanged.AddUObject(this, &UAzSpeechEngineSubsystem::OnAudioInputDevicesChangedNative);
+	AudioInputDeviceRegistry->Initialize();
+
 	UE_LOG(LogAzSpeech, Display, TEXT("%s: AzSpeech Engine Subsystem initialized."), *FString(__FUNCTION__));
 }
 
@@ -26,9 +91,108 @@ void UAzSpeechEngineSubsystem::Deinitialize()
 {
 	UE_LOG(LogAzSpeech, Display, TEXT("%s: AzSpeech Engine Subsystem deinitialized."), *FString(__FUNCTION__));
 
+	if (RunnablePool.IsValid())
+	{
+		RunnablePool->Shutdown();
+		RunnablePool.Reset();
+	}
+
+	if (EventQueue.IsValid())
+	{
+		EventQueue->Shutdown();
+		EventQueue.Reset();
+	}
+
+	if (SynthesizerPool.IsValid())
+	{
+		SynthesizerPool->Empty();
+		SynthesizerPool.Reset();
+	}
+
+	if (SynthesisCache.IsValid())
+	{
+		SynthesisCache->Empty();
+		SynthesisCache.Reset();
+	}
+
+	if (SynthesisDiskCache.IsValid())
+	{
+		SynthesisDiskCache->Flush();
+		SynthesisDiskCache.Reset();
+	}
+
+	if (VoiceCatalog.IsValid())
+	{
+		VoiceCatalog->OnVoicesUpdated.RemoveAll(this);
+		VoiceCatalog->Flush();
+		VoiceCatalog.Reset();
+	}
+
+	if (AudioInputDeviceRegistry.IsValid())
+	{
+		AudioInputDeviceRegistry->OnDevicesChanged.RemoveAll(this);
+		AudioInputDeviceRegistry->Shutdown();
+		AudioInputDeviceRegistry.Reset();
+	}
+
 	Super::Deinitialize();
 }
 
+void UAzSpeechEngineSubsystem::Tick([[maybe_unused]] float DeltaTime)
+{
+	if (EventQueue.IsValid())
+	{
+		EventQueue->DispatchPendingEvents(static_cast<double>(UAzSpeechSettings::Get()->EventDispatchFrameBudget) / 1000.0);
+	}
+
+	// Without new tasks, the idle synthesizers would keep their connections until the next acquire or release
+	if (SynthesizerPool.IsValid())
+	{
+		if (const double CurrentTime = FPlatformTime::Seconds(); CurrentTime >= NextSynthesizerPoolEvictionTime)
+		{
+			NextSynthesizerPoolEvictionTime = CurrentTime + AzSpeechEngineSubsystem::SynthesizerPoolEvictionInterval;
+			SynthesizerPool->EvictIdleSynthesizers();
+		}
+	}
+
+	if (SynthesisDiskCache.IsValid())
+	{
+		if (const double CurrentTime = FPlatformTime::Seconds(); CurrentTime >= NextSynthesisDiskCacheFlushTime)
+		{
+			NextSynthesisDiskCacheFlushTime = CurrentTime + AzSpeechEngineSubsystem::SynthesisDiskCacheFlushInterval;
+			SynthesisDiskCache->FlushAsync();
+		}
+	}
+}
+
+ETickableTickType UAzSpeechEngineSubsystem::GetTickableTickType() const
+{
+	return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UAzSpeechEngineSubsystem::IsTickable() const
+{
+	const bool bHasPendingEvents = EventQueue.IsValid() && EventQueue->Num() > 0;
+	const bool bHasIdleTimeout = SynthesizerPool.IsValid() && UAzSpeechSettings::Get()->SynthesizerPoolIdleTimeout > 0.f;
+
+	return bHasPendingEvents || bHasIdleTimeout || SynthesisDiskCache.IsValid();
+}
+
+bool UAzSpeechEngineSubsystem::IsTickableInEditor() const
+{
+	return true;
+}
+
+bool UAzSpeechEngineSubsystem::IsTickableWhenPaused() const
+{
+	return true;
+}
+
+TStatId UAzSpeechEngineSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAzSpeechEngineSubsystem, STATGROUP_AzSpeech);
+}
+
 UAzSpeechTaskBase* UAzSpeechEngineSubsystem::GetRegisteredAzSpeechTask(const FAzSpeechTaskData& Data) const
 {
 	ValidateRegisteredTasks();
@@ -134,6 +298,179 @@ bool UAzSpeechEngineSubsystem::IsQueueEmpty(const int64 QueueId) const
 	return TaskQueueMap.Find(QueueId)->Value.IsEmpty();
 }
 
+FAzSpeechThreadPoolStats UAzSpeechEngineSubsystem::GetThreadPoolStats() const
+{
+	if (!RunnablePool.IsValid())
+	{
+		return FAzSpeechThreadPoolStats();
+	}
+
+	return RunnablePool->GetStats();
+}
+
+FAzSpeechAudioBufferStats UAzSpeechEngineSubsystem::GetAudioBufferStats() const
+{
+	return FAzSpeechAudioBuffer::GetStats();
+}
+
+void UAzSpeechEngineSubsystem::ResetAudioBufferStats() const
+{
+	FAzSpeechAudioBuffer::ResetStats();
+}
+
+FAzSpeechSynthesisCacheStats UAzSpeechEngineSubsystem::GetSynthesisCacheStats() const
+{
+	if (!SynthesisCache.IsValid())
+	{
+		return FAzSpeechSynthesisCacheStats();
+	}
+
+	return SynthesisCache->GetStats();
+}
+
+void UAzSpeechEngineSubsystem::ClearSynthesisCache() const
+{
+	if (!SynthesisCache.IsValid())
+	{
+		return;
+	}
+
+	UE_LOG(LogAzSpeech, Display, TEXT("%s: Clearing AzSpeech synthesis cache."), *FString(__FUNCTION__));
+
+	SynthesisCache->Empty();
+}
+
+FAzSpeechSynthesisCacheStats UAzSpeechEngineSubsystem::GetSynthesisDiskCacheStats() const
+{
+	if (!SynthesisDiskCache.IsValid())
+	{
+		return FAzSpeechSynthesisCacheStats();
+	}
+
+	return SynthesisDiskCache->GetStats();
+}
+
+void UAzSpeechEngineSubsystem::ClearSynthesisDiskCache() const
+{
+	if (!SynthesisDiskCache.IsValid())
+	{
+		return;
+	}
+
+	UE_LOG(LogAzSpeech, Display, TEXT("%s: Clearing AzSpeech synthesis disk cache."), *FString(__FUNCTION__));
+
+	SynthesisDiskCache->Empty();
+}
+
+UWarmUpSynthesizerAsync* UAzSpeechEngineSubsystem::WarmUpSynthesizer(UObject* const WorldContextObject,
+                                                                    const FAzSpeechSubscriptionOptions& SubscriptionOptions,
+                                                                    const FAzSpeechSynthesisOptions& SynthesisOptions, const bool bWarmUpSSMLTasks) const
+{
+	if (!SynthesizerPool.IsValid())
+	{
+		UE_LOG(LogAzSpeech, Warning, TEXT("%s: Synthesizer pool is disabled. Enable it in the AzSpeech settings to warm up synthesizers."),
+		       *FString(__FUNCTION__));
+		return nullptr;
+	}
+
+	UWarmUpSynthesizerAsync* const WarmUpTask = UWarmUpSynthesizerAsync::WarmUpSynthesizer_CustomOptions(
+		WorldContextObject, SubscriptionOptions, SynthesisOptions, bWarmUpSSMLTasks);
+	WarmUpTask->Activate();
+
+	return WarmUpTask;
+}
+
+bool UAzSpeechEngineSubsystem::GetCachedVoices(const FString& Locale, TArray<FAzSpeechVoiceInfo>& Voices) const
+{
+	Voices.Empty();
+
+	if (!VoiceCatalog.IsValid())
+	{
+		return false;
+	}
+
+	const FAzSpeechVoiceCatalog::FVoiceListPtr CachedVoices = VoiceCatalog->Find(Locale);
+	if (!CachedVoices.IsValid())
+	{
+		return false;
+	}
+
+	Voices = *CachedVoices;
+
+	return true;
+}
+
+void UAzSpeechEngineSubsystem::RefreshVoiceCatalog(const FString& Locale) const
+{
+	if (VoiceCatalog.IsValid())
+	{
+		VoiceCatalog->RequestRefresh(Locale);
+	}
+}
+
+void UAzSpeechEngineSubsystem::ClearVoiceCatalog() const
+{
+	if (!VoiceCatalog.IsValid())
+	{
+		return;
+	}
+
+	UE_LOG(LogAzSpeech, Display, TEXT("%s: Clearing AzSpeech voice catalog."), *FString(__FUNCTION__));
+
+	VoiceCatalog->Empty();
+}
+
+void UAzSpeechEngineSubsystem::RefreshAudioInputDevices() const
+{
+	if (AudioInputDeviceRegistry.IsValid())
+	{
+		AudioInputDeviceRegistry->RequestRefresh();
+	}
+}
+
+void UAzSpeechEngineSubsystem::DispatchPendingEvents() const
+{
+	if (EventQueue.IsValid())
+	{
+		EventQueue->DispatchPendingEvents();
+	}
+}
+
+TSharedPtr<FAzSpeechRunnablePool, ESPMode::ThreadSafe> UAzSpeechEngineSubsystem::GetRunnablePool() const
+{
+	return RunnablePool;
+}
+
+TSharedPtr<FAzSpeechEventQueue, ESPMode::ThreadSafe> UAzSpeechEngineSubsystem::GetEventQueue() const
+{
+	return EventQueue;
+}
+
+TSharedPtr<FAzSpeechSynthesizerPool, ESPMode::ThreadSafe> UAzSpeechEngineSubsystem::GetSynthesizerPool() const
+{
+	return SynthesizerPool;
+}
+
+TSharedPtr<FAzSpeechSynthesisCache, ESPMode::ThreadSafe> UAzSpeechEngineSubsystem::GetSynthesisCache() const
+{
+	return SynthesisCache;
+}
+
+TSharedPtr<FAzSpeechSynthesisDiskCache, ESPMode::ThreadSafe> UAzSpeechEngineSubsystem::GetSynthesisDiskCache() const
+{
+	return SynthesisDiskCache;
+}
+
+TSharedPtr<FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe> UAzSpeechEngineSubsystem::GetAudioInputDeviceRegistry() const
+{
+	return AudioInputDeviceRegistry;
+}
+
+TSharedPtr<FAzSpeechVoiceCatalog, ESPMode::ThreadSafe> UAzSpeechEngineSubsystem::GetVoiceCatalog() const
+{
+	return VoiceCatalog;
+}
+
 void UAzSpeechEngineSubsystem::RegisterAzSpeechTask(UAzSpeechTaskBase* const Task) const
 {
 	if (UAzSpeechTaskStatus::IsTaskStillValid(Task) && !RegisteredTasks.Contains(Task))
@@ -309,3 +646,13 @@ void UAzSpeechEngineSubsystem::OnQueueAudioExecutionCompleted([[maybe_unused]] c
 		DequeueAudioExecutionQueue(QueueId);
 	}
 }
+
+void UAzSpeechEngineSubsystem::OnAudioInputDevicesChangedNative() const
+{
+	OnAudioInputDevicesChanged.Broadcast();
+}
+
+void UAzSpeechEngineSubsystem::OnVoiceCatalogUpdatedNative(const FString& Locale) const
+{
+	OnVoiceCatalogUpdated.Broadcast(Locale);
+}
@@ -3,7 +3,13 @@
 // Repo: https://github.com/lucoiso/UEAzSpeech
 
 #include "AzSpeech/AzSpeechHelper.h"
+#include "AzSpeech/AzSpeechAudioBuffer.h"
+#include "AzSpeech/AzSpeechVisemeParser.h"
+#include "AzSpeech/AzSpeechRecognitionMatcher.h"
+#include "AzSpeech/AzSpeechAudioInputDeviceRegistry.h"
+#include "AzSpeech/AzSpeechEngineSubsystem.h"
 #include "AzSpeechInternalFuncs.h"
+#include "AzSpeech/Tasks/Recognition/AudioDataToTextAsync.h"
 #include "AzSpeech/Tasks/Recognition/KeywordRecognitionAsync.h"
 #include "AzSpeech/Tasks/Recognition/SpeechToTextAsync.h"
 #include "AzSpeech/Tasks/Recognition/WavFileToTextAsync.h"
@@ -17,11 +23,11 @@
 #include "AzSpeech/Tasks/Synthesis/TextToWavFileAsync.h"
 #include <Audio.h>
 #include <Sound/SoundWave.h>
+#include <Sound/SoundWaveProcedural.h>
 #include <Misc/FileHelper.h>
 #include <Misc/Paths.h>
 #include <DesktopPlatformModule.h>
 #include <Kismet/GameplayStatics.h>
-#include <AudioCaptureCore.h>
 #include <HAL/FileManager.h>
 #include <AssetRegistry/AssetRegistryModule.h>
 #include <Components/AudioComponent.h>
@@ -30,9 +36,6 @@
 #include <Sound/AudioSettings.h>
 #include <Engine/Engine.h>
 #include <Interfaces/IPluginManager.h>
-#include <Serialization/JsonReader.h>
-#include <Serialization/JsonSerializer.h>
-#include <Dom/JsonObject.h>
 #include <Misc/PackageName.h>
 
 #if WITH_EDITORONLY_DATA
@@ -51,6 +54,9 @@
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechHelper)
 #endif
 
+DECLARE_CYCLE_STAT(TEXT("Convert Audio Data to Sound Wave"), STAT_AzSpeech_ConvertAudioDataToSoundWave, STATGROUP_AzSpeech);
+DECLARE_CYCLE_STAT(TEXT("Create Transient Sound Wave"), STAT_AzSpeech_CreateTransientSoundWave, STATGROUP_AzSpeech);
+
 const FString UAzSpeechHelper::QualifyModulePath(const FString& ModuleName)
 {
 	FString Output = ModuleName;
@@ -146,6 +152,68 @@ USoundWave* UAzSpeechHelper::ConvertWavFileToSoundWave(const FString& FilePath,
 USoundWave* UAzSpeechHelper::ConvertAudioDataToSoundWave(const TArray<uint8>& RawData, const FString& OutputModule,
                                                          const FString& RelativeOutputDirectory, const FString& OutputAssetName)
 {
+	return ConvertRawAudioToSoundWave(RawData, OutputModule, RelativeOutputDirectory, OutputAssetName);
+}
+
+USoundWave* UAzSpeechHelper::ConvertAudioBufferToSoundWave(const FAzSpeechAudioBuffer& AudioBuffer, const FString& OutputModule,
+                                                           const FString& RelativeOutputDirectory, const FString& OutputAssetName)
+{
+	return ConvertRawAudioToSoundWave(AudioBuffer.GetView(), OutputModule, RelativeOutputDirectory, OutputAssetName);
+}
+
+USoundWave* UAzSpeechHelper::ConvertAudioDataToTransientSoundWave(const TArray<uint8>& RawData)
+{
+	return CreateTransientSoundWave(RawData);
+}
+
+USoundWave* UAzSpeechHelper::ConvertAudioBufferToTransientSoundWave(const FAzSpeechAudioBuffer& AudioBuffer)
+{
+	return CreateTransientSoundWave(AudioBuffer.GetView());
+}
+
+USoundWaveProcedural* UAzSpeechHelper::CreateStreamingSoundWave(const int32 SampleRate)
+{
+	USoundWaveProcedural* const SoundWave = NewObject<USoundWaveProcedural>();
+	SoundWave->SetSampleRate(SampleRate);
+	SoundWave->NumChannels = 1;
+	SoundWave->Duration = INDEFINITELY_LOOPING_DURATION;
+	SoundWave->SoundGroup = SOUNDGROUP_Voice;
+	SoundWave->bLooping = false;
+
+	return SoundWave;
+}
+
+const int32 UAzSpeechHelper::QueueStreamingAudioChunk(USoundWaveProcedural* const SoundWave, const FAzSpeechAudioBuffer& ChunkData)
+{
+	if (!IsValid(SoundWave) || ChunkData.IsEmpty())
+	{
+		return 0;
+	}
+
+	const uint8* PCMData = ChunkData.GetData();
+	int32 PCMDataSize = ChunkData.Num();
+
+	// Riff formats may send the wav header with the first chunk: Only the sample data can be queued
+	if (FWaveModInfo WaveInfo; PCMDataSize > 4 && FMemory::Memcmp(PCMData, "RIFF", 4) == 0 && WaveInfo.ReadWaveInfo(
+		PCMData, PCMDataSize, nullptr, true))
+	{
+		PCMDataSize -= static_cast<int32>(WaveInfo.SampleDataStart - PCMData);
+		PCMData = WaveInfo.SampleDataStart;
+	}
+
+	if (PCMDataSize > 0)
+	{
+		SoundWave->QueueAudio(PCMData, PCMDataSize);
+	}
+
+	return FMath::Max(PCMDataSize, 0);
+}
+
+USoundWave* UAzSpeechHelper::ConvertRawAudioToSoundWave(const TArrayView<const uint8>& RawData, const FString& OutputModule,
+                                                        const FString& RelativeOutputDirectory, const FString& OutputAssetName)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_ConvertAudioDataToSoundWave);
+
 #if PLATFORM_ANDROID
     if (!CheckAndroidPermission("android.permission.WRITE_EXTERNAL_STORAGE"))
     {
@@ -153,7 +221,7 @@ USoundWave* UAzSpeechHelper::ConvertAudioDataToSoundWave(const TArray<uint8>& Ra
     }
 #endif
 
-	if (!IsAudioDataValid(RawData))
+	if (RawData.Num() == 0)
 	{
 		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: RawData is empty"), *FString(__FUNCTION__));
 		return nullptr;
@@ -213,17 +281,20 @@ USoundWave* UAzSpeechHelper::ConvertAudioDataToSoundWave(const TArray<uint8>& Ra
 #if WITH_EDITORONLY_DATA
 #if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1)
 		SoundWave->RawData.UpdatePayload(FSharedBuffer::Clone(RawData.GetData(), RawData.Num()));
+		FAzSpeechAudioBuffer::RegisterCopy(RawData.Num());
 #else
         SoundWave->RawData.Lock(LOCK_READ_WRITE);
         void* LockedData = SoundWave->RawData.Realloc(RawData.Num());
         FMemory::Memcpy(LockedData, RawData.GetData(), RawData.Num());
         SoundWave->RawData.Unlock();
+        FAzSpeechAudioBuffer::RegisterCopy(RawData.Num());
 #endif
 #endif
 
 		SoundWave->RawPCMDataSize = WaveInfo.SampleDataSize;
 		SoundWave->RawPCMData = static_cast<uint8*>(FMemory::Malloc(WaveInfo.SampleDataSize));
 		FMemory::Memcpy(SoundWave->RawPCMData, WaveInfo.SampleDataStart, WaveInfo.SampleDataSize);
+		FAzSpeechAudioBuffer::RegisterCopy(WaveInfo.SampleDataSize);
 
 		SoundWave->Duration = static_cast<float>(NumFrames) / *WaveInfo.pSamplesPerSec;
 		SoundWave->SetSampleRate(*WaveInfo.pSamplesPerSec);
@@ -292,9 +363,13 @@ USoundWave* UAzSpeechHelper::ConvertAudioDataToSoundWave(const TArray<uint8>& Ra
 #endif
 
 #if WITH_EDITOR
-			TArray<FAssetData> SyncAssets;
-			SyncAssets.Add(FAssetData(SoundWave));
-			GEditor->SyncBrowserToObjects(SyncAssets);
+			// There's no content browser to sync when baking assets in commandlets
+			if (GEditor && !IsRunningCommandlet())
+			{
+				TArray<FAssetData> SyncAssets;
+				SyncAssets.Add(FAssetData(SoundWave));
+				GEditor->SyncBrowserToObjects(SyncAssets);
+			}
 #endif
 		}
 
@@ -311,6 +386,56 @@ USoundWave* UAzSpeechHelper::ConvertAudioDataToSoundWave(const TArray<uint8>& Ra
 	return nullptr;
 }
 
+USoundWave* UAzSpeechHelper::CreateTransientSoundWave(const TArrayView<const uint8>& RawData)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_CreateTransientSoundWave);
+
+	FWaveModInfo WaveInfo;
+	if (RawData.Num() == 0 || !WaveInfo.ReadWaveInfo(RawData.GetData(), RawData.Num()))
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Invalid audio data"), *FString(__FUNCTION__));
+		return nullptr;
+	}
+
+	const int32 ChannelCount = *WaveInfo.pChannels;
+	const int32 SampleRate = *WaveInfo.pSamplesPerSec;
+	const int32 SizeOfSample = (*WaveInfo.pBitsPerSample) / 8;
+
+	if (ChannelCount <= 0 || SampleRate <= 0 || SizeOfSample <= 0)
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Invalid wave format"), *FString(__FUNCTION__));
+		return nullptr;
+	}
+
+	const int32 NumFrames = WaveInfo.SampleDataSize / SizeOfSample / ChannelCount;
+
+	// Runtime only: No package, no asset registry and no editor raw data. The PCM data is the only copy kept by the sound wave
+	USoundWave* const SoundWave = NewObject<USoundWave>(GetTransientPackage(), NAME_None, RF_Transient);
+	if (!SoundWave)
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Cannot create a new Sound Wave"), *FString(__FUNCTION__));
+		return nullptr;
+	}
+
+	SoundWave->RawPCMDataSize = WaveInfo.SampleDataSize;
+	SoundWave->RawPCMData = static_cast<uint8*>(FMemory::Malloc(WaveInfo.SampleDataSize));
+	FMemory::Memcpy(SoundWave->RawPCMData, WaveInfo.SampleDataStart, WaveInfo.SampleDataSize);
+	FAzSpeechAudioBuffer::RegisterCopy(WaveInfo.SampleDataSize);
+
+	SoundWave->Duration = static_cast<float>(NumFrames) / SampleRate;
+	SoundWave->SetSampleRate(SampleRate);
+	SoundWave->NumChannels = ChannelCount;
+	SoundWave->TotalSamples = SampleRate * SoundWave->Duration;
+	SoundWave->SoundGroup = SOUNDGROUP_Voice;
+
+#if ENGINE_MAJOR_VERSION >= 5
+	SoundWave->SetImportedSampleRate(SampleRate);
+#endif
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Result: Success"), *FString(__FUNCTION__));
+	return SoundWave;
+}
+
 const FString UAzSpeechHelper::LoadXMLToString(const FString& FilePath, const FString& FileName)
 {
 	if (AzSpeech::Internal::HasEmptyParam(FilePath, FileName))
@@ -411,28 +536,37 @@ const bool UAzSpeechHelper::IsAudioDataValid(const TArray<uint8>& RawData)
 	return bOutput;
 }
 
-const TArray<FAzSpeechAudioInputDeviceInfo> UAzSpeechHelper::GetAvailableAudioInputDevices()
+namespace
 {
-	TArray<FAzSpeechAudioInputDeviceInfo> Output;
-	TArray<Audio::FCaptureDeviceInfo> Internal_Devices;
-
-	if (Audio::FAudioCapture AudioCapture; AudioCapture.GetCaptureDevicesAvailable(Internal_Devices) <= 0)
-	{
-		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: There's no available audio input devices"), *FString(__FUNCTION__));
-	}
-	else
+	const std::shared_ptr<const FAzSpeechAudioInputDeviceSnapshot> GetAudioInputDeviceSnapshot()
 	{
-		UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Result: Success"), *FString(__FUNCTION__));
+		if (GEngine)
+		{
+			if (const UAzSpeechEngineSubsystem* const Subsystem = GEngine->GetEngineSubsystem<UAzSpeechEngineSubsystem>())
+			{
+				if (const TSharedPtr<FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe> Registry = Subsystem->GetAudioInputDeviceRegistry())
+				{
+					return Registry->GetSnapshot();
+				}
+			}
+		}
 
-		for (const Audio::FCaptureDeviceInfo& DeviceInfo : Internal_Devices)
+		// No registry available yet: e.g. called before the engine initialization
+		const std::shared_ptr<FAzSpeechAudioInputDeviceSnapshot> Output = std::make_shared<FAzSpeechAudioInputDeviceSnapshot>();
+		Output->Devices = FAzSpeechAudioInputDeviceRegistry::EnumerateDevices();
+
+		for (int32 Index = 0; Index < Output->Devices.Num(); ++Index)
 		{
-			Output.Add(FAzSpeechAudioInputDeviceInfo(DeviceInfo.DeviceName, DeviceInfo.DeviceId));
-			UE_LOG(LogAzSpeech_Debugging, Display, TEXT("%s: Found available audio input device: %s - %s"), *FString(__FUNCTION__),
-			       *Output.Last().DeviceName, *Output.Last().GetAudioInputDeviceEndpointID());
+			Output->DeviceIndices.Add(Output->Devices[Index].GetDeviceID(), Index);
 		}
+
+		return Output;
 	}
+}
 
-	return Output;
+const TArray<FAzSpeechAudioInputDeviceInfo> UAzSpeechHelper::GetAvailableAudioInputDevices()
+{
+	return GetAudioInputDeviceSnapshot()->Devices;
 }
 
 template <typename ReturnTy>
@@ -459,18 +593,16 @@ const ReturnTy GetInformationFromDeviceID_T(const FString& DeviceID)
 		return InvalidReturn_Lambda();
 	}
 
-	for (const FAzSpeechAudioInputDeviceInfo& DeviceInfo : UAzSpeechHelper::GetAvailableAudioInputDevices())
+	const std::shared_ptr<const FAzSpeechAudioInputDeviceSnapshot> Snapshot = GetAudioInputDeviceSnapshot();
+	if (const FAzSpeechAudioInputDeviceInfo* const DeviceInfo = Snapshot->Find(DeviceID))
 	{
-		if (DeviceInfo.GetDeviceID().Contains(DeviceID))
+		if constexpr (std::is_base_of<ReturnTy, bool>())
 		{
-			if constexpr (std::is_base_of<ReturnTy, bool>())
-			{
-				return true;
-			}
-			else if constexpr (std::is_base_of<ReturnTy, FAzSpeechAudioInputDeviceInfo>())
-			{
-				return DeviceInfo;
-			}
+			return true;
+		}
+		else if constexpr (std::is_base_of<ReturnTy, FAzSpeechAudioInputDeviceInfo>())
+		{
+			return *DeviceInfo;
 		}
 	}
 
@@ -548,27 +680,22 @@ const FAzSpeechAnimationData UAzSpeechHelper::ExtractAnimationDataFromVisemeData
 		return Output;
 	}
 
-	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(VisemeData.Animation);
-	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
-	FJsonSerializer::Deserialize(Reader, JsonObject);
+	FAzSpeechVisemeAnimationInfo AnimationInfo;
+	int32 NumBlendShapes = 0;
+	TArray<float> BlendShapes;
 
-	if (!JsonObject.IsValid())
+	if (!FAzSpeechVisemeParser::ParseAnimation(*VisemeData.Animation, VisemeData.Animation.Len(), AnimationInfo, NumBlendShapes, BlendShapes))
 	{
 		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Failed to deserialize animation data"), *FString(__FUNCTION__));
 		return Output;
 	}
 
-	Output.FrameIndex = JsonObject->GetIntegerField(TEXT("FrameIndex"));
+	Output.FrameIndex = AnimationInfo.FrameIndex;
+	Output.BlendShapes.Reserve(AnimationInfo.NumFrames);
 
-	for (const TSharedPtr<FJsonValue>& IteratorArray : JsonObject->GetArrayField(TEXT("BlendShapes")))
+	for (int32 FrameIndex = 0; FrameIndex < AnimationInfo.NumFrames; ++FrameIndex)
 	{
-		FAzSpeechBlendShapes CurrentBlendShapes;
-		for (const TSharedPtr<FJsonValue>& IteratorValue : IteratorArray->AsArray())
-		{
-			CurrentBlendShapes.Data.Add(static_cast<float>(IteratorValue->AsNumber()));
-		}
-
-		Output.BlendShapes.Add(CurrentBlendShapes);
+		Output.BlendShapes.AddDefaulted_GetRef().Data.Append(BlendShapes.GetData() + FrameIndex * NumBlendShapes, NumBlendShapes);
 	}
 
 	return Output;
@@ -586,6 +713,47 @@ const TArray<FAzSpeechAnimationData> UAzSpeechHelper::ExtractAnimationDataFromVi
 	return Output;
 }
 
+const int32 UAzSpeechHelper::CheckRecognitionMap(const FString& InString, const FName& GroupName, const bool bStopAtFirstTrigger, int32& MatchPoints)
+{
+	MatchPoints = 0;
+
+	if (AzSpeech::Internal::HasEmptyParam(InString, GroupName))
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Invalid input string or group name"), *FString(__FUNCTION__));
+		return -1;
+	}
+
+	const TSharedPtr<const FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe> Matcher = FAzSpeechRecognitionMatcher::GetCompiledGroup(GroupName);
+	if (!Matcher.IsValid())
+	{
+		return -1;
+	}
+
+	uint32 Output_MatchPoints = 0u;
+	const int32 Output = Matcher->Match(InString, bStopAtFirstTrigger, Output_MatchPoints);
+	MatchPoints = static_cast<int32>(Output_MatchPoints);
+
+	return Output;
+}
+
+const TArray<FAzSpeechRecognitionMatch> UAzSpeechHelper::CheckRecognitionMapGroups(const FString& InString, const bool bStopAtFirstTrigger)
+{
+	TArray<FAzSpeechRecognitionMatch> Output;
+
+	if (AzSpeech::Internal::HasEmptyParam(InString))
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Invalid input string"), *FString(__FUNCTION__));
+		return Output;
+	}
+
+	if (const TSharedPtr<const FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe> Matcher = FAzSpeechRecognitionMatcher::GetCompiledMap())
+	{
+		Matcher->MatchAllGroups(InString, bStopAtFirstTrigger, Output);
+	}
+
+	return Output;
+}
+
 UAzSpeechTaskBase* UAzSpeechHelper::CastToAzSpeechTaskBase(UObject* const Object)
 {
 	return Cast<UAzSpeechTaskBase>(Object);
@@ -606,6 +774,19 @@ const FString UAzSpeechHelper::GetAzSpeechLogsBaseDir()
 	return FPaths::Combine(*FPaths::ProjectLogDir(), TEXT("AzSpeech"));
 }
 
+const FString UAzSpeechHelper::GetAzSpeechCacheBaseDir()
+{
+	return FPaths::Combine(*FPaths::ProjectSavedDir(), TEXT("AzSpeechCache"));
+}
+
+UAzSpeechTaskBase* UAzSpeechHelper::CreateAudioDataToTextTask(UObject* const WorldContextObject,
+                                                              const FAzSpeechSubscriptionOptions& SubscriptionOptions,
+                                                              const FAzSpeechRecognitionOptions& RecognitionOptions, const TArray<uint8>& AudioData,
+                                                              const FName& PhraseListGroup)
+{
+	return UAudioDataToTextAsync::AudioDataToText_CustomOptions(WorldContextObject, SubscriptionOptions, RecognitionOptions, AudioData, PhraseListGroup);
+}
+
 UAzSpeechTaskBase* UAzSpeechHelper::CreateKeywordRecognitionTask(UObject* const WorldContextObject,
                                                                  const FAzSpeechSubscriptionOptions& SubscriptionOptions,
                                                                  const FAzSpeechRecognitionOptions& RecognitionOptions,
@@ -0,0 +1,102 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/AzSpeechMapGroupIndex.h"
+#include "AzSpeech/AzSpeechSettings.h"
+#include "AzSpeechInternalFuncs.h"
+#include "LogAzSpeech.h"
+
+namespace AzSpeechMapGroupIndex
+{
+	std::shared_ptr<const FAzSpeechMapGroupIndex> CurrentIndex;
+}
+
+FAzSpeechMapGroupIndex::FAzSpeechMapGroupIndex(const UAzSpeechSettings& Settings)
+{
+	PhraseLists.Reserve(Settings.PhraseListMap.Num());
+	PhraseListsUTF8.Reserve(Settings.PhraseListMap.Num());
+
+	for (const FAzSpeechPhraseListMap& PhraseList : Settings.PhraseListMap)
+	{
+		// The first group with the name is used, as in the previous linear search
+		if (AzSpeech::Internal::HasEmptyParam(PhraseList.GroupName) || PhraseListIndices.Contains(PhraseList.GroupName))
+		{
+			continue;
+		}
+
+		PhraseListIndices.Add(PhraseList.GroupName, PhraseLists.Add(PhraseList));
+
+		TArray<std::string>& PhrasesUTF8 = PhraseListsUTF8.AddDefaulted_GetRef();
+		PhrasesUTF8.Reserve(PhraseList.Data.Num());
+
+		for (const FString& Phrase : PhraseList.Data)
+		{
+			const FTCHARToUTF8 Converter(*Phrase);
+			PhrasesUTF8.Emplace(Converter.Get(), Converter.Length());
+		}
+	}
+
+	RecognitionMaps.Reserve(Settings.RecognitionMap.Num());
+
+	for (const FAzSpeechRecognitionMap& RecognitionMap : Settings.RecognitionMap)
+	{
+		if (AzSpeech::Internal::HasEmptyParam(RecognitionMap.GroupName) || AzSpeech::Internal::HasEmptyParam(RecognitionMap.Data) ||
+			RecognitionMapIndices.Contains(RecognitionMap.GroupName))
+		{
+			continue;
+		}
+
+		RecognitionMapIndices.Add(RecognitionMap.GroupName, RecognitionMaps.Add(RecognitionMap));
+	}
+}
+
+TArrayView<const FString> FAzSpeechMapGroupIndex::GetPhraseList(const FName& GroupName) const
+{
+	const int32* const Index = PhraseListIndices.Find(GroupName);
+	return Index ? TArrayView<const FString>(PhraseLists[*Index].Data) : TArrayView<const FString>();
+}
+
+TArrayView<const std::string> FAzSpeechMapGroupIndex::GetPhraseListUTF8(const FName& GroupName) const
+{
+	const int32* const Index = PhraseListIndices.Find(GroupName);
+	return Index ? TArrayView<const std::string>(PhraseListsUTF8[*Index]) : TArrayView<const std::string>();
+}
+
+const FAzSpeechRecognitionMap* FAzSpeechMapGroupIndex::FindRecognitionMap(const FName& GroupName) const
+{
+	const int32* const Index = RecognitionMapIndices.Find(GroupName);
+	return Index ? &RecognitionMaps[*Index] : nullptr;
+}
+
+TArrayView<const FAzSpeechRecognitionMap> FAzSpeechMapGroupIndex::GetRecognitionMaps() const
+{
+	return RecognitionMaps;
+}
+
+std::shared_ptr<const FAzSpeechMapGroupIndex> FAzSpeechMapGroupIndex::Get()
+{
+	if (std::shared_ptr<const FAzSpeechMapGroupIndex> Output = std::atomic_load_explicit(&AzSpeechMapGroupIndex::CurrentIndex,
+	                                                                                     std::memory_order_acquire))
+	{
+		return Output;
+	}
+
+	if (const UAzSpeechSettings* const Settings = UAzSpeechSettings::Get())
+	{
+		Rebuild(*Settings);
+		return std::atomic_load_explicit(&AzSpeechMapGroupIndex::CurrentIndex, std::memory_order_acquire);
+	}
+
+	return std::make_shared<const FAzSpeechMapGroupIndex>();
+}
+
+void FAzSpeechMapGroupIndex::Rebuild(const UAzSpeechSettings& Settings)
+{
+	const std::shared_ptr<const FAzSpeechMapGroupIndex> NewIndex = std::make_shared<const FAzSpeechMapGroupIndex>(Settings);
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Indexed %d phrase list groups and %d recognition map groups"), *FString(__FUNCTION__),
+	       NewIndex->PhraseLists.Num(), NewIndex->RecognitionMaps.Num());
+
+	std::atomic_store_explicit(&AzSpeechMapGroupIndex::CurrentIndex, NewIndex, std::memory_order_release);
+}
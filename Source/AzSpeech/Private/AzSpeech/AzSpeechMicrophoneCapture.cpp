@@ -0,0 +1,215 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/AzSpeechMicrophoneCapture.h"
+#include "AzSpeech/AzSpeechAudioInputDeviceRegistry.h"
+#include "AzSpeech/AzSpeechEngineSubsystem.h"
+#include "LogAzSpeech.h"
+#include <AudioCaptureCore.h>
+#include <Engine/Engine.h>
+#include <Misc/ScopeLock.h>
+
+DECLARE_CYCLE_STAT(TEXT("Microphone Capture"), STAT_AzSpeech_MicrophoneCapture, STATGROUP_AzSpeech);
+
+namespace MicrosoftSpeech = Microsoft::CognitiveServices::Speech;
+
+namespace AzSpeechMicrophoneCapture
+{
+	// About 10 ms at 48 kHz
+	constexpr uint32 NumFramesDesired = 480u;
+
+	const int32 GetDeviceIndex(const FString& DeviceID)
+	{
+		if (DeviceID.IsEmpty())
+		{
+			return INDEX_NONE;
+		}
+
+		// The registry keeps the devices in the same order of the audio capture enumeration
+		const UAzSpeechEngineSubsystem* const Subsystem = GEngine ? GEngine->GetEngineSubsystem<UAzSpeechEngineSubsystem>() : nullptr;
+		const TSharedPtr<FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe> Registry = Subsystem ? Subsystem->GetAudioInputDeviceRegistry() : nullptr;
+
+		if (Registry.IsValid())
+		{
+			const std::shared_ptr<const FAzSpeechAudioInputDeviceSnapshot> Snapshot = Registry->GetSnapshot();
+			if (const FAzSpeechAudioInputDeviceInfo* const DeviceInfo = Snapshot->Find(DeviceID))
+			{
+				return static_cast<int32>(DeviceInfo - Snapshot->Devices.GetData());
+			}
+
+			return INDEX_NONE;
+		}
+
+		const TArray<FAzSpeechAudioInputDeviceInfo> Devices = FAzSpeechAudioInputDeviceRegistry::EnumerateDevices();
+		return Devices.IndexOfByPredicate([&DeviceID](const FAzSpeechAudioInputDeviceInfo& Device)
+		{
+			return Device.GetDeviceID().Contains(DeviceID);
+		});
+	}
+}
+
+FAzSpeechMicrophoneCapture::FAzSpeechMicrophoneCapture(const bool bInEnableVoiceActivityDetection,
+                                                       const FAzSpeechVoiceActivitySettings& InVoiceActivitySettings)
+	: AudioCapture(MakeUnique<Audio::FAudioCapture>()), bEnableVoiceActivityDetection(bInEnableVoiceActivityDetection),
+	  VoiceActivityDetector(InVoiceActivitySettings)
+{
+	PushStream = MicrosoftSpeech::Audio::AudioInputStream::CreatePushStream(
+		MicrosoftSpeech::Audio::AudioStreamFormat::GetWaveFormatPCM(StreamSampleRate, 16, 1));
+	AudioConfig = MicrosoftSpeech::Audio::AudioConfig::FromStreamInput(PushStream);
+}
+
+FAzSpeechMicrophoneCapture::~FAzSpeechMicrophoneCapture()
+{
+	Stop();
+}
+
+const bool FAzSpeechMicrophoneCapture::Start(const FString& DeviceID)
+{
+	Audio::FAudioCaptureDeviceParams Params;
+	Params.DeviceIndex = AzSpeechMicrophoneCapture::GetDeviceIndex(DeviceID);
+
+	if (!DeviceID.IsEmpty() && Params.DeviceIndex == INDEX_NONE)
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Audio input device '%s' not found."), *FString(__FUNCTION__), *DeviceID);
+		return false;
+	}
+
+	VoiceActivityDetector.Reset();
+
+	if (AudioConverter.IsValid())
+	{
+		AudioConverter->Reset();
+	}
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3)
+	const bool bOpened = AudioCapture->OpenAudioCaptureStream(Params, [this](const void* InAudio, const int32 NumFrames, const int32 NumChannels,
+	                                                                        const int32 SampleRate, [[maybe_unused]] const double StreamTime,
+	                                                                        [[maybe_unused]] const bool bOverflow)
+	                                                         {
+		                                                         OnAudioCaptured(static_cast<const float*>(InAudio), NumFrames, NumChannels, SampleRate);
+	                                                         }, AzSpeechMicrophoneCapture::NumFramesDesired);
+#else
+	const bool bOpened = AudioCapture->OpenCaptureStream(Params, [this](const float* InAudio, const int32 NumFrames, const int32 NumChannels,
+	                                                                   const int32 SampleRate, [[maybe_unused]] const double StreamTime,
+	                                                                   [[maybe_unused]] const bool bOverflow)
+	                                                    {
+		                                                    OnAudioCaptured(InAudio, NumFrames, NumChannels, SampleRate);
+	                                                    }, AzSpeechMicrophoneCapture::NumFramesDesired);
+#endif
+
+	if (!bOpened || !AudioCapture->StartStream())
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Failed to open the audio capture stream."), *FString(__FUNCTION__));
+		AudioCapture->CloseStream();
+
+		return false;
+	}
+
+	{
+		FScopeLock Lock(&Mutex);
+		bIsCapturing = true;
+	}
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Audio capture started. Device index: %d; Voice activity detection: %s"), *FString(__FUNCTION__),
+	       Params.DeviceIndex, bEnableVoiceActivityDetection ? TEXT("Enabled") : TEXT("Disabled"));
+
+	return true;
+}
+
+void FAzSpeechMicrophoneCapture::Stop()
+{
+	{
+		FScopeLock Lock(&Mutex);
+
+		if (!bIsCapturing)
+		{
+			return;
+		}
+
+		bIsCapturing = false;
+	}
+
+	AudioCapture->StopStream();
+	AudioCapture->CloseStream();
+
+	if (PushStream)
+	{
+		PushStream->Close();
+	}
+
+	const int64 CapturedSamples = NumCapturedSamples.load();
+	const int64 SentSamples = NumSentSamples.load();
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Audio capture stopped. Captured samples: %lld; Sent samples: %lld (%.1f%%)"), *FString(__FUNCTION__),
+	       CapturedSamples, SentSamples, CapturedSamples > 0 ? 100.0 * static_cast<double>(SentSamples) / static_cast<double>(CapturedSamples) : 0.0);
+}
+
+std::shared_ptr<MicrosoftSpeech::Audio::AudioConfig> FAzSpeechMicrophoneCapture::GetAudioConfig() const
+{
+	return AudioConfig;
+}
+
+const int64 FAzSpeechMicrophoneCapture::GetNumCapturedSamples() const
+{
+	return NumCapturedSamples.load();
+}
+
+const int64 FAzSpeechMicrophoneCapture::GetNumSentSamples() const
+{
+	return NumSentSamples.load();
+}
+
+void FAzSpeechMicrophoneCapture::OnAudioCaptured(const float* const InAudio, const int32 NumFrames, const int32 NumChannels, const int32 SampleRate)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_MicrophoneCapture);
+
+	if (!InAudio || NumFrames <= 0 || NumChannels <= 0 || SampleRate <= 0)
+	{
+		return;
+	}
+
+	if (!AudioConverter.IsValid() || AudioConverter->GetInputSampleRate() != SampleRate || AudioConverter->GetNumInputChannels() != NumChannels)
+	{
+		AudioConverter = MakeUnique<FAzSpeechAudioConverter>(SampleRate, NumChannels, StreamSampleRate,
+		                                                     FMath::Max<int32>(NumFrames, AzSpeechMicrophoneCapture::NumFramesDesired));
+	}
+
+	// Only grows if the device delivers a longer callback than the previous ones
+	if (const int32 MaxOutputFrames = AudioConverter->GetMaxOutputFrames(NumFrames); MaxOutputFrames > ResampledBuffer.Num())
+	{
+		ResampledBuffer.SetNumUninitialized(MaxOutputFrames);
+	}
+
+	const int32 NumResampled = AudioConverter->Process(InAudio, NumFrames, ResampledBuffer);
+	const TArrayView<const float> Resampled(ResampledBuffer.GetData(), NumResampled);
+
+	NumCapturedSamples += NumResampled;
+
+	if (!bEnableVoiceActivityDetection)
+	{
+		Send(Resampled);
+		return;
+	}
+
+	VoiceActivityDetector.Process(Resampled, [this](const TArrayView<const float> Samples)
+	{
+		Send(Samples);
+	});
+}
+
+void FAzSpeechMicrophoneCapture::Send(const TArrayView<const float> Samples)
+{
+	PCMBuffer.SetNumUninitialized(Samples.Num(), false);
+	FAzSpeechAudioConverter::FloatToInt16(Samples.GetData(), Samples.Num(), PCMBuffer.GetData());
+
+	FScopeLock Lock(&Mutex);
+
+	if (!bIsCapturing || !PushStream)
+	{
+		return;
+	}
+
+	PushStream->Write(reinterpret_cast<uint8_t*>(PCMBuffer.GetData()), static_cast<uint32_t>(PCMBuffer.Num() * sizeof(int16)));
+	NumSentSamples += Samples.Num();
+}
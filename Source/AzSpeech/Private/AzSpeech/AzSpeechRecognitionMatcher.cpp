@@ -0,0 +1,501 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/AzSpeechRecognitionMatcher.h"
+#include "AzSpeech/Structures/AzSpeechRecognitionMap.h"
+#include "AzSpeech/AzSpeechSettings.h"
+#include "AzSpeech/AzSpeechMapGroupIndex.h"
+#include "AzSpeechInternalFuncs.h"
+#include "LogAzSpeech.h"
+#include <Algo/BinarySearch.h>
+#include <Misc/ScopeLock.h>
+
+DECLARE_CYCLE_STAT(TEXT("Compile Recognition Map"), STAT_AzSpeech_CompileRecognitionMap, STATGROUP_AzSpeech);
+DECLARE_CYCLE_STAT(TEXT("Match Recognition Map"), STAT_AzSpeech_MatchRecognitionMap, STATGROUP_AzSpeech);
+
+namespace AzSpeechRecognitionMatcher
+{
+	FCriticalSection CompiledGroupsMutex;
+	TMap<FName, TSharedPtr<const FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe>> CompiledGroups;
+	TSharedPtr<const FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe> CompiledMap;
+
+	// Incremented by each invalidation: A matcher compiled from outdated settings is returned to its caller, but never stored
+	uint32 CompiledGroupsGeneration = 0;
+}
+
+FAzSpeechRecognitionMatcher::FAzSpeechRecognitionMatcher(const FAzSpeechRecognitionMap& InMap, const FString& InStringDelimiters)
+{
+	SetStringDelimiters(InStringDelimiters);
+	Compile(MakeArrayView(&InMap, 1));
+}
+
+FAzSpeechRecognitionMatcher::FAzSpeechRecognitionMatcher(const TArrayView<const FAzSpeechRecognitionMap> InMaps, const FString& InStringDelimiters)
+{
+	SetStringDelimiters(InStringDelimiters);
+	Compile(InMaps);
+}
+
+void FAzSpeechRecognitionMatcher::SetStringDelimiters(const FString& InStringDelimiters)
+{
+	for (const TCHAR& Delimiter : InStringDelimiters)
+	{
+		if (static_cast<uint32>(Delimiter) < 128u)
+		{
+			AsciiDelimiters[Delimiter >> 6] |= 1ull << (Delimiter & 63);
+		}
+		else
+		{
+			OtherDelimiters.AddUnique(Delimiter);
+		}
+	}
+
+	OtherDelimiters.Sort();
+}
+
+void FAzSpeechRecognitionMatcher::Compile(const TArrayView<const FAzSpeechRecognitionMap> InMaps)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_CompileRecognitionMap);
+
+	// Trie of the case folded keys: Identical keys share the same pattern with a usage per occurrence
+	TArray<TMap<TCHAR, int32>> Children;
+	Children.AddDefaulted();
+	Nodes.AddDefaulted();
+
+	TArray<TArray<FAzSpeechKeyUsage>> PatternUsages;
+
+	const auto AddKey = [&](const FString& Key, const EAzSpeechKeyType Type, const int32 DataIndex)
+	{
+		if (AzSpeech::Internal::HasEmptyParam(Key))
+		{
+			UE_LOG(LogAzSpeech_Internal, Warning, TEXT("%s: Ignoring empty key in recognition map group %s"), *FString(__FUNCTION__),
+			       *Groups.Last().GroupName.ToString());
+			return;
+		}
+
+		int32 Node = 0;
+		for (const TCHAR& Character : Key)
+		{
+			const TCHAR FoldedCharacter = FChar::ToLower(Character);
+			if (const int32* const Child = Children[Node].Find(FoldedCharacter))
+			{
+				Node = *Child;
+				continue;
+			}
+
+			const int32 NewNode = Nodes.AddDefaulted();
+			Children.AddDefaulted();
+			Children[Node].Add(FoldedCharacter, NewNode);
+			Node = NewNode;
+		}
+
+		if (Nodes[Node].Pattern == INDEX_NONE)
+		{
+			Nodes[Node].Pattern = Patterns.AddDefaulted();
+			Patterns[Nodes[Node].Pattern].Length = Key.Len();
+			PatternUsages.AddDefaulted();
+		}
+
+		FAzSpeechKeyUsage& NewUsage = PatternUsages[Nodes[Node].Pattern].AddDefaulted_GetRef();
+		NewUsage.Type = Type;
+		NewUsage.GroupIndex = Groups.Num() - 1;
+		NewUsage.DataIndex = DataIndex;
+	};
+
+	for (const FAzSpeechRecognitionMap& InMap : InMaps)
+	{
+		FAzSpeechMatcherGroup& NewGroup = Groups.AddDefaulted_GetRef();
+		NewGroup.GroupName = InMap.GroupName;
+		NewGroup.bHasRequirementKeys = !AzSpeech::Internal::HasEmptyParam(InMap.GlobalRequirementKeys);
+
+		for (const FString& Key : InMap.GlobalRequirementKeys)
+		{
+			AddKey(Key, EAzSpeechKeyType::Requirement, INDEX_NONE);
+		}
+
+		for (const FString& Key : InMap.GlobalIgnoreKeys)
+		{
+			AddKey(Key, EAzSpeechKeyType::GlobalIgnore, INDEX_NONE);
+		}
+
+		Entries.Reserve(Entries.Num() + InMap.Data.Num());
+		for (const FAzSpeechRecognitionData& Data : InMap.Data)
+		{
+			const int32 DataIndex = Entries.AddDefaulted();
+			Entries[DataIndex].Value = Data.Value;
+			Entries[DataIndex].Weight = Data.Weight;
+
+			for (const FString& Key : Data.IgnoreKeys)
+			{
+				AddKey(Key, EAzSpeechKeyType::Ignore, DataIndex);
+			}
+
+			for (const FString& Key : Data.TriggerKeys)
+			{
+				AddKey(Key, EAzSpeechKeyType::Trigger, DataIndex);
+			}
+		}
+	}
+
+	// Flatten the usages and the edges: Edges are sorted by character to be found with a binary search
+	for (int32 Pattern = 0; Pattern < Patterns.Num(); ++Pattern)
+	{
+		Patterns[Pattern].FirstUsage = Usages.Num();
+		Patterns[Pattern].NumUsages = PatternUsages[Pattern].Num();
+		Usages.Append(PatternUsages[Pattern]);
+	}
+
+	EdgeCharacters.Reserve(Nodes.Num() - 1);
+	EdgeTargets.Reserve(Nodes.Num() - 1);
+
+	for (int32 Node = 0; Node < Nodes.Num(); ++Node)
+	{
+		Children[Node].KeySort(TLess<TCHAR>());
+
+		Nodes[Node].FirstEdge = EdgeCharacters.Num();
+		Nodes[Node].NumEdges = Children[Node].Num();
+
+		for (const TPair<TCHAR, int32>& Edge : Children[Node])
+		{
+			EdgeCharacters.Add(Edge.Key);
+			EdgeTargets.Add(Edge.Value);
+		}
+	}
+
+	// Breadth first: The failure link of a node is the longest proper suffix of its key that is also a prefix in the trie
+	TArray<int32> PendingNodes;
+	PendingNodes.Reserve(Nodes.Num());
+
+	for (int32 Edge = 0; Edge < Nodes[0].NumEdges; ++Edge)
+	{
+		PendingNodes.Add(EdgeTargets[Nodes[0].FirstEdge + Edge]);
+	}
+
+	for (int32 PendingIndex = 0; PendingIndex < PendingNodes.Num(); ++PendingIndex)
+	{
+		const int32 Node = PendingNodes[PendingIndex];
+
+		for (int32 Edge = Nodes[Node].FirstEdge; Edge < Nodes[Node].FirstEdge + Nodes[Node].NumEdges; ++Edge)
+		{
+			const TCHAR Character = EdgeCharacters[Edge];
+			const int32 Child = EdgeTargets[Edge];
+
+			int32 Fail = Nodes[Node].Fail;
+			int32 FailTransition = FindTransition(Fail, Character);
+			while (FailTransition == INDEX_NONE && Fail != 0)
+			{
+				Fail = Nodes[Fail].Fail;
+				FailTransition = FindTransition(Fail, Character);
+			}
+
+			Nodes[Child].Fail = FailTransition != INDEX_NONE ? FailTransition : 0;
+
+			const FAzSpeechMatcherNode& FailNode = Nodes[Nodes[Child].Fail];
+			Nodes[Child].DictionaryLink = FailNode.Pattern != INDEX_NONE ? Nodes[Child].Fail : FailNode.DictionaryLink;
+
+			PendingNodes.Add(Child);
+		}
+	}
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Compiled %d recognition map groups: %d keys, %d nodes"), *FString(__FUNCTION__), Groups.Num(),
+	       Patterns.Num(), Nodes.Num());
+}
+
+const int32 FAzSpeechRecognitionMatcher::Match(const FString& InString, const bool bStopAtFirstTrigger, uint32& OutMatchPoints) const
+{
+	int32 Output = -1;
+	OutMatchPoints = 0u;
+
+	MatchGroups(InString, bStopAtFirstTrigger, [&Output, &OutMatchPoints](const int32 GroupIndex, const int32 Value, const uint32 MatchPoints)
+	{
+		if (GroupIndex == 0)
+		{
+			Output = Value;
+			OutMatchPoints = MatchPoints;
+		}
+	});
+
+	return Output;
+}
+
+void FAzSpeechRecognitionMatcher::MatchAllGroups(const FString& InString, const bool bStopAtFirstTrigger,
+                                                 TArray<FAzSpeechRecognitionMatch>& OutMatches) const
+{
+	OutMatches.SetNum(Groups.Num(), false);
+
+	MatchGroups(InString, bStopAtFirstTrigger, [this, &OutMatches](const int32 GroupIndex, const int32 Value, const uint32 MatchPoints)
+	{
+		FAzSpeechRecognitionMatch& GroupMatch = OutMatches[GroupIndex];
+		GroupMatch.GroupName = Groups[GroupIndex].GroupName;
+		GroupMatch.Value = Value;
+		GroupMatch.MatchPoints = static_cast<int32>(MatchPoints);
+	});
+}
+
+void FAzSpeechRecognitionMatcher::MatchGroups(const FString& InString, const bool bStopAtFirstTrigger,
+                                              const TFunctionRef<void(int32, int32, uint32)> Function) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_MatchRecognitionMap);
+
+	const int32 StringLength = InString.Len();
+	const TCHAR* const StringData = *InString;
+
+	// Recognized strings contain a few keys: The inline buffers avoid allocations in the usual case
+	TArray<int32, TInlineAllocator<32>> MatchedPatterns;
+
+	int32 State = 0;
+	for (int32 Index = 0; Index < StringLength; ++Index)
+	{
+		const TCHAR Character = FChar::ToLower(StringData[Index]);
+
+		int32 Transition = FindTransition(State, Character);
+		while (Transition == INDEX_NONE && State != 0)
+		{
+			State = Nodes[State].Fail;
+			Transition = FindTransition(State, Character);
+		}
+
+		State = Transition != INDEX_NONE ? Transition : 0;
+
+		for (int32 Output = Nodes[State].Pattern != INDEX_NONE ? State : Nodes[State].DictionaryLink; Output != INDEX_NONE; Output = Nodes[Output].
+		     DictionaryLink)
+		{
+			const int32 Pattern = Nodes[Output].Pattern;
+			if (MatchedPatterns.Contains(Pattern))
+			{
+				continue;
+			}
+
+			// Only keys at word boundaries are valid
+			const int32 Start = Index + 1 - Patterns[Pattern].Length;
+			const int32 End = Index + 1;
+
+			if ((Start == 0 || IsDelimiter(StringData[Start - 1])) && (End == StringLength || IsDelimiter(StringData[End])))
+			{
+				MatchedPatterns.Add(Pattern);
+			}
+		}
+	}
+
+	// Sorted by group and data: Group keys come first (without data), followed by the keys of each recognition data in the original order
+	TArray<FAzSpeechKeyUsage, TInlineAllocator<64>> MatchedUsages;
+	for (const int32 Pattern : MatchedPatterns)
+	{
+		MatchedUsages.Append(Usages.GetData() + Patterns[Pattern].FirstUsage, Patterns[Pattern].NumUsages);
+	}
+
+	MatchedUsages.Sort([](const FAzSpeechKeyUsage& Lhs, const FAzSpeechKeyUsage& Rhs)
+	{
+		return Lhs.GroupIndex != Rhs.GroupIndex ? Lhs.GroupIndex < Rhs.GroupIndex : Lhs.DataIndex < Rhs.DataIndex;
+	});
+
+	int32 Cursor = 0;
+	for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); ++GroupIndex)
+	{
+		bool bContainsRequirement = !Groups[GroupIndex].bHasRequirementKeys;
+		bool bContainsGlobalIgnore = false;
+		bool bFoundFirstTrigger = false;
+
+		int32 Output = -1;
+		uint32 OutputMatchPoints = 0u;
+
+		while (MatchedUsages.IsValidIndex(Cursor) && MatchedUsages[Cursor].GroupIndex == GroupIndex)
+		{
+			const int32 DataIndex = MatchedUsages[Cursor].DataIndex;
+			if (DataIndex == INDEX_NONE)
+			{
+				bContainsRequirement |= MatchedUsages[Cursor].Type == EAzSpeechKeyType::Requirement;
+				bContainsGlobalIgnore |= MatchedUsages[Cursor].Type == EAzSpeechKeyType::GlobalIgnore;
+				++Cursor;
+				continue;
+			}
+
+			bool bIgnore = false;
+			uint32 NumTriggers = 0u;
+
+			for (; MatchedUsages.IsValidIndex(Cursor) && MatchedUsages[Cursor].GroupIndex == GroupIndex && MatchedUsages[Cursor].DataIndex == DataIndex; ++
+			     Cursor)
+			{
+				bIgnore |= MatchedUsages[Cursor].Type == EAzSpeechKeyType::Ignore;
+				NumTriggers += MatchedUsages[Cursor].Type == EAzSpeechKeyType::Trigger ? 1u : 0u;
+			}
+
+			if (bIgnore || NumTriggers == 0u || bFoundFirstTrigger)
+			{
+				continue;
+			}
+
+			const FAzSpeechMatcherEntry& Entry = Entries[DataIndex];
+
+			if (bStopAtFirstTrigger)
+			{
+				bFoundFirstTrigger = true;
+				Output = Entry.Value;
+				OutputMatchPoints = static_cast<uint32>(Entry.Weight);
+				continue;
+			}
+
+			// Each trigger key contained in the string adds the weight of the recognition data
+			const uint32 EntryMatchPoints = NumTriggers * static_cast<uint32>(Entry.Weight);
+			if (EntryMatchPoints > OutputMatchPoints)
+			{
+				OutputMatchPoints = EntryMatchPoints;
+				Output = Entry.Value;
+			}
+		}
+
+		if (!bContainsRequirement || bContainsGlobalIgnore)
+		{
+			Function(GroupIndex, -1, 0u);
+		}
+		else
+		{
+			Function(GroupIndex, Output, OutputMatchPoints);
+		}
+	}
+}
+
+const FName FAzSpeechRecognitionMatcher::GetGroupName(const int32 GroupIndex) const
+{
+	return Groups.IsValidIndex(GroupIndex) ? Groups[GroupIndex].GroupName : NAME_None;
+}
+
+const int32 FAzSpeechRecognitionMatcher::GetNumGroups() const
+{
+	return Groups.Num();
+}
+const int32 FAzSpeechRecognitionMatcher::GetNumKeys() const
+{
+	return Usages.Num();
+}
+
+const SIZE_T FAzSpeechRecognitionMatcher::GetAllocatedSize() const
+{
+	return sizeof(FAzSpeechRecognitionMatcher) + Nodes.GetAllocatedSize() + EdgeCharacters.GetAllocatedSize() + EdgeTargets.GetAllocatedSize() +
+		Patterns.GetAllocatedSize() + Usages.GetAllocatedSize() + Entries.GetAllocatedSize() + Groups.GetAllocatedSize() + OtherDelimiters.GetAllocatedSize();
+}
+
+TSharedPtr<const FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe> FAzSpeechRecognitionMatcher::GetCompiledGroup(const FName& InGroupName)
+{
+	if (AzSpeech::Internal::HasEmptyParam(InGroupName))
+	{
+		return nullptr;
+	}
+
+	uint32 Generation = 0;
+	{
+		FScopeLock Lock(&AzSpeechRecognitionMatcher::CompiledGroupsMutex);
+
+		if (const TSharedPtr<const FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe>* const CompiledGroup = AzSpeechRecognitionMatcher::CompiledGroups.
+			Find(InGroupName))
+		{
+			return *CompiledGroup;
+		}
+
+		Generation = AzSpeechRecognitionMatcher::CompiledGroupsGeneration;
+	}
+
+	const UAzSpeechSettings* const Settings = UAzSpeechSettings::Get();
+	const std::shared_ptr<const FAzSpeechMapGroupIndex> GroupIndex = FAzSpeechMapGroupIndex::Get();
+	if (!Settings || !GroupIndex)
+	{
+		return nullptr;
+	}
+
+	const FAzSpeechRecognitionMap* const RecognitionMap = GroupIndex->FindRecognitionMap(InGroupName);
+	if (!RecognitionMap)
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Recognition map group %s not found or empty"), *FString(__FUNCTION__), *InGroupName.ToString());
+		return nullptr;
+	}
+
+	// Compiled without holding the mutex: Large maps would block the other matchers until the compilation finishes
+	TSharedPtr<const FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe> NewGroup = MakeShared<FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe>(
+		*RecognitionMap, Settings->StringDelimiters.ToString());
+
+	FScopeLock Lock(&AzSpeechRecognitionMatcher::CompiledGroupsMutex);
+
+	// Another thread may have compiled the same group in the meantime: Every caller uses the stored one
+	if (const TSharedPtr<const FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe>* const CompiledGroup = AzSpeechRecognitionMatcher::CompiledGroups.
+		Find(InGroupName))
+	{
+		return *CompiledGroup;
+	}
+
+	if (Generation == AzSpeechRecognitionMatcher::CompiledGroupsGeneration)
+	{
+		AzSpeechRecognitionMatcher::CompiledGroups.Add(InGroupName, NewGroup);
+	}
+
+	return NewGroup;
+}
+
+TSharedPtr<const FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe> FAzSpeechRecognitionMatcher::GetCompiledMap()
+{
+	uint32 Generation = 0;
+	{
+		FScopeLock Lock(&AzSpeechRecognitionMatcher::CompiledGroupsMutex);
+
+		if (AzSpeechRecognitionMatcher::CompiledMap.IsValid())
+		{
+			return AzSpeechRecognitionMatcher::CompiledMap;
+		}
+
+		Generation = AzSpeechRecognitionMatcher::CompiledGroupsGeneration;
+	}
+
+	const UAzSpeechSettings* const Settings = UAzSpeechSettings::Get();
+	const std::shared_ptr<const FAzSpeechMapGroupIndex> GroupIndex = FAzSpeechMapGroupIndex::Get();
+	if (!Settings || !GroupIndex)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<const FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe> NewMap = MakeShared<FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe>(
+		GroupIndex->GetRecognitionMaps(), Settings->StringDelimiters.ToString());
+
+	FScopeLock Lock(&AzSpeechRecognitionMatcher::CompiledGroupsMutex);
+
+	if (AzSpeechRecognitionMatcher::CompiledMap.IsValid())
+	{
+		return AzSpeechRecognitionMatcher::CompiledMap;
+	}
+
+	if (Generation == AzSpeechRecognitionMatcher::CompiledGroupsGeneration)
+	{
+		AzSpeechRecognitionMatcher::CompiledMap = NewMap;
+	}
+
+	return NewMap;
+}
+
+void FAzSpeechRecognitionMatcher::InvalidateCompiledGroups()
+{
+	FScopeLock Lock(&AzSpeechRecognitionMatcher::CompiledGroupsMutex);
+
+	AzSpeechRecognitionMatcher::CompiledGroups.Empty();
+	AzSpeechRecognitionMatcher::CompiledMap.Reset();
+	++AzSpeechRecognitionMatcher::CompiledGroupsGeneration;
+}
+
+const int32 FAzSpeechRecognitionMatcher::FindTransition(const int32 Node, const TCHAR Character) const
+{
+	const FAzSpeechMatcherNode& NodeData = Nodes[Node];
+	if (NodeData.NumEdges == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Edge = Algo::BinarySearch(TArrayView<const TCHAR>(EdgeCharacters.GetData() + NodeData.FirstEdge, NodeData.NumEdges), Character);
+	return Edge != INDEX_NONE ? EdgeTargets[NodeData.FirstEdge + Edge] : INDEX_NONE;
+}
+
+const bool FAzSpeechRecognitionMatcher::IsDelimiter(const TCHAR Character) const
+{
+	if (static_cast<uint32>(Character) < 128u)
+	{
+		return (AsciiDelimiters[Character >> 6] & 1ull << (Character & 63)) != 0u;
+	}
+
+	return Algo::BinarySearch(OtherDelimiters, Character) != INDEX_NONE;
+}
@@ -3,6 +3,8 @@
 // Repo: https://github.com/lucoiso/UEAzSpeech
 
 #include "AzSpeech/AzSpeechSettings.h"
+#include "AzSpeech/AzSpeechRecognitionMatcher.h"
+#include "AzSpeech/AzSpeechMapGroupIndex.h"
 #include "AzSpeechInternalFuncs.h"
 #include "LogAzSpeech.h"
 #include <Runtime/Launch/Resources/Version.h>
@@ -17,8 +19,12 @@
 
 UAzSpeechSettings::UAzSpeechSettings(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer), TaskInitTimeOut(15.f), TasksThreadPriority(EAzSpeechThreadPriority::Normal), ThreadUpdateInterval(0.016667f),
-	  bFilterVisemeFacialExpression(true), bEnableSDKLogs(true), bEnableInternalLogs(false), bEnableDebuggingLogs(false),
-	  bEnableDebuggingPrints(false), StringDelimiters(TEXT(R"( ,.;:[]{}!'"?)"))
+	  bUseStopEvent(true), bUseSharedThreadPool(true), ThreadPoolSize(4), bUseBatchedEventDispatch(true), EventDispatchFrameBudget(2.f),
+	  bEnableSynthesizerPool(false), SynthesizerPoolSize(8), SynthesizerPoolIdleTimeout(120.f), bPreConnectPooledSynthesizers(false),
+	  bEnableSynthesisCache(false), SynthesisCacheMemoryBudget(64), bEnableSynthesisDiskCache(false), SynthesisDiskCacheSize(512),
+	  VoiceCatalogTimeToLive(24.f), bEnableVoiceCatalogDiskCache(true), bFilterVisemeFacialExpression(true), bBatchVisemeEvents(true),
+	  bEnableSDKLogs(true), bEnableInternalLogs(false), bEnableDebuggingLogs(false), bEnableDebuggingPrints(false),
+	  StringDelimiters(TEXT(R"( ,.;:[]{}!'"?)"))
 {
 	CategoryName = TEXT("Plugins");
 
@@ -79,6 +85,9 @@ void UAzSpeechSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyCh
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
+	// The indexed and compiled groups depend on the maps and on the string delimiters
+	UpdateMapGroups();
+
 	if (PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(FAzSpeechRecognitionOptions, CandidateLanguages) || PropertyChangedEvent.
 		Property->GetFName() == GET_MEMBER_NAME_CHECKED(FAzSpeechRecognitionOptions, Locale))
 	{
@@ -120,6 +129,8 @@ void UAzSpeechSettings::PostInitProperties()
 	ValidateEndpoint();
 
 	ToggleInternalLogs();
+
+	UpdateMapGroups();
 }
 
 void UAzSpeechSettings::SetToDefaults()
@@ -136,6 +147,7 @@ void UAzSpeechSettings::SetToDefaults()
 	DefaultOptions.SynthesisOptions.bUseLanguageIdentification = false;
 	DefaultOptions.SynthesisOptions.ProfanityFilter = EAzSpeechProfanityFilter::Raw;
 	DefaultOptions.SynthesisOptions.LanguageIdentificationMode = EAzSpeechLanguageIdentificationMode::AtStart;
+	DefaultOptions.SynthesisOptions.bEnableStreamingPlayback = false;
 
 	DefaultOptions.RecognitionOptions.Locale = NAME_None;
 	DefaultOptions.RecognitionOptions.SpeechRecognitionOutputFormat = EAzSpeechRecognitionOutputFormat::Detailed;
@@ -144,6 +156,10 @@ void UAzSpeechSettings::SetToDefaults()
 	DefaultOptions.RecognitionOptions.LanguageIdentificationMode = EAzSpeechLanguageIdentificationMode::AtStart;
 	DefaultOptions.RecognitionOptions.SegmentationSilenceTimeoutMs = 1000;
 	DefaultOptions.RecognitionOptions.InitialSilenceTimeoutMs = 5000;
+	DefaultOptions.RecognitionOptions.AudioInputMode = EAzSpeechAudioInputMode::SDKMicrophone;
+	DefaultOptions.RecognitionOptions.bEnableVoiceActivityDetection = true;
+	DefaultOptions.RecognitionOptions.VoiceActivityThresholdDb = -45.f;
+	DefaultOptions.RecognitionOptions.VoiceActivityHangoverMs = 300;
 
 	if (AzSpeech::Internal::HasEmptyParam(DefaultOptions.RecognitionOptions.CandidateLanguages))
 	{
@@ -164,6 +180,8 @@ void UAzSpeechSettings::SaveAndReload(const FName& PropertyName)
 #endif
 
 	ReloadConfig(GetClass(), *GetDefaultConfigFilename(), PropagationFlags, GetClass()->FindPropertyByName(PropertyName));
+
+	UpdateMapGroups();
 }
 
 void UAzSpeechSettings::ValidateCandidateLanguages(const bool bRemoveEmpties)
@@ -227,6 +245,18 @@ void UAzSpeechSettings::ValidateRecognitionMap()
 	}
 }
 
+void UAzSpeechSettings::UpdateMapGroups() const
+{
+	// Only the default object holds the settings used by the tasks
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		return;
+	}
+
+	FAzSpeechMapGroupIndex::Rebuild(*this);
+	FAzSpeechRecognitionMatcher::InvalidateCompiledGroups();
+}
+
 void UAzSpeechSettings::ValidatePhraseList()
 {
 	for (const FAzSpeechPhraseListMap& PhraseListData : PhraseListMap)
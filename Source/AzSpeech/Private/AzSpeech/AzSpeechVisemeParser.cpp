@@ -0,0 +1,556 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/AzSpeechVisemeParser.h"
+#include "LogAzSpeech.h"
+#include <type_traits>
+
+// SSE2 is available on every x86 target: The other platforms use the scalar delimiter scan
+#define AZSPEECH_VISEME_PARSER_SSE2 (PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY)
+
+#if AZSPEECH_VISEME_PARSER_SSE2
+#include <emmintrin.h>
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("Parse Viseme Animation"), STAT_AzSpeech_ParseVisemeAnimation, STATGROUP_AzSpeech);
+
+namespace AzSpeechVisemeParser
+{
+	constexpr double PowersOfTen[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	constexpr int32 MaxPowerOfTen = UE_ARRAY_COUNT(PowersOfTen) - 1;
+
+	// Enough to represent any uint64 without overflow
+	constexpr int32 MaxSignificantDigits = 19;
+
+	// Longest weight read by the fast path, delimiter included: Longer or unusual values (e.g. exponents) fall back to the generic number reader
+	constexpr int32 MaxFastValueLength = 16;
+
+	// Any integer with up to 15 digits is exact as a double
+	constexpr int32 MaxExactDigits = 15;
+
+	// Converts up to 8 digits at once in a 64-bit word, left padded with zeros: Returns false if any character isn't a digit
+	const bool ParseDigits(const ANSICHAR* const Digits, const int32 NumDigits, uint64& OutValue)
+	{
+		if (NumDigits == 0)
+		{
+			OutValue = 0u;
+			return true;
+		}
+
+		ANSICHAR Buffer[8] = { '0', '0', '0', '0', '0', '0', '0', '0' };
+		FMemory::Memcpy(Buffer + 8 - NumDigits, Digits, NumDigits);
+
+		uint64 Word = 0u;
+		FMemory::Memcpy(&Word, Buffer, sizeof(Word));
+
+		// Digits are 0x30 to 0x39: The high nibble must be 3 and adding 6 to the low nibble must not carry
+		if (((Word & 0xF0F0F0F0F0F0F0F0ull) | (((Word + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) != 0x3333333333333333ull)
+		{
+			return false;
+		}
+
+		// Combines the digits in pairs, then in groups of 4 and 8: The first character is the most significant digit (little endian)
+		Word -= 0x3030303030303030ull;
+		Word = Word * 10u + (Word >> 8);
+		Word = ((Word & 0x000000FF000000FFull) * (100u + (1000000ull << 32)) + ((Word >> 16) & 0x000000FF000000FFull) * (1u + (10000ull << 32))) >> 32;
+
+		OutValue = Word & 0xFFFFFFFFull;
+
+		return true;
+	}
+
+	/* Single pass reader over the animation string: No allocation besides the output buffer */
+	template <typename CharType>
+	class TAnimationReader
+	{
+	public:
+		TAnimationReader(const CharType* const InData, const int32 InNum) : Current(InData), End(InData + InNum)
+		{
+		}
+
+		const bool Parse(FAzSpeechVisemeAnimationInfo& OutInfo, int32& InOutNumBlendShapes, TArray<float>& OutBlendShapes)
+		{
+			if (!Consume('{'))
+			{
+				return false;
+			}
+
+			if (Consume('}'))
+			{
+				return true;
+			}
+
+			do
+			{
+				const CharType* Key = nullptr;
+				int32 KeyLength = 0;
+
+				if (!ReadString(Key, KeyLength) || !Consume(':'))
+				{
+					return false;
+				}
+
+				if (KeyEquals(Key, KeyLength, "FrameIndex"))
+				{
+					double Value = 0.0;
+					if (!ReadNumber(Value))
+					{
+						return false;
+					}
+
+					OutInfo.FrameIndex = static_cast<int32>(Value);
+				}
+				else if (KeyEquals(Key, KeyLength, "BlendShapes"))
+				{
+					if (!ReadBlendShapes(OutInfo, InOutNumBlendShapes, OutBlendShapes))
+					{
+						return false;
+					}
+				}
+				else if (!SkipValue(0))
+				{
+					return false;
+				}
+			}
+			while (Consume(','));
+
+			return Consume('}');
+		}
+
+	private:
+		const CharType* Current;
+		const CharType* End;
+
+		void SkipWhitespace()
+		{
+			while (Current < End && (*Current == ' ' || *Current == '\t' || *Current == '\n' || *Current == '\r'))
+			{
+				++Current;
+			}
+		}
+
+		const bool Consume(const CharType Expected)
+		{
+			SkipWhitespace();
+
+			if (Current < End && *Current == Expected)
+			{
+				++Current;
+				return true;
+			}
+
+			return false;
+		}
+
+		const bool ReadString(const CharType*& OutBegin, int32& OutLength)
+		{
+			if (!Consume('"'))
+			{
+				return false;
+			}
+
+			OutBegin = Current;
+
+			while (Current < End && *Current != '"')
+			{
+				// Escaped characters are kept as they are: The known keys don't have any
+				if (*Current == '\\')
+				{
+					++Current;
+				}
+
+				++Current;
+			}
+
+			if (Current >= End)
+			{
+				return false;
+			}
+
+			OutLength = static_cast<int32>(Current - OutBegin);
+			++Current;
+
+			return true;
+		}
+
+		static const bool KeyEquals(const CharType* const Key, const int32 KeyLength, const ANSICHAR* const Expected)
+		{
+			int32 Index = 0;
+			for (; Index < KeyLength && Expected[Index] != '\0'; ++Index)
+			{
+				if (Key[Index] != static_cast<CharType>(Expected[Index]))
+				{
+					return false;
+				}
+			}
+
+			return Index == KeyLength && Expected[Index] == '\0';
+		}
+
+		static const bool IsDigit(const CharType Character)
+		{
+			return Character >= '0' && Character <= '9';
+		}
+
+		// Most weights are plain decimals of a few characters, e.g. 0.021: UTF-8 data from the SDK reads them without the per digit loop
+		const bool ReadBlendShapeValue(double& OutValue)
+		{
+			if constexpr (std::is_same_v<CharType, ANSICHAR> && PLATFORM_LITTLE_ENDIAN)
+			{
+				SkipWhitespace();
+
+				if (const CharType* const ValueEnd = FindValueEnd(); ValueEnd && ReadPlainDecimal(ValueEnd, OutValue))
+				{
+					Current = ValueEnd;
+					return true;
+				}
+			}
+
+			return ReadNumber(OutValue);
+		}
+
+		// Position of the next ',' or ']' within the fast value length: Null if there's none
+		const CharType* FindValueEnd() const
+		{
+#if AZSPEECH_VISEME_PARSER_SSE2
+			if (End - Current >= MaxFastValueLength)
+			{
+				const __m128i Characters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Current));
+				const __m128i Delimiters = _mm_or_si128(_mm_cmpeq_epi8(Characters, _mm_set1_epi8(',')), _mm_cmpeq_epi8(Characters, _mm_set1_epi8(']')));
+
+				const uint32 Mask = static_cast<uint32>(_mm_movemask_epi8(Delimiters));
+				return Mask != 0u ? Current + FMath::CountTrailingZeros(Mask) : nullptr;
+			}
+#endif
+
+			for (const CharType* Iterator = Current; Iterator < End && Iterator - Current < MaxFastValueLength; ++Iterator)
+			{
+				if (*Iterator == ',' || *Iterator == ']')
+				{
+					return Iterator;
+				}
+			}
+
+			return nullptr;
+		}
+
+		// [-]digits[.digits] with up to 8 digits in each part: Same result of ReadNumber, which divides the same mantissa by the same power of ten
+		const bool ReadPlainDecimal(const CharType* const ValueEnd, double& OutValue) const
+		{
+			const CharType* Iterator = Current;
+
+			const bool bNegative = Iterator < ValueEnd && *Iterator == '-';
+			Iterator += bNegative ? 1 : 0;
+
+			const CharType* Dot = Iterator;
+			while (Dot < ValueEnd && *Dot != '.')
+			{
+				++Dot;
+			}
+
+			const int32 NumIntegerDigits = static_cast<int32>(Dot - Iterator);
+			const int32 NumFractionDigits = Dot < ValueEnd ? static_cast<int32>(ValueEnd - Dot - 1) : 0;
+
+			const bool bValidLength = NumIntegerDigits > 0 && NumIntegerDigits <= 8 && NumFractionDigits <= 8;
+
+			if (!bValidLength || NumIntegerDigits + NumFractionDigits > MaxExactDigits || (Dot < ValueEnd && NumFractionDigits == 0))
+			{
+				return false;
+			}
+
+			uint64 Integer = 0u;
+			uint64 Fraction = 0u;
+			if (!ParseDigits(Iterator, NumIntegerDigits, Integer) || !ParseDigits(Dot + 1, NumFractionDigits, Fraction))
+			{
+				return false;
+			}
+
+			// The mantissa is below 2^53, so it's exact as a double
+			const uint64 Mantissa = Integer * static_cast<uint64>(PowersOfTen[NumFractionDigits]) + Fraction;
+			const double Value = static_cast<double>(Mantissa) / PowersOfTen[NumFractionDigits];
+
+			OutValue = bNegative ? -Value : Value;
+
+			return true;
+		}
+
+		const bool ReadNumber(double& OutValue)
+		{
+			SkipWhitespace();
+
+			const CharType* const Begin = Current;
+
+			const bool bNegative = Current < End && *Current == '-';
+			if (bNegative || (Current < End && *Current == '+'))
+			{
+				++Current;
+			}
+
+			uint64 Mantissa = 0;
+			int32 NumSignificantDigits = 0;
+			int32 Exponent = 0;
+
+			// Digits beyond the uint64 precision only change the exponent
+			while (Current < End && IsDigit(*Current))
+			{
+				if (NumSignificantDigits < MaxSignificantDigits)
+				{
+					Mantissa = Mantissa * 10u + static_cast<uint64>(*Current - '0');
+					NumSignificantDigits += Mantissa > 0u ? 1 : 0;
+				}
+				else
+				{
+					++Exponent;
+				}
+
+				++Current;
+			}
+
+			if (Current < End && *Current == '.')
+			{
+				++Current;
+
+				while (Current < End && IsDigit(*Current))
+				{
+					if (NumSignificantDigits < MaxSignificantDigits)
+					{
+						Mantissa = Mantissa * 10u + static_cast<uint64>(*Current - '0');
+						NumSignificantDigits += Mantissa > 0u ? 1 : 0;
+						--Exponent;
+					}
+
+					++Current;
+				}
+			}
+
+			// A number needs at least one digit: "-", "." or "-." are not valid numbers
+			const int32 NumSignChars = bNegative || (Begin < End && *Begin == '+') ? 1 : 0;
+			if (Current - Begin - NumSignChars == 0 || (Current - Begin - NumSignChars == 1 && *(Current - 1) == '.'))
+			{
+				return false;
+			}
+
+			if (Current < End && (*Current == 'e' || *Current == 'E'))
+			{
+				++Current;
+
+				const bool bNegativeExponent = Current < End && *Current == '-';
+				if (bNegativeExponent || (Current < End && *Current == '+'))
+				{
+					++Current;
+				}
+
+				if (Current >= End || !IsDigit(*Current))
+				{
+					return false;
+				}
+
+				int32 ExplicitExponent = 0;
+				while (Current < End && IsDigit(*Current))
+				{
+					ExplicitExponent = FMath::Min(ExplicitExponent * 10 + static_cast<int32>(*Current - '0'), 9999);
+					++Current;
+				}
+
+				Exponent += bNegativeExponent ? -ExplicitExponent : ExplicitExponent;
+			}
+
+			double Value = static_cast<double>(Mantissa);
+
+			if (Mantissa != 0u && Exponent != 0)
+			{
+				if (Exponent >= -MaxPowerOfTen && Exponent <= MaxPowerOfTen)
+				{
+					Value = Exponent < 0 ? Value / PowersOfTen[-Exponent] : Value * PowersOfTen[Exponent];
+				}
+				else
+				{
+					Value *= FMath::Pow(10.0, static_cast<double>(Exponent));
+				}
+			}
+
+			OutValue = bNegative ? -Value : Value;
+
+			return true;
+		}
+
+		const bool ReadBlendShapes(FAzSpeechVisemeAnimationInfo& OutInfo, int32& InOutNumBlendShapes, TArray<float>& OutBlendShapes)
+		{
+			if (!Consume('['))
+			{
+				return false;
+			}
+
+			if (Consume(']'))
+			{
+				return true;
+			}
+
+			do
+			{
+				if (!Consume('['))
+				{
+					return false;
+				}
+
+				const int32 FrameStart = OutBlendShapes.Num();
+
+				if (!Consume(']'))
+				{
+					do
+					{
+						double Value = 0.0;
+						if (!ReadBlendShapeValue(Value))
+						{
+							return false;
+						}
+
+						// Values beyond the stride are dropped: Every frame must have the same size
+						if (InOutNumBlendShapes == 0 || OutBlendShapes.Num() - FrameStart < InOutNumBlendShapes)
+						{
+							OutBlendShapes.Add(static_cast<float>(Value));
+						}
+					}
+					while (Consume(','));
+
+					if (!Consume(']'))
+					{
+						return false;
+					}
+				}
+
+				if (InOutNumBlendShapes == 0)
+				{
+					// The first frame defines the stride: It can't be empty
+					InOutNumBlendShapes = OutBlendShapes.Num() - FrameStart;
+					if (InOutNumBlendShapes == 0)
+					{
+						return false;
+					}
+				}
+
+				OutBlendShapes.AddZeroed(InOutNumBlendShapes - (OutBlendShapes.Num() - FrameStart));
+				++OutInfo.NumFrames;
+			}
+			while (Consume(','));
+
+			return Consume(']');
+		}
+
+		const bool SkipValue(const int32 Depth)
+		{
+			// Unknown keys are not expected: Limit the nesting to avoid a stack overflow with malicious content
+			if (Depth > 32)
+			{
+				return false;
+			}
+
+			SkipWhitespace();
+
+			if (Current >= End)
+			{
+				return false;
+			}
+
+			if (*Current == '"')
+			{
+				const CharType* Unused = nullptr;
+				int32 UnusedLength = 0;
+				return ReadString(Unused, UnusedLength);
+			}
+
+			if (*Current == '{' || *Current == '[')
+			{
+				const CharType Closing = *Current == '{' ? '}' : ']';
+				++Current;
+
+				if (Consume(Closing))
+				{
+					return true;
+				}
+
+				do
+				{
+					if (Closing == '}')
+					{
+						const CharType* Unused = nullptr;
+						int32 UnusedLength = 0;
+						if (!ReadString(Unused, UnusedLength) || !Consume(':'))
+						{
+							return false;
+						}
+					}
+
+					if (!SkipValue(Depth + 1))
+					{
+						return false;
+					}
+				}
+				while (Consume(','));
+
+				return Consume(Closing);
+			}
+
+			// Literals: true, false and null
+			if (FChar::IsAlpha(static_cast<TCHAR>(*Current)))
+			{
+				while (Current < End && FChar::IsAlpha(static_cast<TCHAR>(*Current)))
+				{
+					++Current;
+				}
+
+				return true;
+			}
+
+			double Unused = 0.0;
+			return ReadNumber(Unused);
+		}
+	};
+
+	template <typename CharType>
+	const bool ParseAnimation(const CharType* const Data, const int32 Num, FAzSpeechVisemeAnimationInfo& OutInfo, int32& InOutNumBlendShapes,
+	                          TArray<float>& OutBlendShapes)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AzSpeech_ParseVisemeAnimation);
+
+		OutInfo = FAzSpeechVisemeAnimationInfo();
+
+		if (!Data || Num <= 0)
+		{
+			return false;
+		}
+
+		const int32 InitialNum = OutBlendShapes.Num();
+		const int32 InitialNumBlendShapes = InOutNumBlendShapes;
+
+		if (TAnimationReader<CharType>(Data, Num).Parse(OutInfo, InOutNumBlendShapes, OutBlendShapes))
+		{
+			return true;
+		}
+
+		// Don't keep partial frames: The caller indexes the buffer by frame
+		OutBlendShapes.SetNum(InitialNum, false);
+		InOutNumBlendShapes = InitialNumBlendShapes;
+		OutInfo = FAzSpeechVisemeAnimationInfo();
+
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Failed to parse the viseme animation data"), *FString(__FUNCTION__));
+
+		return false;
+	}
+}
+
+const bool FAzSpeechVisemeParser::ParseAnimation(const ANSICHAR* const Data, const int32 Num, FAzSpeechVisemeAnimationInfo& OutInfo,
+                                                 int32& InOutNumBlendShapes, TArray<float>& OutBlendShapes)
+{
+	return AzSpeechVisemeParser::ParseAnimation(Data, Num, OutInfo, InOutNumBlendShapes, OutBlendShapes);
+}
+
+const bool FAzSpeechVisemeParser::ParseAnimation(const TCHAR* const Data, const int32 Num, FAzSpeechVisemeAnimationInfo& OutInfo,
+                                                 int32& InOutNumBlendShapes, TArray<float>& OutBlendShapes)
+{
+	return AzSpeechVisemeParser::ParseAnimation(Data, Num, OutInfo, InOutNumBlendShapes, OutBlendShapes);
+}
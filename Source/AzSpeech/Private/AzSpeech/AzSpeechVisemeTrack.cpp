@@ -0,0 +1,295 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/AzSpeechVisemeTrack.h"
+#include "AzSpeech/AzSpeechVisemeParser.h"
+
+void FAzSpeechVisemeTrack::Add(const FAzSpeechVisemeData& VisemeData)
+{
+	Add_Internal(VisemeData.VisemeID, VisemeData.AudioOffsetMilliseconds, *VisemeData.Animation, VisemeData.Animation.Len());
+}
+
+void FAzSpeechVisemeTrack::Add(const int32 VisemeID, const int64 AudioOffsetMilliseconds, const ANSICHAR* const Animation, const int32 AnimationLength)
+{
+	Add_Internal(VisemeID, AudioOffsetMilliseconds, Animation, AnimationLength);
+}
+
+template <typename CharType>
+void FAzSpeechVisemeTrack::Add_Internal(const int32 VisemeID, const int64 AudioOffsetMilliseconds, const CharType* const Animation,
+                                        const int32 AnimationLength)
+{
+	FAzSpeechVisemeEntry& NewEntry = Entries.AddDefaulted_GetRef();
+	NewEntry.VisemeID = VisemeID;
+	NewEntry.AudioOffsetMilliseconds = AudioOffsetMilliseconds;
+	NewEntry.FirstBlendShapeIndex = BlendShapes.Num();
+
+	// Visemes without facial expression don't carry any animation
+	if (!Animation || AnimationLength <= 0)
+	{
+		return;
+	}
+
+	FAzSpeechVisemeAnimationInfo AnimationInfo;
+	FAzSpeechVisemeParser::ParseAnimation(Animation, AnimationLength, AnimationInfo, NumBlendShapes, BlendShapes);
+
+	NewEntry.FrameIndex = AnimationInfo.FrameIndex;
+	NewEntry.NumFrames = AnimationInfo.NumFrames;
+}
+
+void FAzSpeechVisemeTrack::Append(const FAzSpeechVisemeTrack& Other)
+{
+	if (Other.IsEmpty())
+	{
+		return;
+	}
+
+	if (NumBlendShapes == 0)
+	{
+		NumBlendShapes = Other.NumBlendShapes;
+	}
+
+	// Tracks with a different stride are appended frame by frame
+	const bool bSameStride = NumBlendShapes == Other.NumBlendShapes || Other.NumBlendShapes == 0;
+
+	Entries.Reserve(Entries.Num() + Other.Entries.Num());
+	for (int32 Index = 0; Index < Other.Num(); ++Index)
+	{
+		FAzSpeechVisemeEntry NewEntry = Other.Entries[Index];
+		NewEntry.FirstBlendShapeIndex = BlendShapes.Num();
+		Entries.Add(NewEntry);
+
+		if (bSameStride)
+		{
+			BlendShapes.Append(Other.GetBlendShapes(Index));
+			continue;
+		}
+
+		const TArrayView<const float> OtherBlendShapes = Other.GetBlendShapes(Index);
+		for (int32 FrameIndex = 0; FrameIndex < NewEntry.NumFrames; ++FrameIndex)
+		{
+			const int32 NumValues = FMath::Min(Other.NumBlendShapes, NumBlendShapes);
+			BlendShapes.Append(OtherBlendShapes.GetData() + FrameIndex * Other.NumBlendShapes, NumValues);
+			BlendShapes.AddZeroed(NumBlendShapes - NumValues);
+		}
+	}
+}
+
+void FAzSpeechVisemeTrack::Empty()
+{
+	Entries.Empty();
+	BlendShapes.Empty();
+	NumBlendShapes = 0;
+}
+
+const int32 FAzSpeechVisemeTrack::Num() const
+{
+	return Entries.Num();
+}
+
+const bool FAzSpeechVisemeTrack::IsEmpty() const
+{
+	return Entries.Num() == 0;
+}
+
+const int32 FAzSpeechVisemeTrack::GetVisemeID(const int32 Index) const
+{
+	return Entries.IsValidIndex(Index) ? Entries[Index].VisemeID : -1;
+}
+
+const int64 FAzSpeechVisemeTrack::GetAudioOffsetMilliseconds(const int32 Index) const
+{
+	return Entries.IsValidIndex(Index) ? Entries[Index].AudioOffsetMilliseconds : -1;
+}
+
+const int32 FAzSpeechVisemeTrack::GetFrameIndex(const int32 Index) const
+{
+	return Entries.IsValidIndex(Index) ? Entries[Index].FrameIndex : 0;
+}
+
+const int32 FAzSpeechVisemeTrack::GetNumBlendShapes() const
+{
+	return NumBlendShapes;
+}
+
+const int32 FAzSpeechVisemeTrack::GetNumFrames(const int32 Index) const
+{
+	return Entries.IsValidIndex(Index) ? Entries[Index].NumFrames : 0;
+}
+
+TArrayView<const float> FAzSpeechVisemeTrack::GetBlendShapes(const int32 Index) const
+{
+	if (!Entries.IsValidIndex(Index) || Entries[Index].NumFrames == 0)
+	{
+		return TArrayView<const float>();
+	}
+
+	return TArrayView<const float>(BlendShapes.GetData() + Entries[Index].FirstBlendShapeIndex, Entries[Index].NumFrames * NumBlendShapes);
+}
+
+const FAzSpeechVisemeData FAzSpeechVisemeTrack::GetVisemeData(const int32 Index) const
+{
+	if (!Entries.IsValidIndex(Index))
+	{
+		return FAzSpeechVisemeData();
+	}
+
+	const FAzSpeechVisemeEntry& Entry = Entries[Index];
+	FAzSpeechVisemeData Output(Entry.VisemeID, Entry.AudioOffsetMilliseconds, FString());
+
+	if (Entry.NumFrames == 0)
+	{
+		return Output;
+	}
+
+	// Same layout sent by the service: {"FrameIndex":0,"BlendShapes":[[...],[...]]}
+	const TArrayView<const float> EntryBlendShapes = GetBlendShapes(Index);
+	Output.Animation.Reserve(32 + EntryBlendShapes.Num() * 8);
+	Output.Animation += FString::Printf(TEXT("{\"FrameIndex\":%d,\"BlendShapes\":["), Entry.FrameIndex);
+
+	for (int32 FrameIndex = 0; FrameIndex < Entry.NumFrames; ++FrameIndex)
+	{
+		Output.Animation += FrameIndex == 0 ? TEXT("[") : TEXT(",[");
+
+		for (int32 ValueIndex = 0; ValueIndex < NumBlendShapes; ++ValueIndex)
+		{
+			if (ValueIndex > 0)
+			{
+				Output.Animation += TEXT(",");
+			}
+
+			Output.Animation += FString::SanitizeFloat(EntryBlendShapes[FrameIndex * NumBlendShapes + ValueIndex], 0);
+		}
+
+		Output.Animation += TEXT("]");
+	}
+
+	Output.Animation += TEXT("]}");
+
+	return Output;
+}
+
+const TArray<FAzSpeechVisemeData> FAzSpeechVisemeTrack::ToArray() const
+{
+	TArray<FAzSpeechVisemeData> Output;
+	Output.Reserve(Num());
+
+	for (int32 Index = 0; Index < Num(); ++Index)
+	{
+		Output.Add(GetVisemeData(Index));
+	}
+
+	return Output;
+}
+
+const FAzSpeechAnimationData FAzSpeechVisemeTrack::GetAnimationData(const int32 Index) const
+{
+	FAzSpeechAnimationData Output;
+	if (!Entries.IsValidIndex(Index))
+	{
+		return Output;
+	}
+
+	Output.FrameIndex = Entries[Index].FrameIndex;
+	Output.BlendShapes.Reserve(Entries[Index].NumFrames);
+
+	const TArrayView<const float> EntryBlendShapes = GetBlendShapes(Index);
+	for (int32 FrameIndex = 0; FrameIndex < Entries[Index].NumFrames; ++FrameIndex)
+	{
+		Output.BlendShapes.AddDefaulted_GetRef().Data.Append(EntryBlendShapes.GetData() + FrameIndex * NumBlendShapes, NumBlendShapes);
+	}
+
+	return Output;
+}
+
+const TArray<FAzSpeechAnimationData> FAzSpeechVisemeTrack::ToAnimationDataArray() const
+{
+	TArray<FAzSpeechAnimationData> Output;
+	Output.Reserve(Num());
+
+	for (int32 Index = 0; Index < Num(); ++Index)
+	{
+		Output.Add(GetAnimationData(Index));
+	}
+
+	return Output;
+}
+
+const int64 FAzSpeechVisemeTrack::GetAllocatedSize() const
+{
+	return Entries.GetAllocatedSize() + BlendShapes.GetAllocatedSize();
+}
+
+FArchive& operator<<(FArchive& Ar, FAzSpeechVisemeTrack& Track)
+{
+	// VisemeID, FrameIndex, AudioOffsetMilliseconds, FirstBlendShapeIndex, NumFrames
+	constexpr int64 EntrySize = sizeof(int32) * 4 + sizeof(int64);
+
+	// Counts read from the archive are only trusted if the remaining data can hold them: Nothing is allocated before this check
+	const auto CanRead = [&Ar](const int32 Count, const int64 ElementSize)
+	{
+		const int64 TotalSize = Ar.TotalSize();
+		return Count >= 0 && (TotalSize < 0 || Count <= (TotalSize - Ar.Tell()) / ElementSize);
+	};
+
+	const auto Reject = [&Ar, &Track]() -> FArchive&
+	{
+		Ar.SetError();
+		Track.Empty();
+
+		return Ar;
+	};
+
+	int32 NumEntries = Track.Entries.Num();
+	Ar << NumEntries << Track.NumBlendShapes;
+
+	if (Ar.IsLoading())
+	{
+		if (Ar.IsError() || Track.NumBlendShapes < 0 || !CanRead(NumEntries, EntrySize))
+		{
+			return Reject();
+		}
+
+		Track.Entries.SetNum(NumEntries);
+	}
+
+	for (FAzSpeechVisemeTrack::FAzSpeechVisemeEntry& Entry : Track.Entries)
+	{
+		Ar << Entry.VisemeID << Entry.FrameIndex << Entry.AudioOffsetMilliseconds << Entry.FirstBlendShapeIndex << Entry.NumFrames;
+	}
+
+	int32 NumBlendShapeValues = Track.BlendShapes.Num();
+	Ar << NumBlendShapeValues;
+
+	if (Ar.IsLoading())
+	{
+		if (Ar.IsError() || !CanRead(NumBlendShapeValues, sizeof(float)))
+		{
+			return Reject();
+		}
+
+		Track.BlendShapes.SetNumUninitialized(NumBlendShapeValues);
+	}
+
+	Ar.Serialize(Track.BlendShapes.GetData(), static_cast<int64>(Track.BlendShapes.Num()) * sizeof(float));
+
+	// Reject inconsistent data instead of reading out of the blend shape buffer later
+	if (Ar.IsLoading())
+	{
+		if (Ar.IsError())
+		{
+			return Reject();
+		}
+
+		for (const FAzSpeechVisemeTrack::FAzSpeechVisemeEntry& Entry : Track.Entries)
+		{
+			if (Entry.FirstBlendShapeIndex < 0 || Entry.NumFrames < 0 || static_cast<int64>(Entry.FirstBlendShapeIndex) + static_cast<int64>(Entry.NumFrames) *
+				Track.NumBlendShapes > Track.BlendShapes.Num())
+			{
+				return Reject();
+			}
+		}
+	}
+
+	return Ar;
+}
@@ -0,0 +1,222 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/AzSpeechVoiceActivityDetector.h"
+#include "LogAzSpeech.h"
+
+DECLARE_CYCLE_STAT(TEXT("Voice Activity Detection"), STAT_AzSpeech_VoiceActivityDetection, STATGROUP_AzSpeech);
+
+namespace AzSpeechVoiceActivity
+{
+	// Noise floor adaptation per unvoiced frame: Rises slowly and drops immediately
+	constexpr float NoiseFloorRiseRate = 0.05f;
+
+	// Frames this much louder than the threshold are voiced regardless of the zero crossing rate: 6 dB
+	constexpr float StrongEnergyRatio = 4.f;
+
+	constexpr float MinEnergy = 1e-10f;
+
+	float DecibelsToPower(const float Decibels)
+	{
+		return FMath::Pow(10.f, Decibels / 10.f);
+	}
+}
+
+FAzSpeechVoiceActivityDetector::FAzSpeechVoiceActivityDetector(const FAzSpeechVoiceActivitySettings& InSettings) : Settings(InSettings)
+{
+	const int32 FrameDurationMs = FMath::Max(Settings.FrameDurationMs, 1);
+
+	FrameSize = FMath::Max(Settings.SampleRate * FrameDurationMs / 1000, 4);
+	HangoverFrames = FMath::DivideAndRoundUp(FMath::Max(Settings.HangoverMs, 0), FrameDurationMs);
+	PreRollFrames = FMath::DivideAndRoundUp(FMath::Max(Settings.PreRollMs, 0), FrameDurationMs);
+
+	EnergyThreshold = AzSpeechVoiceActivity::DecibelsToPower(Settings.EnergyThresholdDb);
+	NoiseFloorMargin = AzSpeechVoiceActivity::DecibelsToPower(Settings.NoiseFloorMarginDb);
+
+	PendingSamples.Reserve(FrameSize);
+	PreRollBuffer.SetNumZeroed(PreRollFrames * FrameSize);
+
+	Reset();
+}
+
+void FAzSpeechVoiceActivityDetector::Process(const TArrayView<const float> Samples, const TFunctionRef<void(TArrayView<const float>)> OnForward)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_VoiceActivityDetection);
+
+	int32 Index = 0;
+
+	// Completes the frame left by the previous call
+	if (PendingSamples.Num() > 0)
+	{
+		const int32 NumCopied = FMath::Min(FrameSize - PendingSamples.Num(), Samples.Num());
+		PendingSamples.Append(Samples.GetData(), NumCopied);
+		Index = NumCopied;
+
+		if (PendingSamples.Num() < FrameSize)
+		{
+			return;
+		}
+
+		ProcessFrame(PendingSamples.GetData(), OnForward);
+		PendingSamples.Reset();
+	}
+
+	for (; Index + FrameSize <= Samples.Num(); Index += FrameSize)
+	{
+		ProcessFrame(Samples.GetData() + Index, OnForward);
+	}
+
+	PendingSamples.Append(Samples.GetData() + Index, Samples.Num() - Index);
+}
+
+const bool FAzSpeechVoiceActivityDetector::IsVoicedFrame(const TArrayView<const float> Frame)
+{
+	if (Frame.Num() <= 1)
+	{
+		return false;
+	}
+
+	const float Energy = GetFrameEnergy(Frame.GetData(), Frame.Num());
+	const float ZeroCrossingRate = static_cast<float>(GetZeroCrossings(Frame.GetData(), Frame.Num())) / static_cast<float>(Frame.Num() - 1);
+
+	const float Threshold = FMath::Max(EnergyThreshold, NoiseFloor * NoiseFloorMargin);
+
+	// Unvoiced fricatives have a high zero crossing rate too: Loud frames are kept regardless of it
+	const bool bVoiced = Energy > Threshold && (ZeroCrossingRate <= Settings.MaxZeroCrossingRate || Energy > Threshold *
+		AzSpeechVoiceActivity::StrongEnergyRatio);
+
+	if (!bVoiced)
+	{
+		NoiseFloor = Energy < NoiseFloor ? Energy : FMath::Lerp(NoiseFloor, Energy, AzSpeechVoiceActivity::NoiseFloorRiseRate);
+		NoiseFloor = FMath::Max(NoiseFloor, AzSpeechVoiceActivity::MinEnergy);
+	}
+
+	return bVoiced;
+}
+
+void FAzSpeechVoiceActivityDetector::Reset()
+{
+	PendingSamples.Reset();
+
+	PreRollHead = 0;
+	PreRollCount = 0;
+	RemainingHangoverFrames = 0;
+
+	NoiseFloor = EnergyThreshold;
+}
+
+const bool FAzSpeechVoiceActivityDetector::IsVoiceActive() const
+{
+	return RemainingHangoverFrames > 0;
+}
+
+const int32 FAzSpeechVoiceActivityDetector::GetFrameSize() const
+{
+	return FrameSize;
+}
+
+const int64 FAzSpeechVoiceActivityDetector::GetNumProcessedFrames() const
+{
+	return NumProcessedFrames;
+}
+
+const int64 FAzSpeechVoiceActivityDetector::GetNumForwardedFrames() const
+{
+	return NumForwardedFrames;
+}
+
+const float FAzSpeechVoiceActivityDetector::GetFrameEnergy(const float* const Samples, const int32 NumSamples)
+{
+	if (NumSamples <= 0)
+	{
+		return 0.f;
+	}
+
+	const int32 NumVectorized = NumSamples & ~3;
+
+	VectorRegister Sum = VectorZero();
+	for (int32 Index = 0; Index < NumVectorized; Index += 4)
+	{
+		const VectorRegister Value = VectorLoad(Samples + Index);
+		Sum = VectorMultiplyAdd(Value, Value, Sum);
+	}
+
+	alignas(16) float Lanes[4];
+	VectorStoreAligned(Sum, Lanes);
+
+	float Output = Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+	for (int32 Index = NumVectorized; Index < NumSamples; ++Index)
+	{
+		Output += Samples[Index] * Samples[Index];
+	}
+
+	return Output / static_cast<float>(NumSamples);
+}
+
+const int32 FAzSpeechVoiceActivityDetector::GetZeroCrossings(const float* const Samples, const int32 NumSamples)
+{
+	if (NumSamples <= 1)
+	{
+		return 0;
+	}
+
+	// Compares each sample with the previous one: The product of consecutive samples is negative on a crossing
+	const int32 NumPairs = NumSamples - 1;
+	const int32 NumVectorized = NumPairs & ~3;
+	const VectorRegister Zero = VectorZero();
+
+	int32 Output = 0;
+	for (int32 Index = 0; Index < NumVectorized; Index += 4)
+	{
+		const VectorRegister Previous = VectorLoad(Samples + Index);
+		const VectorRegister Current = VectorLoad(Samples + Index + 1);
+
+		Output += FMath::CountBits(static_cast<uint64>(VectorMaskBits(VectorCompareLT(VectorMultiply(Previous, Current), Zero))));
+	}
+
+	for (int32 Index = NumVectorized; Index < NumPairs; ++Index)
+	{
+		Output += Samples[Index] * Samples[Index + 1] < 0.f ? 1 : 0;
+	}
+
+	return Output;
+}
+
+void FAzSpeechVoiceActivityDetector::ProcessFrame(const float* const Frame, const TFunctionRef<void(TArrayView<const float>)> OnForward)
+{
+	++NumProcessedFrames;
+
+	if (IsVoicedFrame(MakeArrayView(Frame, FrameSize)))
+	{
+		// Speech onset: The pre-roll is forwarded first, from the oldest frame
+		for (int32 PreRollIndex = 0; PreRollIndex < PreRollCount; ++PreRollIndex)
+		{
+			const int32 RingIndex = (PreRollHead + PreRollFrames - PreRollCount + PreRollIndex) % PreRollFrames;
+			OnForward(MakeArrayView(PreRollBuffer.GetData() + RingIndex * FrameSize, FrameSize));
+		}
+
+		NumForwardedFrames += PreRollCount;
+		PreRollCount = 0;
+
+		RemainingHangoverFrames = HangoverFrames + 1;
+	}
+
+	if (RemainingHangoverFrames > 0)
+	{
+		--RemainingHangoverFrames;
+
+		OnForward(MakeArrayView(Frame, FrameSize));
+		++NumForwardedFrames;
+
+		return;
+	}
+
+	if (PreRollFrames > 0)
+	{
+		FMemory::Memcpy(PreRollBuffer.GetData() + PreRollHead * FrameSize, Frame, FrameSize * sizeof(float));
+
+		PreRollHead = (PreRollHead + 1) % PreRollFrames;
+		PreRollCount = FMath::Min(PreRollCount + 1, PreRollFrames);
+	}
+}
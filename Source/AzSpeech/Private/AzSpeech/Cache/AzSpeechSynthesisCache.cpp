@@ -0,0 +1,128 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/Cache/AzSpeechSynthesisCache.h"
+#include "LogAzSpeech.h"
+#include <Hash/CityHash.h>
+#include <Misc/ScopeLock.h>
+
+const int64 FAzSpeechCachedSynthesis::GetAllocatedSize() const
+{
+	return sizeof(FAzSpeechCachedSynthesis) + AudioData.Num() + VisemeTrack.GetAllocatedSize();
+}
+
+FAzSpeechSynthesisCache::FAzSpeechSynthesisCache(const int64 InBudgetBytes) : BudgetBytes(FMath::Max<int64>(0, InBudgetBytes))
+{
+}
+
+const uint64 FAzSpeechSynthesisCache::MakeKey(const FString& SynthesisText, const bool bIsSSMLBased, const FAzSpeechSynthesisOptions& SynthesisOptions)
+{
+	return MakeKey(MakeKeyContent(SynthesisText, bIsSSMLBased, SynthesisOptions));
+}
+
+const uint64 FAzSpeechSynthesisCache::MakeKey(const FString& KeyContent)
+{
+	const FTCHARToUTF8 KeyContentUTF8(*KeyContent);
+
+	return CityHash64(KeyContentUTF8.Get(), KeyContentUTF8.Length());
+}
+
+const FString FAzSpeechSynthesisCache::MakeKeyContent(const FString& SynthesisText, const bool bIsSSMLBased,
+                                                      const FAzSpeechSynthesisOptions& SynthesisOptions)
+{
+	// Only the fields that change the audio or the viseme data are part of the key: The subscription doesn't affect the result
+	return FString::Printf(TEXT("%s|%d|%s|%s|%d|%d|%d|%d|%d"), *SynthesisText, bIsSSMLBased ? 1 : 0, *SynthesisOptions.Locale.ToString(),
+	                       *SynthesisOptions.Voice.ToString(), static_cast<int32>(SynthesisOptions.SpeechSynthesisOutputFormat),
+	                       SynthesisOptions.bEnableViseme ? 1 : 0, SynthesisOptions.bUseLanguageIdentification ? 1 : 0,
+	                       static_cast<int32>(SynthesisOptions.LanguageIdentificationMode), static_cast<int32>(SynthesisOptions.ProfanityFilter));
+}
+
+TSharedPtr<const FAzSpeechCachedSynthesis, ESPMode::ThreadSafe> FAzSpeechSynthesisCache::Find(const uint64 Key)
+{
+	FScopeLock Lock(&Mutex);
+
+	FAzSpeechSynthesisCacheEntry* const Entry = Entries.Find(Key);
+	if (!Entry)
+	{
+		++NumMisses;
+		return nullptr;
+	}
+
+	++NumHits;
+
+	LruList.RemoveNode(Entry->LruNode, false);
+	LruList.AddHead(Entry->LruNode);
+
+	return Entry->Value;
+}
+
+void FAzSpeechSynthesisCache::Add(const uint64 Key, const TSharedRef<const FAzSpeechCachedSynthesis, ESPMode::ThreadSafe>& Value)
+{
+	const int64 AllocatedSize = Value->GetAllocatedSize();
+
+	FScopeLock Lock(&Mutex);
+
+	if (AllocatedSize > BudgetBytes)
+	{
+		UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Result with %lld bytes exceeds the cache budget."), *FString(__FUNCTION__), AllocatedSize);
+		return;
+	}
+
+	Remove_Internal(Key);
+
+	while (UsedBytes + AllocatedSize > BudgetBytes && LruList.GetTail())
+	{
+		Remove_Internal(LruList.GetTail()->GetValue());
+		++NumEvictions;
+	}
+
+	LruList.AddHead(Key);
+
+	FAzSpeechSynthesisCacheEntry& NewEntry = Entries.Add(Key);
+	NewEntry.Value = Value;
+	NewEntry.LruNode = LruList.GetHead();
+	NewEntry.AllocatedSize = AllocatedSize;
+
+	UsedBytes += AllocatedSize;
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Synthesis result cached. Entries: %d; Used bytes: %lld"), *FString(__FUNCTION__), Entries.Num(),
+	       UsedBytes);
+}
+
+void FAzSpeechSynthesisCache::Empty()
+{
+	FScopeLock Lock(&Mutex);
+
+	Entries.Empty();
+	LruList.Empty();
+	UsedBytes = 0;
+}
+
+const FAzSpeechSynthesisCacheStats FAzSpeechSynthesisCache::GetStats() const
+{
+	FScopeLock Lock(&Mutex);
+
+	FAzSpeechSynthesisCacheStats Output;
+	Output.NumEntries = Entries.Num();
+	Output.UsedBytes = UsedBytes;
+	Output.BudgetBytes = BudgetBytes;
+	Output.NumHits = NumHits;
+	Output.NumMisses = NumMisses;
+	Output.NumEvictions = NumEvictions;
+	Output.HitRate = NumHits + NumMisses > 0 ? static_cast<float>(NumHits) / static_cast<float>(NumHits + NumMisses) : 0.f;
+
+	return Output;
+}
+
+void FAzSpeechSynthesisCache::Remove_Internal(const uint64 Key)
+{
+	FAzSpeechSynthesisCacheEntry Entry;
+	if (!Entries.RemoveAndCopyValue(Key, Entry))
+	{
+		return;
+	}
+
+	LruList.RemoveNode(Entry.LruNode);
+	UsedBytes -= Entry.AllocatedSize;
+}
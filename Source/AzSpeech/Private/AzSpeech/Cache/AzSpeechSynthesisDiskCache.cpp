@@ -0,0 +1,611 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/Cache/AzSpeechSynthesisDiskCache.h"
+#include "AzSpeech/AzSpeechHelper.h"
+#include "LogAzSpeech.h"
+#include <Async/Async.h>
+#include <Async/MappedFileHandle.h>
+#include <HAL/FileManager.h>
+#include <HAL/PlatformFileManager.h>
+#include <Misc/FileHelper.h>
+#include <Misc/ScopeLock.h>
+#include <Serialization/MemoryReader.h>
+#include <Serialization/MemoryWriter.h>
+
+DECLARE_CYCLE_STAT(TEXT("AzSpeech Disk Cache Find"), STAT_AzSpeech_DiskCacheFind, STATGROUP_AzSpeech);
+DECLARE_CYCLE_STAT(TEXT("AzSpeech Disk Cache Add"), STAT_AzSpeech_DiskCacheAdd, STATGROUP_AzSpeech);
+
+namespace AzSpeechDiskCache
+{
+	// Entry file layout: Header | Key content | Viseme data | Audio data
+	constexpr uint32 EntryMagic = 0x43535A41; // AZSC
+	constexpr uint32 IndexMagic = 0x49535A41; // AZSI
+	constexpr uint32 Version = 3;
+
+	// Magic, Version, AudioDuration, KeyDataOffset, KeyDataSize, VisemeDataOffset, VisemeDataSize, AudioDataOffset, AudioDataSize
+	constexpr int64 HeaderSize = sizeof(uint32) * 2 + sizeof(int64) * 7;
+
+	// Key, FileSize, LastAccessTicks
+	constexpr int64 IndexEntrySize = sizeof(uint64) + sizeof(int64) * 2;
+
+	struct FEntryHeader
+	{
+		uint32 Magic = EntryMagic;
+		uint32 Version = AzSpeechDiskCache::Version;
+		int64 AudioDuration = 0;
+		int64 KeyDataOffset = 0;
+		int64 KeyDataSize = 0;
+		int64 VisemeDataOffset = 0;
+		int64 VisemeDataSize = 0;
+		int64 AudioDataOffset = 0;
+		int64 AudioDataSize = 0;
+
+		friend FArchive& operator<<(FArchive& Ar, FEntryHeader& Header)
+		{
+			return Ar << Header.Magic << Header.Version << Header.AudioDuration << Header.KeyDataOffset << Header.KeyDataSize << Header.VisemeDataOffset
+				<< Header.VisemeDataSize << Header.AudioDataOffset << Header.AudioDataSize;
+		}
+	};
+
+	// Keeps the mapped file alive while the audio buffer is in use: The region must be released before the handle
+	struct FMappedEntry
+	{
+		TUniquePtr<IMappedFileHandle> Handle;
+		TUniquePtr<IMappedFileRegion> Region;
+	};
+
+	const bool IsRangeValid(const int64 Offset, const int64 Size, const int64 FileSize)
+	{
+		return Offset >= 0 && Size >= 0 && Size <= MAX_int32 && Offset <= FileSize && Size <= FileSize - Offset;
+	}
+
+	// Every offset and size comes from the file: Check them against the mapped size before reading anything
+	const bool IsHeaderValid(const FEntryHeader& Header, const int64 FileSize)
+	{
+		return Header.Magic == EntryMagic && Header.Version == Version && Header.KeyDataOffset >= HeaderSize && Header.KeyDataSize > 0 && IsRangeValid(
+			Header.KeyDataOffset, Header.KeyDataSize, FileSize) && Header.VisemeDataOffset >= Header.KeyDataOffset + Header.KeyDataSize && IsRangeValid(
+			Header.VisemeDataOffset, Header.VisemeDataSize, FileSize) && Header.AudioDataOffset >= Header.VisemeDataOffset + Header.VisemeDataSize && Header.
+			AudioDataSize > 0 && IsRangeValid(Header.AudioDataOffset, Header.AudioDataSize, FileSize);
+	}
+}
+
+FAzSpeechSynthesisDiskCache::FAzSpeechSynthesisDiskCache(const FString& InCacheDirectory, const int64 InBudgetBytes)
+	: CacheDirectory(InCacheDirectory), BudgetBytes(FMath::Max<int64>(0, InBudgetBytes))
+{
+}
+
+FAzSpeechSynthesisDiskCache::~FAzSpeechSynthesisDiskCache()
+{
+	Flush();
+}
+
+void FAzSpeechSynthesisDiskCache::LoadIndexAsync()
+{
+	// The directory scan can take a while with many entries: Keep it out of the game thread
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis = TWeakPtr<FAzSpeechSynthesisDiskCache, ESPMode::ThreadSafe>(AsShared())]
+	{
+		if (const TSharedPtr<FAzSpeechSynthesisDiskCache, ESPMode::ThreadSafe> PinnedThis = WeakThis.Pin())
+		{
+			PinnedThis->LoadIndex_Internal();
+		}
+	});
+}
+
+TSharedPtr<const FAzSpeechCachedSynthesis, ESPMode::ThreadSafe> FAzSpeechSynthesisDiskCache::Find(const uint64 Key, const FString& KeyContent)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_DiskCacheFind);
+
+	FAzSpeechDiskCacheEntry Entry;
+	{
+		FScopeLock Lock(&Mutex);
+
+		// Called from the game thread: Never wait for the index here
+		FAzSpeechDiskCacheEntry* const FoundEntry = bIndexLoaded ? Entries.Find(Key) : nullptr;
+		if (!FoundEntry)
+		{
+			++NumMisses;
+			return nullptr;
+		}
+
+		// Only the metadata is handled while holding the mutex: The file is mapped and read below, without waiting for the writes of other threads
+		FoundEntry->LastAccessTicks = FDateTime::UtcNow().GetTicks();
+		bIndexDirty = true;
+
+		Entry = *FoundEntry;
+	}
+
+	const FString EntryFileName = GetEntryFileName(Key);
+
+	const auto MappedEntry = std::make_shared<AzSpeechDiskCache::FMappedEntry>();
+	MappedEntry->Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*EntryFileName));
+
+	if (MappedEntry->Handle.IsValid())
+	{
+		MappedEntry->Region.Reset(MappedEntry->Handle->MapRegion(0, MappedEntry->Handle->GetFileSize()));
+	}
+
+	if (!MappedEntry->Region.IsValid() || MappedEntry->Region->GetMappedSize() < AzSpeechDiskCache::HeaderSize)
+	{
+		UE_LOG(LogAzSpeech_Internal, Warning, TEXT("%s: Failed to map cached file '%s'. Removing it from the cache."), *FString(__FUNCTION__),
+		       *EntryFileName);
+
+		MappedEntry->Region.Reset();
+		MappedEntry->Handle.Reset();
+		OnFindFailed(Key, Entry.Revision, true);
+
+		return nullptr;
+	}
+
+	const uint8* const MappedData = MappedEntry->Region->GetMappedPtr();
+	const int64 MappedSize = MappedEntry->Region->GetMappedSize();
+
+	AzSpeechDiskCache::FEntryHeader Header;
+	{
+		const TArray<uint8> HeaderData(MappedData, AzSpeechDiskCache::HeaderSize);
+		FMemoryReader HeaderReader(HeaderData);
+		HeaderReader << Header;
+	}
+
+	if (!AzSpeechDiskCache::IsHeaderValid(Header, MappedSize))
+	{
+		UE_LOG(LogAzSpeech_Internal, Warning, TEXT("%s: Cached file '%s' is invalid or outdated. Removing it from the cache."), *FString(__FUNCTION__),
+		       *EntryFileName);
+
+		MappedEntry->Region.Reset();
+		MappedEntry->Handle.Reset();
+		OnFindFailed(Key, Entry.Revision, true);
+
+		return nullptr;
+	}
+
+	// Different contents with the same hash: Keep the stored entry, the new result will replace it when added
+	if (const FTCHARToUTF8 KeyContentUTF8(*KeyContent); Header.KeyDataSize != KeyContentUTF8.Length() || FMemory::Memcmp(
+		MappedData + Header.KeyDataOffset, KeyContentUTF8.Get(), KeyContentUTF8.Length()) != 0)
+	{
+		UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Cached file '%s' belongs to a different content with the same hash."), *FString(__FUNCTION__),
+		       *EntryFileName);
+
+		OnFindFailed(Key, Entry.Revision, false);
+		return nullptr;
+	}
+
+	const TSharedRef<FAzSpeechCachedSynthesis, ESPMode::ThreadSafe> Output = MakeShared<FAzSpeechCachedSynthesis, ESPMode::ThreadSafe>();
+	Output->AudioDuration = Header.AudioDuration;
+
+	// Viseme data is small and needs to be deserialized: Only the audio data stays in the mapped region
+	if (Header.VisemeDataSize > 0)
+	{
+		const TArray<uint8> VisemeData(MappedData + Header.VisemeDataOffset, static_cast<int32>(Header.VisemeDataSize));
+		FMemoryReader VisemeReader(VisemeData);
+
+		VisemeReader << Output->VisemeTrack;
+
+		if (VisemeReader.IsError())
+		{
+			UE_LOG(LogAzSpeech_Internal, Warning, TEXT("%s: Cached file '%s' has invalid viseme data. Removing it from the cache."),
+			       *FString(__FUNCTION__), *EntryFileName);
+
+			MappedEntry->Region.Reset();
+			MappedEntry->Handle.Reset();
+			OnFindFailed(Key, Entry.Revision, true);
+
+			return nullptr;
+		}
+	}
+
+	Output->AudioData = FAzSpeechAudioBuffer(MappedEntry, MappedData + Header.AudioDataOffset, static_cast<int32>(Header.AudioDataSize));
+
+	++NumHits;
+
+	return Output;
+}
+
+void FAzSpeechSynthesisDiskCache::Add(const uint64 Key, const FString& KeyContent, const FAzSpeechCachedSynthesis& Value)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_DiskCacheAdd);
+
+	if (Value.AudioData.IsEmpty())
+	{
+		return;
+	}
+
+	// The eviction needs the complete index and the index loading must not find files written in the meantime
+	LoadIndex_Internal();
+
+	const FTCHARToUTF8 KeyContentUTF8(*KeyContent);
+
+	TArray<uint8> VisemeData;
+	{
+		FMemoryWriter VisemeWriter(VisemeData);
+
+		FAzSpeechVisemeTrack VisemeTrack = Value.VisemeTrack;
+		VisemeWriter << VisemeTrack;
+	}
+
+	AzSpeechDiskCache::FEntryHeader Header;
+	Header.AudioDuration = Value.AudioDuration;
+	Header.KeyDataOffset = AzSpeechDiskCache::HeaderSize;
+	Header.KeyDataSize = KeyContentUTF8.Length();
+	Header.VisemeDataOffset = Header.KeyDataOffset + Header.KeyDataSize;
+	Header.VisemeDataSize = VisemeData.Num();
+	Header.AudioDataOffset = Header.VisemeDataOffset + Header.VisemeDataSize;
+	Header.AudioDataSize = Value.AudioData.Num();
+
+	const int64 FileSize = Header.AudioDataOffset + Header.AudioDataSize;
+	if (FileSize > BudgetBytes)
+	{
+		UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Result with %lld bytes exceeds the disk cache budget."), *FString(__FUNCTION__), FileSize);
+		return;
+	}
+
+	TArray<uint8> FileData;
+	FileData.Reserve(FileSize);
+	{
+		FMemoryWriter FileWriter(FileData);
+		FileWriter << Header;
+	}
+
+	FileData.Append(reinterpret_cast<const uint8*>(KeyContentUTF8.Get()), KeyContentUTF8.Length());
+	FileData.Append(VisemeData);
+	FileData.Append(Value.AudioData.GetData(), Value.AudioData.Num());
+
+	// Write to a temporary file first: A mapped entry must never be replaced while partially written
+	// The name is unique for each write because concurrent tasks can add the same key
+	const FString EntryFileName = GetEntryFileName(Key);
+	const FString TempFileName = FString::Printf(TEXT("%s.%s.tmp"), *EntryFileName, *FGuid::NewGuid().ToString());
+
+	if (!FFileHelper::SaveArrayToFile(FileData, *TempFileName))
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Failed to write cached file '%s'."), *FString(__FUNCTION__), *TempFileName);
+		return;
+	}
+
+	TArray<uint64> EvictedKeys;
+	{
+		FScopeLock Lock(&Mutex);
+
+		// The previous file of the key is replaced by the move below
+		Remove_Internal(Key);
+
+		if (UsedBytes + FileSize > BudgetBytes)
+		{
+			// Sorted once by the last access: The least recently used entries are evicted until the new file fits in the budget
+			TArray<TPair<int64, uint64>> AccessOrder;
+			AccessOrder.Reserve(Entries.Num());
+
+			for (const TPair<uint64, FAzSpeechDiskCacheEntry>& Iterator : Entries)
+			{
+				AccessOrder.Emplace(Iterator.Value.LastAccessTicks, Iterator.Key);
+			}
+
+			AccessOrder.Sort([](const TPair<int64, uint64>& Lhs, const TPair<int64, uint64>& Rhs)
+			{
+				return Lhs.Key < Rhs.Key;
+			});
+
+			for (int32 Index = 0; Index < AccessOrder.Num() && UsedBytes + FileSize > BudgetBytes; ++Index)
+			{
+				Remove_Internal(AccessOrder[Index].Value);
+				EvictedKeys.Add(AccessOrder[Index].Value);
+				++NumEvictions;
+			}
+		}
+
+		// Reserved until the file is moved: Concurrent writes account for it in their evictions
+		UsedBytes += FileSize;
+	}
+
+	// The file operations run without holding the mutex: Find is called from the game thread and must not wait for them
+	// An evicted key written again by another thread in the meantime loses its file, and the next Find removes its entry
+	for (const uint64 EvictedKey : EvictedKeys)
+	{
+		DeleteEntryFile(EvictedKey);
+	}
+
+	const bool bMoved = IFileManager::Get().Move(*EntryFileName, *TempFileName, true, true);
+	if (!bMoved)
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Failed to move cached file to '%s'."), *FString(__FUNCTION__), *EntryFileName);
+		IFileManager::Get().Delete(*TempFileName);
+	}
+
+	FScopeLock Lock(&Mutex);
+
+	UsedBytes -= FileSize;
+
+	if (!bMoved)
+	{
+		return;
+	}
+
+	// A concurrent write of the same key may have finished first: Its file was replaced by this one
+	Remove_Internal(Key);
+
+	FAzSpeechDiskCacheEntry& NewEntry = Entries.Add(Key);
+	NewEntry.FileSize = FileSize;
+	NewEntry.LastAccessTicks = FDateTime::UtcNow().GetTicks();
+	NewEntry.Revision = NextRevision++;
+
+	UsedBytes += FileSize;
+	bIndexDirty = true;
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Synthesis result written to '%s'. Entries: %d; Used bytes: %lld"), *FString(__FUNCTION__),
+	       *EntryFileName, Entries.Num(), UsedBytes);
+}
+
+void FAzSpeechSynthesisDiskCache::Flush()
+{
+	FScopeLock SaveLock(&SaveMutex);
+
+	TArray<uint8> IndexData;
+	{
+		FScopeLock Lock(&Mutex);
+
+		if (!bIndexLoaded || !bIndexDirty)
+		{
+			return;
+		}
+
+		FMemoryWriter IndexWriter(IndexData);
+
+		uint32 Magic = AzSpeechDiskCache::IndexMagic;
+		uint32 Version = AzSpeechDiskCache::Version;
+		int32 NumEntries = Entries.Num();
+		IndexWriter << Magic << Version << NumEntries;
+
+		for (TPair<uint64, FAzSpeechDiskCacheEntry>& Iterator : Entries)
+		{
+			IndexWriter << Iterator.Key << Iterator.Value.FileSize << Iterator.Value.LastAccessTicks;
+		}
+
+		bIndexDirty = false;
+	}
+
+	if (!FFileHelper::SaveArrayToFile(IndexData, *GetIndexFileName()))
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Failed to save the disk cache index."), *FString(__FUNCTION__));
+
+		FScopeLock Lock(&Mutex);
+		bIndexDirty = true;
+	}
+}
+
+void FAzSpeechSynthesisDiskCache::FlushAsync()
+{
+	{
+		FScopeLock Lock(&Mutex);
+
+		if (!bIndexLoaded || !bIndexDirty)
+		{
+			return;
+		}
+	}
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis = TWeakPtr<FAzSpeechSynthesisDiskCache, ESPMode::ThreadSafe>(AsShared())]
+	{
+		if (const TSharedPtr<FAzSpeechSynthesisDiskCache, ESPMode::ThreadSafe> PinnedThis = WeakThis.Pin())
+		{
+			PinnedThis->Flush();
+		}
+	});
+}
+
+void FAzSpeechSynthesisDiskCache::Empty()
+{
+	LoadIndex_Internal();
+
+	TArray<uint64> Keys;
+	{
+		FScopeLock Lock(&Mutex);
+
+		Entries.GetKeys(Keys);
+
+		for (const uint64 Key : Keys)
+		{
+			Remove_Internal(Key);
+		}
+	}
+
+	for (const uint64 Key : Keys)
+	{
+		DeleteEntryFile(Key);
+	}
+
+	Flush();
+}
+
+const FAzSpeechSynthesisCacheStats FAzSpeechSynthesisDiskCache::GetStats() const
+{
+	FScopeLock Lock(&Mutex);
+
+	FAzSpeechSynthesisCacheStats Output;
+	Output.NumEntries = Entries.Num();
+	Output.UsedBytes = UsedBytes;
+	Output.BudgetBytes = BudgetBytes;
+	Output.NumHits = NumHits;
+	Output.NumMisses = NumMisses;
+	Output.NumEvictions = NumEvictions;
+	Output.HitRate = Output.NumHits + Output.NumMisses > 0
+		                 ? static_cast<float>(Output.NumHits) / static_cast<float>(Output.NumHits + Output.NumMisses)
+		                 : 0.f;
+
+	return Output;
+}
+
+const FString FAzSpeechSynthesisDiskCache::GetEntryFileName(const uint64 Key) const
+{
+	return UAzSpeechHelper::QualifyFileExtension(CacheDirectory, FString::Printf(TEXT("%016llx"), Key), TEXT("azsc"));
+}
+
+const FString FAzSpeechSynthesisDiskCache::GetIndexFileName() const
+{
+	return UAzSpeechHelper::QualifyFileExtension(CacheDirectory, TEXT("Index"), TEXT("azsi"));
+}
+
+void FAzSpeechSynthesisDiskCache::LoadIndex_Internal()
+{
+	{
+		FScopeLock Lock(&Mutex);
+
+		if (bIndexLoaded)
+		{
+			return;
+		}
+	}
+
+	// Only the first caller reads the index: The others wait for it without blocking the readers of the main mutex
+	FScopeLock LoadLock(&LoadMutex);
+
+	{
+		FScopeLock Lock(&Mutex);
+
+		if (bIndexLoaded)
+		{
+			return;
+		}
+	}
+
+	TMap<uint64, FAzSpeechDiskCacheEntry> LoadedEntries;
+	int64 LoadedBytes = 0;
+	ReadIndex_Internal(LoadedEntries, LoadedBytes);
+
+	FScopeLock Lock(&Mutex);
+
+	Entries = MoveTemp(LoadedEntries);
+	UsedBytes = LoadedBytes;
+	bIndexLoaded = true;
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Disk cache index loaded. Entries: %d; Used bytes: %lld"), *FString(__FUNCTION__), Entries.Num(),
+	       UsedBytes);
+}
+
+void FAzSpeechSynthesisDiskCache::ReadIndex_Internal(TMap<uint64, FAzSpeechDiskCacheEntry>& OutEntries, int64& OutUsedBytes) const
+{
+	if (!UAzSpeechHelper::CreateNewDirectory(CacheDirectory))
+	{
+		return;
+	}
+
+	if (TArray<uint8> IndexData; FFileHelper::LoadFileToArray(IndexData, *GetIndexFileName(), FILEREAD_Silent))
+	{
+		FMemoryReader IndexReader(IndexData);
+
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		int32 NumEntries = 0;
+		IndexReader << Magic << Version << NumEntries;
+
+		// The number of entries is only trusted if the file has enough data for all of them
+		const bool bIsIndexValid = !IndexReader.IsError() && Magic == AzSpeechDiskCache::IndexMagic && Version == AzSpeechDiskCache::Version &&
+			NumEntries >= 0 && NumEntries <= (IndexReader.TotalSize() - IndexReader.Tell()) / AzSpeechDiskCache::IndexEntrySize;
+
+		if (bIsIndexValid)
+		{
+			OutEntries.Reserve(NumEntries);
+
+			for (int32 Index = 0; Index < NumEntries && !IndexReader.IsError(); ++Index)
+			{
+				uint64 Key = 0;
+				FAzSpeechDiskCacheEntry Entry;
+				IndexReader << Key << Entry.FileSize << Entry.LastAccessTicks;
+
+				if (Entry.FileSize > 0)
+				{
+					OutEntries.Add(Key, Entry);
+				}
+			}
+		}
+		else
+		{
+			UE_LOG(LogAzSpeech_Internal, Warning, TEXT("%s: Disk cache index is invalid or outdated. Discarding the cached files."), *FString(__FUNCTION__));
+		}
+	}
+
+	// Temporary files are leftovers of interrupted writes: No write starts before the index is loaded
+	TArray<FString> TempFiles;
+	IFileManager::Get().FindFiles(TempFiles, *CacheDirectory, TEXT("tmp"));
+
+	for (const FString& Iterator : TempFiles)
+	{
+		IFileManager::Get().Delete(*FPaths::Combine(CacheDirectory, Iterator));
+	}
+
+	// Files without an index entry are leftovers of evictions that couldn't delete a mapped file or of an outdated index
+	TArray<FString> CachedFiles;
+	IFileManager::Get().FindFiles(CachedFiles, *CacheDirectory, TEXT("azsc"));
+
+	TSet<uint64> ValidKeys;
+	for (const FString& Iterator : CachedFiles)
+	{
+		const uint64 Key = FCString::Strtoui64(*FPaths::GetBaseFilename(Iterator), nullptr, 16);
+
+		if (OutEntries.Contains(Key))
+		{
+			ValidKeys.Add(Key);
+		}
+		else
+		{
+			IFileManager::Get().Delete(*FPaths::Combine(CacheDirectory, Iterator));
+		}
+	}
+
+	for (auto Iterator = OutEntries.CreateIterator(); Iterator; ++Iterator)
+	{
+		if (!ValidKeys.Contains(Iterator->Key))
+		{
+			Iterator.RemoveCurrent();
+			continue;
+		}
+
+		OutUsedBytes += Iterator->Value.FileSize;
+	}
+}
+
+const bool FAzSpeechSynthesisDiskCache::Remove_Internal(const uint64 Key)
+{
+	FAzSpeechDiskCacheEntry Entry;
+	if (!Entries.RemoveAndCopyValue(Key, Entry))
+	{
+		return false;
+	}
+
+	UsedBytes -= Entry.FileSize;
+	bIndexDirty = true;
+
+	return true;
+}
+
+void FAzSpeechSynthesisDiskCache::DeleteEntryFile(const uint64 Key) const
+{
+	// Mapped files can't be deleted on some platforms: The file will be removed on the next index load
+	if (const FString EntryFileName = GetEntryFileName(Key); !IFileManager::Get().Delete(*EntryFileName, false, false, true))
+	{
+		UE_LOG(LogAzSpeech_Internal, Warning, TEXT("%s: Failed to delete cached file '%s'."), *FString(__FUNCTION__), *EntryFileName);
+	}
+}
+
+void FAzSpeechSynthesisDiskCache::OnFindFailed(const uint64 Key, const uint64 Revision, const bool bRemoveEntry)
+{
+	++NumMisses;
+
+	if (!bRemoveEntry)
+	{
+		return;
+	}
+
+	{
+		FScopeLock Lock(&Mutex);
+
+		// The entry may have been replaced while the file was read: The new file is kept
+		if (const FAzSpeechDiskCacheEntry* const Entry = Entries.Find(Key); !Entry || Entry->Revision != Revision)
+		{
+			return;
+		}
+
+		Remove_Internal(Key);
+	}
+
+	DeleteEntryFile(Key);
+}
@@ -0,0 +1,558 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/Cache/AzSpeechVoiceCatalog.h"
+#include "AzSpeech/AzSpeechSettings.h"
+#include "LogAzSpeech.h"
+#include <Async/Async.h>
+#include <HAL/FileManager.h>
+#include <Misc/FileHelper.h>
+#include <Misc/ScopeLock.h>
+#include <Serialization/MemoryReader.h>
+#include <Serialization/MemoryWriter.h>
+
+THIRD_PARTY_INCLUDES_START
+#include <speechapi_cxx_speech_synthesizer.h>
+THIRD_PARTY_INCLUDES_END
+
+DECLARE_CYCLE_STAT(TEXT("AzSpeech Voice Catalog Fetch"), STAT_AzSpeech_VoiceCatalogFetch, STATGROUP_AzSpeech);
+
+namespace MicrosoftSpeech = Microsoft::CognitiveServices::Speech;
+
+namespace AzSpeechVoiceCatalog
+{
+	constexpr uint32 Magic = 0x56535A41; // AZSV
+	constexpr uint32 Version = 1;
+
+	// Smallest serialized entry: Empty locale, update ticks and empty voice list
+	constexpr int64 MinEntrySize = sizeof(int32) + sizeof(int64) + sizeof(int32);
+
+	// Smallest serialized voice: 4 empty strings, gender, type and empty style list
+	constexpr int64 MinVoiceSize = sizeof(int32) * 4 + sizeof(uint8) * 2 + sizeof(int32);
+
+	// Smallest serialized style: Empty string
+	constexpr int64 MinStyleSize = sizeof(int32);
+
+	// Element counts come from the file: Each one is checked against the remaining data before anything is allocated
+	const bool IsCountValid(FArchive& Ar, const int32 Count, const int64 MinElementSize)
+	{
+		return !Ar.IsError() && Count >= 0 && Count <= (Ar.TotalSize() - Ar.Tell()) / MinElementSize;
+	}
+
+	// Same layout of the TArray serialization used to save the voices, with the counts validated
+	const bool ReadVoices(FArchive& Ar, TArray<FAzSpeechVoiceInfo>& OutVoices)
+	{
+		int32 NumVoices = 0;
+		Ar << NumVoices;
+
+		if (!IsCountValid(Ar, NumVoices, MinVoiceSize))
+		{
+			return false;
+		}
+
+		OutVoices.Reserve(NumVoices);
+
+		for (int32 VoiceIndex = 0; VoiceIndex < NumVoices; ++VoiceIndex)
+		{
+			FAzSpeechVoiceInfo& Voice = OutVoices.AddDefaulted_GetRef();
+			Ar << Voice.Name << Voice.ShortName << Voice.LocalName << Voice.Locale << Voice.Gender << Voice.VoiceType;
+
+			int32 NumStyles = 0;
+			Ar << NumStyles;
+
+			if (!IsCountValid(Ar, NumStyles, MinStyleSize))
+			{
+				return false;
+			}
+
+			Voice.StyleList.Reserve(NumStyles);
+
+			for (int32 StyleIndex = 0; StyleIndex < NumStyles && !Ar.IsError(); ++StyleIndex)
+			{
+				Ar << Voice.StyleList.AddDefaulted_GetRef();
+			}
+
+			if (Ar.IsError())
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+FAzSpeechVoiceCatalog::FAzSpeechVoiceCatalog(const FString& InCacheFileName, const FTimespan& InTimeToLive)
+	: CacheFileName(InCacheFileName), TimeToLive(InTimeToLive)
+{
+}
+
+void FAzSpeechVoiceCatalog::LoadAsync()
+{
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis = TWeakPtr<FAzSpeechVoiceCatalog, ESPMode::ThreadSafe>(AsShared())]
+	{
+		if (const TSharedPtr<FAzSpeechVoiceCatalog, ESPMode::ThreadSafe> PinnedThis = WeakThis.Pin())
+		{
+			PinnedThis->Load();
+		}
+	});
+}
+
+FAzSpeechVoiceCatalog::FVoiceListPtr FAzSpeechVoiceCatalog::Find(const FString& Locale)
+{
+	Load();
+
+	FScopeLock Lock(&Mutex);
+
+	ValidateSource_Internal();
+
+	bool bExpired = false;
+	FVoiceListPtr Output = Find_Internal(Locale, bExpired);
+
+	if (!Output.IsValid() || bExpired)
+	{
+		RequestRefresh_Internal(Locale);
+	}
+
+	return Output;
+}
+
+void FAzSpeechVoiceCatalog::Get(const FString& Locale, TFunction<void(const FVoiceListPtr&)>&& Callback)
+{
+	Load();
+
+	FVoiceListPtr CachedVoices;
+	{
+		FScopeLock Lock(&Mutex);
+
+		ValidateSource_Internal();
+
+		bool bExpired = false;
+		CachedVoices = Find_Internal(Locale, bExpired);
+
+		if (!CachedVoices.IsValid() || bExpired)
+		{
+			RequestRefresh_Internal(Locale);
+		}
+
+		if (!CachedVoices.IsValid())
+		{
+			PendingRequests.FindChecked(Locale).Add(MoveTemp(Callback));
+			return;
+		}
+	}
+
+	Callback(CachedVoices);
+}
+
+void FAzSpeechVoiceCatalog::RequestRefresh(const FString& Locale)
+{
+	FScopeLock Lock(&Mutex);
+
+	ValidateSource_Internal();
+	RequestRefresh_Internal(Locale);
+}
+
+void FAzSpeechVoiceCatalog::Flush()
+{
+	if (CacheFileName.IsEmpty())
+	{
+		return;
+	}
+
+	// Serializes the writes: An older catalog must never replace a newer one
+	FScopeLock SaveLock(&SaveMutex);
+
+	// The voice lists are immutable and shared: The copy only holds references, the file is written without holding the mutex
+	TMap<FString, FAzSpeechVoiceCatalogEntry> EntriesSnapshot;
+	FString SourceIDSnapshot;
+	{
+		FScopeLock Lock(&Mutex);
+
+		if (!bLoaded || !bDirty)
+		{
+			return;
+		}
+
+		EntriesSnapshot = Entries;
+		SourceIDSnapshot = SourceID;
+		bDirty = false;
+	}
+
+	TArray<uint8> CatalogData;
+	FMemoryWriter CatalogWriter(CatalogData);
+
+	uint32 Magic = AzSpeechVoiceCatalog::Magic;
+	uint32 Version = AzSpeechVoiceCatalog::Version;
+	int32 NumEntries = EntriesSnapshot.Num();
+	CatalogWriter << Magic << Version << SourceIDSnapshot << NumEntries;
+
+	for (TPair<FString, FAzSpeechVoiceCatalogEntry>& Iterator : EntriesSnapshot)
+	{
+		FVoiceList Voices = *Iterator.Value.Voices;
+		CatalogWriter << Iterator.Key << Iterator.Value.UpdateTicks << Voices;
+	}
+
+	if (!FFileHelper::SaveArrayToFile(CatalogData, *CacheFileName))
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("%s: Failed to save the voice catalog."), *FString(__FUNCTION__));
+
+		FScopeLock Lock(&Mutex);
+		bDirty = true;
+	}
+}
+
+void FAzSpeechVoiceCatalog::Empty()
+{
+	{
+		FScopeLock Lock(&Mutex);
+
+		Entries.Empty();
+		bLoaded = true;
+		bDirty = false;
+	}
+
+	if (!CacheFileName.IsEmpty())
+	{
+		FScopeLock SaveLock(&SaveMutex);
+		IFileManager::Get().Delete(*CacheFileName, false, false, true);
+	}
+}
+
+const bool FAzSpeechVoiceCatalog::FetchVoices(const FAzSpeechSubscriptionOptions& SubscriptionOptions, const FString& Locale, FVoiceList& OutVoices)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_VoiceCatalogFetch);
+
+	if (!UAzSpeechSettings::CheckAzSpeechSettings(SubscriptionOptions))
+	{
+		return false;
+	}
+
+	std::shared_ptr<MicrosoftSpeech::SpeechConfig> SpeechConfig;
+	const std::string SubscriptionKey = TCHAR_TO_UTF8(*SubscriptionOptions.SubscriptionKey.ToString());
+
+	if (SubscriptionOptions.bUsePrivateEndpoint)
+	{
+		SpeechConfig = MicrosoftSpeech::SpeechConfig::FromEndpoint(TCHAR_TO_UTF8(*SubscriptionOptions.PrivateEndpoint.ToString()), SubscriptionKey);
+	}
+	else
+	{
+		SpeechConfig = MicrosoftSpeech::SpeechConfig::FromSubscription(SubscriptionKey, TCHAR_TO_UTF8(*SubscriptionOptions.RegionID.ToString()));
+	}
+
+	if (!SpeechConfig)
+	{
+		return false;
+	}
+
+	const std::shared_ptr<MicrosoftSpeech::SpeechSynthesizer> SpeechSynthesizer = MicrosoftSpeech::SpeechSynthesizer::FromConfig(SpeechConfig, nullptr);
+	if (!SpeechSynthesizer)
+	{
+		return false;
+	}
+
+	const std::shared_ptr<MicrosoftSpeech::SynthesisVoicesResult> SynthesisVoices = SpeechSynthesizer->GetVoicesAsync(TCHAR_TO_UTF8(*Locale)).get();
+	if (!SynthesisVoices || SynthesisVoices->Reason != MicrosoftSpeech::ResultReason::VoicesListRetrieved)
+	{
+		UE_LOG(LogAzSpeech, Error, TEXT("%s: Failed to get the available voices for locale '%s': %s"), *FString(__FUNCTION__), *Locale,
+		       SynthesisVoices ? UTF8_TO_TCHAR(SynthesisVoices->ErrorDetails.c_str()) : TEXT("Invalid result"));
+		return false;
+	}
+
+	OutVoices.Empty(static_cast<int32>(SynthesisVoices->Voices.size()));
+
+	for (const std::shared_ptr<MicrosoftSpeech::VoiceInfo>& Voice : SynthesisVoices->Voices)
+	{
+		FAzSpeechVoiceInfo& NewVoice = OutVoices.AddDefaulted_GetRef();
+		NewVoice.Name = UTF8_TO_TCHAR(Voice->Name.c_str());
+		NewVoice.ShortName = UTF8_TO_TCHAR(Voice->ShortName.c_str());
+		NewVoice.LocalName = UTF8_TO_TCHAR(Voice->LocalName.c_str());
+		NewVoice.Locale = UTF8_TO_TCHAR(Voice->Locale.c_str());
+
+		// The SDK enumerations start at the same values: Unknown values are kept as Unknown
+		const int32 GenderValue = static_cast<int32>(Voice->Gender);
+		NewVoice.Gender = GenderValue <= static_cast<int32>(EAzSpeechVoiceGender::Male)
+			                  ? static_cast<EAzSpeechVoiceGender>(GenderValue)
+			                  : EAzSpeechVoiceGender::Unknown;
+
+		const int32 VoiceTypeValue = static_cast<int32>(Voice->VoiceType);
+		NewVoice.VoiceType = VoiceTypeValue <= static_cast<int32>(EAzSpeechVoiceType::OfflineStandard)
+			                     ? static_cast<EAzSpeechVoiceType>(VoiceTypeValue)
+			                     : EAzSpeechVoiceType::Unknown;
+
+		NewVoice.StyleList.Reserve(static_cast<int32>(Voice->StyleList.size()));
+		for (const std::string& Style : Voice->StyleList)
+		{
+			NewVoice.StyleList.Emplace(UTF8_TO_TCHAR(Style.c_str()));
+		}
+
+		UE_LOG(LogAzSpeech_Debugging, Display,
+		       TEXT("%s: Voice Name: %s; Short Name: %s; Local Name: %s; Locale: %s; Gender: %d; Type: %d; Styles: %d"), *FString(__FUNCTION__),
+		       *NewVoice.Name, *NewVoice.ShortName, *NewVoice.LocalName, *NewVoice.Locale, static_cast<int32>(NewVoice.Gender),
+		       static_cast<int32>(NewVoice.VoiceType), NewVoice.StyleList.Num());
+	}
+
+	return true;
+}
+
+FAzSpeechVoiceCatalog::FVoiceListPtr FAzSpeechVoiceCatalog::Find_Internal(const FString& Locale, bool& bOutExpired)
+{
+	if (const FAzSpeechVoiceCatalogEntry* const Entry = Entries.Find(Locale))
+	{
+		bOutExpired = IsExpired(*Entry);
+		return Entry->Voices;
+	}
+
+	// A locale can be answered from the list with all voices without another request
+	const FAzSpeechVoiceCatalogEntry* const AllVoicesEntry = Locale.IsEmpty() ? nullptr : Entries.Find(FString());
+	if (!AllVoicesEntry)
+	{
+		return nullptr;
+	}
+
+	const TSharedRef<FVoiceList, ESPMode::ThreadSafe> LocaleVoices = MakeShared<FVoiceList, ESPMode::ThreadSafe>();
+	for (const FAzSpeechVoiceInfo& Voice : *AllVoicesEntry->Voices)
+	{
+		if (Voice.Locale.Equals(Locale, ESearchCase::IgnoreCase))
+		{
+			LocaleVoices->Add(Voice);
+		}
+	}
+
+	if (LocaleVoices->Num() <= 0)
+	{
+		return nullptr;
+	}
+
+	FAzSpeechVoiceCatalogEntry& NewEntry = Entries.Add(Locale);
+	NewEntry.Voices = LocaleVoices;
+	NewEntry.UpdateTicks = AllVoicesEntry->UpdateTicks;
+
+	bOutExpired = IsExpired(NewEntry);
+
+	return NewEntry.Voices;
+}
+
+void FAzSpeechVoiceCatalog::RequestRefresh_Internal(const FString& Locale)
+{
+	if (PendingRequests.Contains(Locale))
+	{
+		return;
+	}
+
+	PendingRequests.Add(Locale);
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Requesting available voices for locale '%s'."), *FString(__FUNCTION__), *Locale);
+
+	const FAzSpeechSubscriptionOptions SubscriptionOptions = UAzSpeechSettings::Get()->DefaultOptions.SubscriptionOptions;
+
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+	          [WeakThis = TWeakPtr<FAzSpeechVoiceCatalog, ESPMode::ThreadSafe>(AsShared()), Locale, RequestSourceID = SourceID, SubscriptionOptions]
+	          {
+		          FVoiceList Voices;
+		          const bool bSuccess = FetchVoices(SubscriptionOptions, Locale, Voices);
+
+		          if (const TSharedPtr<FAzSpeechVoiceCatalog, ESPMode::ThreadSafe> PinnedThis = WeakThis.Pin())
+		          {
+			          PinnedThis->OnVoicesReceived(Locale, RequestSourceID,
+			                                       bSuccess ? FVoiceListPtr(MakeShared<FVoiceList, ESPMode::ThreadSafe>(MoveTemp(Voices))) : FVoiceListPtr());
+		          }
+	          });
+}
+
+void FAzSpeechVoiceCatalog::OnVoicesReceived(const FString& Locale, const FString& RequestSourceID, const FVoiceListPtr& Voices)
+{
+	TArray<TFunction<void(const FVoiceListPtr&)>> Callbacks;
+	FVoiceListPtr Result = Voices;
+	bool bUpdated = false;
+	{
+		FScopeLock Lock(&Mutex);
+
+		PendingRequests.RemoveAndCopyValue(Locale, Callbacks);
+
+		// Voices requested with a previous subscription are discarded
+		if (Voices.IsValid() && RequestSourceID.Equals(SourceID))
+		{
+			FAzSpeechVoiceCatalogEntry& Entry = Entries.FindOrAdd(Locale);
+			Entry.Voices = Voices;
+			Entry.UpdateTicks = FDateTime::UtcNow().GetTicks();
+
+			bDirty = true;
+			bUpdated = true;
+		}
+		else if (const FAzSpeechVoiceCatalogEntry* const Entry = Entries.Find(Locale))
+		{
+			// Keep answering with the expired voices if the refresh fails
+			Result = Entry->Voices;
+		}
+	}
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Voices received for locale '%s'. Result: %s; Voices: %d"), *FString(__FUNCTION__), *Locale,
+	       bUpdated ? TEXT("Success") : TEXT("Fail"), Result.IsValid() ? Result->Num() : 0);
+
+	// Called from a background task: The file is written after releasing the mutex
+	if (bUpdated)
+	{
+		Flush();
+	}
+
+	if (!Result.IsValid())
+	{
+		Result = MakeShared<FVoiceList, ESPMode::ThreadSafe>();
+	}
+
+	AsyncTask(ENamedThreads::GameThread,
+	          [WeakThis = TWeakPtr<FAzSpeechVoiceCatalog, ESPMode::ThreadSafe>(AsShared()), Locale, Result, Callbacks = MoveTemp(Callbacks), bUpdated]
+	          {
+		          for (const TFunction<void(const FVoiceListPtr&)>& Callback : Callbacks)
+		          {
+			          Callback(Result);
+		          }
+
+		          if (const TSharedPtr<FAzSpeechVoiceCatalog, ESPMode::ThreadSafe> PinnedThis = WeakThis.Pin(); PinnedThis.IsValid() && bUpdated)
+		          {
+			          PinnedThis->OnVoicesUpdated.Broadcast(Locale);
+		          }
+	          });
+}
+
+const bool FAzSpeechVoiceCatalog::IsExpired(const FAzSpeechVoiceCatalogEntry& Entry) const
+{
+	// Zero to never expire
+	return TimeToLive.GetTicks() > 0 && FDateTime::UtcNow().GetTicks() - Entry.UpdateTicks > TimeToLive.GetTicks();
+}
+
+void FAzSpeechVoiceCatalog::ValidateSource_Internal()
+{
+	const FString CurrentSourceID = GetSourceID(UAzSpeechSettings::Get()->DefaultOptions.SubscriptionOptions);
+	if (CurrentSourceID.Equals(SourceID))
+	{
+		return;
+	}
+
+	if (Entries.Num() > 0)
+	{
+		UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Default subscription changed. Discarding the cached voices."), *FString(__FUNCTION__));
+
+		Entries.Empty();
+		bDirty = true;
+	}
+
+	SourceID = CurrentSourceID;
+}
+
+void FAzSpeechVoiceCatalog::Load()
+{
+	FString ExpectedSourceID;
+	{
+		FScopeLock Lock(&Mutex);
+
+		if (bLoaded)
+		{
+			return;
+		}
+
+		ValidateSource_Internal();
+		ExpectedSourceID = SourceID;
+	}
+
+	// Only the first caller reads the file: The others wait for it without blocking the users of the main mutex
+	FScopeLock LoadLock(&LoadMutex);
+
+	{
+		FScopeLock Lock(&Mutex);
+
+		if (bLoaded)
+		{
+			return;
+		}
+	}
+
+	TMap<FString, FAzSpeechVoiceCatalogEntry> LoadedEntries;
+	ReadCatalog(ExpectedSourceID, LoadedEntries);
+
+	FScopeLock Lock(&Mutex);
+
+	if (bLoaded)
+	{
+		return;
+	}
+
+	bLoaded = true;
+
+	// Voices received while the file was read are newer: The loaded ones only fill the missing locales
+	if (SourceID.Equals(ExpectedSourceID))
+	{
+		for (TPair<FString, FAzSpeechVoiceCatalogEntry>& Iterator : LoadedEntries)
+		{
+			if (!Entries.Contains(Iterator.Key))
+			{
+				Entries.Add(Iterator.Key, MoveTemp(Iterator.Value));
+			}
+		}
+	}
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Voice catalog loaded. Locales: %d"), *FString(__FUNCTION__), Entries.Num());
+}
+
+void FAzSpeechVoiceCatalog::ReadCatalog(const FString& ExpectedSourceID, TMap<FString, FAzSpeechVoiceCatalogEntry>& OutEntries) const
+{
+	TArray<uint8> CatalogData;
+	if (CacheFileName.IsEmpty() || !FFileHelper::LoadFileToArray(CatalogData, *CacheFileName, FILEREAD_Silent))
+	{
+		return;
+	}
+
+	FMemoryReader CatalogReader(CatalogData);
+
+	// No string in the file can be larger than the file itself
+	CatalogReader.ArMaxSerializeSize = CatalogData.Num();
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	FString FileSourceID;
+	int32 NumEntries = 0;
+	CatalogReader << Magic << Version << FileSourceID << NumEntries;
+
+	if (Magic != AzSpeechVoiceCatalog::Magic || Version != AzSpeechVoiceCatalog::Version || !FileSourceID.Equals(ExpectedSourceID))
+	{
+		UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Voice catalog '%s' is outdated. Ignoring it."), *FString(__FUNCTION__), *CacheFileName);
+		return;
+	}
+
+	// The number of entries is only trusted if the file has enough data for all of them
+	if (!AzSpeechVoiceCatalog::IsCountValid(CatalogReader, NumEntries, AzSpeechVoiceCatalog::MinEntrySize))
+	{
+		UE_LOG(LogAzSpeech_Internal, Warning, TEXT("%s: Voice catalog '%s' is invalid. Discarding it."), *FString(__FUNCTION__), *CacheFileName);
+		IFileManager::Get().Delete(*CacheFileName, false, false, true);
+		return;
+	}
+
+	OutEntries.Reserve(NumEntries);
+
+	for (int32 Index = 0; Index < NumEntries; ++Index)
+	{
+		FString Locale;
+		int64 UpdateTicks = 0;
+		FVoiceList Voices;
+		CatalogReader << Locale << UpdateTicks;
+
+		if (CatalogReader.IsError() || !AzSpeechVoiceCatalog::ReadVoices(CatalogReader, Voices))
+		{
+			UE_LOG(LogAzSpeech_Internal, Warning, TEXT("%s: Voice catalog '%s' is corrupted. Discarding it."), *FString(__FUNCTION__), *CacheFileName);
+			IFileManager::Get().Delete(*CacheFileName, false, false, true);
+			OutEntries.Empty();
+			return;
+		}
+
+		FAzSpeechVoiceCatalogEntry& Entry = OutEntries.Add(Locale);
+		Entry.Voices = MakeShared<FVoiceList, ESPMode::ThreadSafe>(MoveTemp(Voices));
+		Entry.UpdateTicks = UpdateTicks;
+	}
+}
+
+const FString FAzSpeechVoiceCatalog::GetSourceID(const FAzSpeechSubscriptionOptions& SubscriptionOptions)
+{
+	return SubscriptionOptions.bUsePrivateEndpoint ? SubscriptionOptions.PrivateEndpoint.ToString() : SubscriptionOptions.RegionID.ToString();
+}
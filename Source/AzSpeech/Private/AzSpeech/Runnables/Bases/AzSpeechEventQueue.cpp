@@ -0,0 +1,133 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/Runnables/Bases/AzSpeechEventQueue.h"
+#include "LogAzSpeech.h"
+#include <Async/Async.h>
+
+DECLARE_CYCLE_STAT(TEXT("Dispatch Pending Events"), STAT_AzSpeechEventQueue_Dispatch, STATGROUP_AzSpeech);
+
+FAzSpeechEventQueue::~FAzSpeechEventQueue()
+{
+	Shutdown();
+}
+
+const bool FAzSpeechEventQueue::Enqueue(TUniqueFunction<void()>&& Event)
+{
+	if (!Event)
+	{
+		return false;
+	}
+
+	// Registered before checking the state: The shutdown waits for the producers that passed the check, so every accepted event is drained
+	++NumActiveProducers;
+
+	if (IsShuttingDown())
+	{
+		--NumActiveProducers;
+		return false;
+	}
+
+	PendingEvents.Enqueue(MoveTemp(Event));
+	++NumPendingEvents;
+
+	--NumActiveProducers;
+
+	return true;
+}
+
+const int32 FAzSpeechEventQueue::DispatchPendingEvents(const double TimeBudgetSeconds)
+{
+	check(IsInGameThread());
+
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeechEventQueue_Dispatch);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	int32 NumDispatched = 0;
+	TUniqueFunction<void()> Event;
+
+	// A single consumer pops the events in the same order they were added: The events of each task are dispatched in order, even across frames
+	while (!IsShuttingDown() && PendingEvents.Dequeue(Event))
+	{
+		--NumPendingEvents;
+
+		Event();
+		++NumDispatched;
+
+		if (TimeBudgetSeconds > 0.0 && FPlatformTime::Seconds() - StartTime >= TimeBudgetSeconds)
+		{
+			break;
+		}
+	}
+
+	if (NumDispatched > 0)
+	{
+		NumDispatchedEvents.Add(NumDispatched);
+
+		UE_LOG(LogAzSpeech_Debugging, Display, TEXT("%s: Dispatched %d events in %.3f ms. Pending events: %d"), *FString(__FUNCTION__), NumDispatched,
+		       (FPlatformTime::Seconds() - StartTime) * 1000.0, Num());
+	}
+
+	return NumDispatched;
+}
+
+void FAzSpeechEventQueue::Shutdown()
+{
+	if (bIsShuttingDown.exchange(true))
+	{
+		return;
+	}
+
+	// Producers that passed the state check only need to add their event: The wait is short and no event is added after it
+	while (NumActiveProducers > 0)
+	{
+		FPlatformProcess::Yield();
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// The accepted events carry final results and state transitions: Execute all of them, regardless of the budget. The events only hold weak
+	// references to the tasks, so the ones already destroyed are skipped by the events themselves
+	int32 NumDrained = 0;
+	TUniqueFunction<void()> Event;
+
+	while (PendingEvents.Dequeue(Event))
+	{
+		--NumPendingEvents;
+		++NumDrained;
+
+		if (IsInGameThread())
+		{
+			Event();
+		}
+		else
+		{
+			AsyncTask(ENamedThreads::GameThread, MoveTemp(Event));
+		}
+	}
+
+	if (NumDrained > 0)
+	{
+		NumDispatchedEvents.Add(NumDrained);
+
+		UE_LOG(LogAzSpeech_Debugging, Display, TEXT("%s: Drained %d events in %.3f ms"), *FString(__FUNCTION__), NumDrained,
+		       (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+}
+
+const bool FAzSpeechEventQueue::IsShuttingDown() const
+{
+	return bIsShuttingDown;
+}
+
+const int32 FAzSpeechEventQueue::Num() const
+{
+	return NumPendingEvents;
+}
+
+const int64 FAzSpeechEventQueue::GetNumDispatchedEvents() const
+{
+	return NumDispatchedEvents.GetValue();
+}
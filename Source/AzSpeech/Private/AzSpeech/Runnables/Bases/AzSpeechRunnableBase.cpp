@@ -3,16 +3,18 @@
 // Repo: https://github.com/lucoiso/UEAzSpeech
 
 #include "AzSpeech/Runnables/Bases/AzSpeechRunnableBase.h"
+#include "AzSpeech/Runnables/Bases/AzSpeechEventQueue.h"
 #include "AzSpeech/Tasks/Bases/AzSpeechTaskBase.h"
 #include "AzSpeech/AzSpeechHelper.h"
 #include "AzSpeech/AzSpeechSettings.h"
+#include "AzSpeech/AzSpeechEngineSubsystem.h"
 #include "AzSpeechInternalFuncs.h"
 #include "LogAzSpeech.h"
 #include <HAL/ThreadManager.h>
 #include <Misc/FileHelper.h>
 #include <Misc/Paths.h>
-#include <Misc/ScopeTryLock.h>
 #include <Async/Async.h>
+#include <Engine/Engine.h>
 
 #if ENGINE_MAJOR_VERSION < 5
 #include <HAL/PlatformFilemanager.h>
@@ -24,7 +26,7 @@ namespace MicrosoftSpeech = Microsoft::CognitiveServices::Speech;
 
 FAzSpeechRunnableBase::FAzSpeechRunnableBase(UAzSpeechTaskBase* const InOwningTask,
                                              std::shared_ptr<MicrosoftSpeech::Audio::AudioConfig>&& InAudioConfig)
-	: OwningTask(InOwningTask), AudioConfig(InAudioConfig)
+	: PoolReleaseEvent(FPlatformProcess::GetSynchEventFromPool(true)), OwningTask(InOwningTask), AudioConfig(InAudioConfig)
 {
 }
 
@@ -40,37 +42,80 @@ FAzSpeechRunnableBase::~FAzSpeechRunnableBase()
 		Thread->Kill(true);
 	}
 
+	if (RunnablePool.IsValid())
+	{
+		RunnablePool->CancelPendingWork(this);
+	}
+
+	FPlatformProcess::ReturnSynchEventToPool(PoolReleaseEvent);
+	PoolReleaseEvent = nullptr;
+
 	UE_LOG(LogAzSpeech_Internal, Display, TEXT("Thread: %s; Function: %s; Message: Destructing runnable thread"), *GetThreadName(),
 	       *FString(__FUNCTION__));
 }
 
 void FAzSpeechRunnableBase::StartAzSpeechRunnableTask()
 {
-	Thread.Reset(FRunnableThread::Create(
-		this, *FString::Printf(TEXT("AzSpeech_%s_%d"), *GetOwningTask()->GetTaskName().ToString(), GetOwningTask()->GetUniqueID()), 0u,
-		GetCPUThreadPriority()));
+	const FString RunnableName = FString::Printf(TEXT("AzSpeech_%s_%d"), *GetOwningTask()->GetTaskName().ToString(), GetOwningTask()->GetUniqueID());
+
+	if (const UAzSpeechEngineSubsystem* const AzSpeechSubsystem = GEngine ? GEngine->GetEngineSubsystem<UAzSpeechEngineSubsystem>() : nullptr)
+	{
+		RunnablePool = AzSpeechSubsystem->GetRunnablePool();
+		EventQueue = AzSpeechSubsystem->GetEventQueue();
+	}
+
+	if (RunnablePool.IsValid())
+	{
+		// Pooled runnables don't own a thread: Use the task name to identify the work in the logs
+		ThreadName = *RunnableName;
+
+		if (RunnablePool->EnqueueWork(this, EAzSpeechRunnableWorkType::Start))
+		{
+			return;
+		}
+
+		RunnablePool.Reset();
+	}
+
+	Thread.Reset(FRunnableThread::Create(this, *RunnableName, 0u, GetCPUThreadPriority()));
 }
 
 void FAzSpeechRunnableBase::StopAzSpeechRunnableTask()
 {
 	UE_LOG(LogAzSpeech_Internal, Display, TEXT("Thread: %s; Function: %s; Message: Setting runnable work as pending stop"), *GetThreadName(),
 	       *FString(__FUNCTION__));
-	bStopTask = true;
+	StopSignal.Request();
+
+	if (!RunnablePool.IsValid())
+	{
+		return;
+	}
+
+	// Only the first caller to leave the active state is allowed to schedule the exit work
+	if (EPooledRunnableState ExpectedState = EPooledRunnableState::Active; PooledState.compare_exchange_strong(
+		ExpectedState, EPooledRunnableState::Exiting) && !RunnablePool->EnqueueWork(this, EAzSpeechRunnableWorkType::Exit))
+	{
+		UE_LOG(LogAzSpeech_Internal, Warning, TEXT("Thread: %s; Function: %s; Message: Failed to schedule runnable exit: Pool is shutting down"),
+		       *GetThreadName(), *FString(__FUNCTION__));
+	}
 }
 
 bool FAzSpeechRunnableBase::IsRunning() const
 {
-	return !bStopTask;
+	return !StopSignal.IsRequested();
 }
 
 bool FAzSpeechRunnableBase::IsPendingStop() const
 {
-	return bStopTask;
+	return StopSignal.IsRequested();
 }
 
 bool FAzSpeechRunnableBase::Init()
 {
-	StoreThreadInformation();
+	if (!IsRunningInPool())
+	{
+		StoreThreadInformation();
+	}
 
 	UE_LOG(LogAzSpeech_Internal, Display, TEXT("Thread: %s; Function: %s; Message: Initializing runnable thread"), *GetThreadName(),
 	       *FString(__FUNCTION__));
@@ -90,31 +135,34 @@ void FAzSpeechRunnableBase::Stop()
 {
 	UE_LOG(LogAzSpeech_Internal, Display, TEXT("Thread: %s; Function: %s; Message: Stopping runnable thread work"), *GetThreadName(),
 	       *FString(__FUNCTION__));
+
+	// Wake up a dedicated thread that is still waiting for the work to finish: e.g. when the thread is killed
+	StopSignal.Request();
 }
 
 void FAzSpeechRunnableBase::Exit()
 {
 	UE_LOG(LogAzSpeech_Internal, Display, TEXT("Thread: %s; Function: %s; Message: Exiting thread"), *GetThreadName(), *FString(__FUNCTION__));
 
+	if (IsPendingStop())
+	{
+		UE_LOG(LogAzSpeech_Debugging, Display, TEXT("Thread: %s; Function: %s; Message: Exiting %.3f ms after the stop request"), *GetThreadName(),
+		       *FString(__FUNCTION__), (FPlatformTime::Seconds() - StopSignal.GetRequestTime()) * 1000.0);
+	}
+
 	UAzSpeechTaskBase* const OwningTask_Local = GetOwningTask();
 	if (!UAzSpeechTaskStatus::IsTaskActive(OwningTask_Local))
 	{
 		return;
 	}
 
-	AsyncTask(ENamedThreads::GameThread, [OwningTask_Local]
+	DispatchToGameThread([OwningTask_Weak = MakeWeakObjectPtr(OwningTask_Local)]
 	{
-		const FScopeTryLock Lock(&OwningTask_Local->Mutex);
-
-		if (!Lock.IsLocked())
+		// The task state transitions are atomic: Broadcasting a task that was already finished does nothing
+		if (UAzSpeechTaskBase* const Task = OwningTask_Weak.Get(); OwningTask_Weak.IsValid() && UAzSpeechTaskStatus::IsTaskActive(Task))
 		{
-			return;
-		}
-
-		if (UAzSpeechTaskStatus::IsTaskActive(OwningTask_Local))
-		{
-			OwningTask_Local->BroadcastFinalResult();
-			OwningTask_Local->SetReadyToDestroy();
+			Task->BroadcastFinalResult();
+			Task->SetReadyToDestroy();
 		}
 	});
 }
@@ -152,6 +200,35 @@ bool FAzSpeechRunnableBase::CanInitializeTask() const
 		UAzSpeechTaskStatus::IsTaskStillValid(OwningTask_Local);
 }
 
+const uint32 FAzSpeechRunnableBase::WaitForPendingStop() const
+{
+	if (IsRunningInPool())
+	{
+		return 1u;
+	}
+
+	// Signaled by StopAzSpeechRunnableTask, which is called by the SDK callbacks when the work reaches its final result
+	StopSignal.Wait(UAzSpeechSettings::Get()->bUseStopEvent ? 0.f : GetThreadUpdateInterval());
+
+	return 1u;
+}
+
+const bool FAzSpeechRunnableBase::IsRunningInPool() const
+{
+	return RunnablePool.IsValid();
+}
+
+void FAzSpeechRunnableBase::DispatchToGameThread(TUniqueFunction<void()>&& Event) const
+{
+	// All the events of a runnable go through the same path, so the task receives them in the same order they were sent by the SDK
+	if (EventQueue.IsValid() && EventQueue->Enqueue(MoveTemp(Event)))
+	{
+		return;
+	}
+
+	AsyncTask(ENamedThreads::GameThread, MoveTemp(Event));
+}
+
 const std::chrono::seconds FAzSpeechRunnableBase::GetTaskTimeout() const
 {
 	return std::chrono::seconds(GetTimeout());
@@ -379,26 +456,7 @@ const EThreadPriority FAzSpeechRunnableBase::GetCPUThreadPriority() const
 {
 	if (UAzSpeechTaskStatus::IsTaskStillValid(GetOwningTask()))
 	{
-		switch (UAzSpeechSettings::Get()->TasksThreadPriority)
-		{
-		case EAzSpeechThreadPriority::Lowest:
-			return TPri_Lowest;
-
-		case EAzSpeechThreadPriority::BelowNormal:
-			return TPri_Lowest;
-
-		case EAzSpeechThreadPriority::Normal:
-			return TPri_Lowest;
-
-		case EAzSpeechThreadPriority::AboveNormal:
-			return TPri_Lowest;
-
-		case EAzSpeechThreadPriority::Highest:
-			return TPri_Lowest;
-
-		default:
-			break;
-		}
+		return AzSpeech::Internal::GetCPUThreadPriority(UAzSpeechSettings::Get()->TasksThreadPriority);
 	}
 
 	return TPri_Normal;
@@ -429,6 +487,66 @@ const FString FAzSpeechRunnableBase::GetThreadName() const
 	return ThreadName.ToString();
 }
 
+const bool FAzSpeechRunnableBase::ExecutePooledWork(const EAzSpeechRunnableWorkType WorkType)
+{
+	if (WorkType == EAzSpeechRunnableWorkType::Exit)
+	{
+		Exit();
+		PooledState = EPooledRunnableState::Finished;
+
+		return true;
+	}
+
+	PooledState = EPooledRunnableState::Starting;
+
+	// Same sequence used by FRunnableThread: Exit is only called if Init succeeds
+	if (!Init())
+	{
+		PooledState = EPooledRunnableState::Finished;
+		return true;
+	}
+
+	if (Run() == 0u)
+	{
+		PooledState = EPooledRunnableState::Exiting;
+		Exit();
+		PooledState = EPooledRunnableState::Finished;
+
+		return true;
+	}
+
+	PooledState = EPooledRunnableState::Active;
+
+	// The work may have been stopped while the runnable was starting: Exit now if no one else scheduled it
+	if (EPooledRunnableState ExpectedState = EPooledRunnableState::Active; IsPendingStop() && PooledState.compare_exchange_strong(
+		ExpectedState, EPooledRunnableState::Exiting))
+	{
+		Exit();
+		PooledState = EPooledRunnableState::Finished;
+
+		return true;
+	}
+
+	return false;
+}
+
+void FAzSpeechRunnableBase::AbortPooledWork()
+{
+	UE_LOG(LogAzSpeech_Internal, Warning, TEXT("Thread: %s; Function: %s; Message: Aborting work that was never started: Pool is shutting down"),
+	       *GetThreadName(), *FString(__FUNCTION__));
+
+	StopSignal.Request();
+	PooledState = EPooledRunnableState::Finished;
+
+	DispatchToGameThread([OwningTask_Local = OwningTask]
+	{
+		if (UAzSpeechTaskBase* const Task = OwningTask_Local.Get(); UAzSpeechTaskStatus::IsTaskStillValid(Task))
+		{
+			Task->SetReadyToDestroy();
+		}
+	});
+}
+
 void FAzSpeechRunnableBase::StoreThreadInformation()
 {
 	const FString& ThreadNameRef = FThreadManager::Get().GetThreadName(FPlatformTLS::GetCurrentThreadId());
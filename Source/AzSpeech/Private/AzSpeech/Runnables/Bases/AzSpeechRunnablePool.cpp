@@ -0,0 +1,285 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/Runnables/Bases/AzSpeechRunnablePool.h"
+#include "AzSpeech/Runnables/Bases/AzSpeechRunnableBase.h"
+#include "LogAzSpeech.h"
+#include <HAL/RunnableThread.h>
+#include <HAL/Event.h>
+#include <Misc/ScopeLock.h>
+
+/**
+ *
+ */
+class FAzSpeechRunnablePoolWorker final : public FRunnable
+{
+public:
+	FAzSpeechRunnablePoolWorker() = delete;
+
+	explicit FAzSpeechRunnablePoolWorker(FAzSpeechRunnablePool* const InPool) : Pool(InPool)
+	{
+	}
+
+	// FRunnable interface
+	virtual uint32 Run() override
+	{
+		FAzSpeechRunnablePool::FAzSpeechRunnableWork Work;
+		while (Pool->DequeueWork(Work))
+		{
+			Pool->ExecuteWork(Work);
+		}
+
+		return 0u;
+	}
+	// End of FRunnable interface
+
+private:
+	FAzSpeechRunnablePool* Pool;
+};
+
+FAzSpeechRunnablePool::FAzSpeechRunnablePool(const int32 InNumWorkers, const EThreadPriority InThreadPriority)
+	: WorkEvent(FPlatformProcess::GetSynchEventFromPool(true))
+{
+	const int32 NumWorkers = FMath::Max(1, InNumWorkers);
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Creating AzSpeech runnable pool with %d workers."), *FString(__FUNCTION__), NumWorkers);
+
+	for (int32 Index = 0; Index < NumWorkers; ++Index)
+	{
+		FRunnable* const Worker = Workers.Emplace_GetRef(MakeUnique<FAzSpeechRunnablePoolWorker>(this)).Get();
+		Threads.Emplace(FRunnableThread::Create(Worker, *FString::Printf(TEXT("AzSpeech_Worker_%d"), Index), 0u, InThreadPriority));
+	}
+}
+
+FAzSpeechRunnablePool::~FAzSpeechRunnablePool()
+{
+	Shutdown();
+
+	FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+	WorkEvent = nullptr;
+}
+
+const bool FAzSpeechRunnablePool::EnqueueWork(FAzSpeechRunnableBase* const Runnable, const EAzSpeechRunnableWorkType WorkType)
+{
+	if (!Runnable || IsShuttingDown())
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&Mutex);
+
+	// Checked again while holding the mutex: The shutdown sets the flag under the same lock, so an accepted work is always drained
+	if (IsShuttingDown())
+	{
+		return false;
+	}
+
+	PendingWork.Emplace(Runnable, WorkType);
+	if (WorkType == EAzSpeechRunnableWorkType::Start)
+	{
+		ActiveRunnables.Add(Runnable);
+	}
+
+	if (GetNumPendingWork_Internal() > PeakQueueDepth.GetValue())
+	{
+		PeakQueueDepth.Set(GetNumPendingWork_Internal());
+	}
+
+	WorkEvent->Trigger();
+
+	return true;
+}
+
+void FAzSpeechRunnablePool::CancelPendingWork(FAzSpeechRunnableBase* const Runnable)
+{
+	while (true)
+	{
+		{
+			FScopeLock Lock(&Mutex);
+
+			CompactPendingWork_Internal();
+			PendingWork.RemoveAll([Runnable](const FAzSpeechRunnableWork& Work)
+			{
+				return Work.Key == Runnable;
+			});
+
+			if (!ExecutingRunnables.Contains(Runnable))
+			{
+				ActiveRunnables.Remove(Runnable);
+				return;
+			}
+
+			// Reset and Trigger are both guarded by the mutex: The release of the current work can't be lost before the wait below
+			Runnable->PoolReleaseEvent->Reset();
+		}
+
+		// The worker releases the runnable as soon as the current work returns
+		Runnable->PoolReleaseEvent->Wait();
+	}
+}
+
+void FAzSpeechRunnablePool::Shutdown()
+{
+	{
+		FScopeLock Lock(&Mutex);
+
+		if (bIsShuttingDown.exchange(true))
+		{
+			return;
+		}
+
+		WorkEvent->Trigger();
+	}
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Shutting down AzSpeech runnable pool."), *FString(__FUNCTION__));
+
+	for (TUniquePtr<FRunnableThread>& Thread : Threads)
+	{
+		if (Thread.IsValid())
+		{
+			Thread->WaitForCompletion();
+		}
+	}
+
+	Threads.Empty();
+	Workers.Empty();
+
+	// The workers are gone: The remaining works are drained here so every task still reaches a final state
+	TArray<FAzSpeechRunnableWork> RemainingWork;
+	{
+		FScopeLock Lock(&Mutex);
+
+		CompactPendingWork_Internal();
+		RemainingWork = MoveTemp(PendingWork);
+		PendingWork.Reset();
+
+		// Runnables destroyed during the drain wait for their release, like the ones executed by the workers
+		for (const FAzSpeechRunnableWork& Work : RemainingWork)
+		{
+			ExecutingRunnables.Add(Work.Key);
+		}
+	}
+
+	if (RemainingWork.Num() > 0)
+	{
+		UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Draining %d pending works."), *FString(__FUNCTION__), RemainingWork.Num());
+	}
+
+	for (const FAzSpeechRunnableWork& Work : RemainingWork)
+	{
+		// Exit works only dispatch the final result. Works that were never started are aborted instead of creating SDK objects during the shutdown
+		if (Work.Value == EAzSpeechRunnableWorkType::Exit)
+		{
+			Work.Key->ExecutePooledWork(Work.Value);
+		}
+		else
+		{
+			Work.Key->AbortPooledWork();
+		}
+
+		FScopeLock Lock(&Mutex);
+		ActiveRunnables.Remove(Work.Key);
+		ReleaseRunnable_Internal(Work.Key);
+	}
+}
+
+const bool FAzSpeechRunnablePool::IsShuttingDown() const
+{
+	return bIsShuttingDown;
+}
+
+const FAzSpeechThreadPoolStats FAzSpeechRunnablePool::GetStats() const
+{
+	FScopeLock Lock(&Mutex);
+
+	FAzSpeechThreadPoolStats Output;
+	Output.NumWorkers = Threads.Num();
+	Output.NumBusyWorkers = NumBusyWorkers.GetValue();
+	Output.QueueDepth = GetNumPendingWork_Internal();
+	Output.PeakQueueDepth = PeakQueueDepth.GetValue();
+	Output.NumActiveRunnables = ActiveRunnables.Num();
+	Output.NumCompletedWorks = NumCompletedWorks.GetValue();
+	Output.WorkerUtilization = Output.NumWorkers > 0 ? static_cast<float>(Output.NumBusyWorkers) / static_cast<float>(Output.NumWorkers) : 0.f;
+
+	return Output;
+}
+
+const bool FAzSpeechRunnablePool::DequeueWork(FAzSpeechRunnableWork& OutWork)
+{
+	while (!IsShuttingDown())
+	{
+		{
+			FScopeLock Lock(&Mutex);
+
+			if (GetNumPendingWork_Internal() > 0)
+			{
+				OutWork = PendingWork[PendingWorkHead++];
+				ExecutingRunnables.Add(OutWork.Key);
+
+				// Amortized O(1): The consumed works are only removed when they are the larger part of the array
+				if (PendingWorkHead == PendingWork.Num())
+				{
+					PendingWork.Reset();
+					PendingWorkHead = 0;
+				}
+				else if (PendingWorkHead >= 32 && PendingWorkHead * 2 >= PendingWork.Num())
+				{
+					CompactPendingWork_Internal();
+				}
+
+				return true;
+			}
+
+			// Reset and Trigger are both guarded by the mutex, so a new work can't be lost between the check above and the wait below
+			WorkEvent->Reset();
+		}
+
+		WorkEvent->Wait();
+	}
+
+	return false;
+}
+
+void FAzSpeechRunnablePool::ExecuteWork(const FAzSpeechRunnableWork& Work)
+{
+	NumBusyWorkers.Increment();
+	const bool bRunnableFinished = Work.Key->ExecutePooledWork(Work.Value);
+	NumBusyWorkers.Decrement();
+
+	NumCompletedWorks.Increment();
+
+	FScopeLock Lock(&Mutex);
+
+	if (bRunnableFinished)
+	{
+		ActiveRunnables.Remove(Work.Key);
+	}
+
+	ReleaseRunnable_Internal(Work.Key);
+}
+
+void FAzSpeechRunnablePool::ReleaseRunnable_Internal(FAzSpeechRunnableBase* const Runnable)
+{
+	ExecutingRunnables.RemoveSingleSwap(Runnable, false);
+
+	// Triggered while holding the mutex: A runnable waiting in CancelPendingWork can't be destroyed before this call returns
+	if (!ExecutingRunnables.Contains(Runnable))
+	{
+		Runnable->PoolReleaseEvent->Trigger();
+	}
+}
+
+const int32 FAzSpeechRunnablePool::GetNumPendingWork_Internal() const
+{
+	return PendingWork.Num() - PendingWorkHead;
+}
+
+void FAzSpeechRunnablePool::CompactPendingWork_Internal()
+{
+	if (PendingWorkHead > 0)
+	{
+		PendingWork.RemoveAt(0, PendingWorkHead, false);
+		PendingWorkHead = 0;
+	}
+}
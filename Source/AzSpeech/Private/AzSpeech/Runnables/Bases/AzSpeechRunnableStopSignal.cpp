@@ -0,0 +1,54 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/Runnables/Bases/AzSpeechRunnableStopSignal.h"
+#include <HAL/Event.h>
+
+FAzSpeechRunnableStopSignal::FAzSpeechRunnableStopSignal() : Event(FPlatformProcess::GetSynchEventFromPool(true))
+{
+}
+
+FAzSpeechRunnableStopSignal::~FAzSpeechRunnableStopSignal()
+{
+	FPlatformProcess::ReturnSynchEventToPool(Event);
+	Event = nullptr;
+}
+
+const bool FAzSpeechRunnableStopSignal::Request()
+{
+	// The time is stored before the request is published: A thread that sees the request always reads the time of the first one
+	double ExpectedTime = 0.0;
+	const bool bFirstRequest = RequestTime.compare_exchange_strong(ExpectedTime, FPlatformTime::Seconds(), std::memory_order_acq_rel);
+	bRequested.store(true, std::memory_order_release);
+
+	// Always triggered: A thread being killed must be released even if the request was already set
+	Event->Trigger();
+
+	return bFirstRequest;
+}
+
+const bool FAzSpeechRunnableStopSignal::IsRequested() const
+{
+	return bRequested.load(std::memory_order_acquire);
+}
+
+const double FAzSpeechRunnableStopSignal::GetRequestTime() const
+{
+	return RequestTime.load(std::memory_order_acquire);
+}
+
+void FAzSpeechRunnableStopSignal::Wait(const float PollInterval) const
+{
+	while (!IsRequested())
+	{
+		if (PollInterval > 0.f)
+		{
+			FPlatformProcess::Sleep(PollInterval);
+		}
+		else
+		{
+			Event->Wait();
+		}
+	}
+}
@@ -5,7 +5,6 @@
 #include "AzSpeech/Runnables/Recognition/AzSpeechRecognitionRunnable.h"
 #include "AzSpeech/Tasks/Recognition/Bases/AzSpeechRecognizerTaskBase.h"
 #include "LogAzSpeech.h"
-#include <Async/Async.h>
 #include <Misc/ScopeTryLock.h>
 
 namespace MicrosoftSpeech = Microsoft::CognitiveServices::Speech;
@@ -46,7 +45,7 @@ uint32 FAzSpeechRecognitionRunnable::Run()
 	{
 		UE_LOG(LogAzSpeech_Internal, Error, TEXT("Thread: %s; Function: %s; Message: Recognition failed to start."), *GetThreadName(),
 		       *FString(__FUNCTION__));
-		AsyncTask(ENamedThreads::GameThread, [RecognizerTask]
+		DispatchToGameThread([RecognizerTask]
 		{
 			RecognizerTask->RecognitionFailed.Broadcast();
 		});
@@ -54,11 +53,5 @@ uint32 FAzSpeechRecognitionRunnable::Run()
 		return 0u;
 	}
 
-	const float SleepTime = GetThreadUpdateInterval();
-	while (!IsPendingStop())
-	{
-		FPlatformProcess::Sleep(SleepTime);
-	}
-
-	return 1u;
+	return WaitForPendingStop();
 }
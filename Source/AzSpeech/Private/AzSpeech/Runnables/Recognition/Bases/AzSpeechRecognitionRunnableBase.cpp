@@ -4,10 +4,9 @@
 
 #include "AzSpeech/Runnables/Recognition/Bases/AzSpeechRecognitionRunnableBase.h"
 #include "AzSpeech/Tasks/Recognition/Bases/AzSpeechRecognizerTaskBase.h"
-#include "AzSpeech/AzSpeechSettings.h"
+#include "AzSpeech/AzSpeechMapGroupIndex.h"
 #include "AzSpeechInternalFuncs.h"
 #include "LogAzSpeech.h"
-#include <Async/Async.h>
 #include <Misc/ScopeTryLock.h>
 
 THIRD_PARTY_INCLUDES_START
@@ -106,16 +105,6 @@ const std::vector<std::string> FAzSpeechRecognitionRunnableBase::GetCandidateLan
 	return Output;
 }
 
-const TArray<FString> FAzSpeechRecognitionRunnableBase::GetPhraseListFromGroup(const FName& InGroup) const
-{
-	if (const UAzSpeechSettings* const Settings = UAzSpeechSettings::Get())
-	{
-		return AzSpeech::Internal::GetDataFromMapGroup<TArray<FString>, FAzSpeechPhraseListMap>(InGroup, Settings->PhraseListMap);
-	}
-
-	return TArray<FString>();
-}
-
 const MicrosoftSpeech::OutputFormat FAzSpeechRecognitionRunnableBase::GetOutputFormat() const
 {
 	if (const UAzSpeechRecognizerTaskBase* const RecognizerTask = GetOwningRecognizerTask(); UAzSpeechTaskStatus::IsTaskStillValid(RecognizerTask))
@@ -242,9 +231,14 @@ bool FAzSpeechRecognitionRunnableBase::ConnectRecognitionStartedSignals()
 		}
 		else
 		{
-			AsyncTask(ENamedThreads::GameThread, [RecognizerTask]
+			DispatchToGameThread([RecognizerTask_Local = MakeWeakObjectPtr(RecognizerTask)]
 			{
-				RecognizerTask->RecognitionStarted.Broadcast();
+				if (!RecognizerTask_Local.IsValid())
+				{
+					return;
+				}
+
+				RecognizerTask_Local->RecognitionStarted.Broadcast();
 			});
 		}
 	});
@@ -268,9 +262,14 @@ bool FAzSpeechRecognitionRunnableBase::ConnectRecognitionUpdatedSignals()
 		}
 		else
 		{
-			AsyncTask(ENamedThreads::GameThread, [RecognizerTask, Result = RecognitionEventArgs.Result]
+			DispatchToGameThread([RecognizerTask_Local = MakeWeakObjectPtr(RecognizerTask), Result = RecognitionEventArgs.Result]
 			{
-				RecognizerTask->OnRecognitionUpdated(Result);
+				if (!RecognizerTask_Local.IsValid())
+				{
+					return;
+				}
+
+				RecognizerTask_Local->OnRecognitionUpdated(Result);
 			});
 		}
 	});
@@ -286,17 +285,27 @@ bool FAzSpeechRecognitionRunnableBase::ConnectRecognitionUpdatedSignals()
 		const bool bValidResult = ProcessRecognitionResult(RecognitionEventArgs.Result);
 		if (!bValidResult)
 		{
-			AsyncTask(ENamedThreads::GameThread, [RecognizerTask]
+			DispatchToGameThread([RecognizerTask_Local = MakeWeakObjectPtr(RecognizerTask)]
 			{
-				RecognizerTask->RecognitionFailed.Broadcast();
+				if (!RecognizerTask_Local.IsValid())
+				{
+					return;
+				}
+
+				RecognizerTask_Local->RecognitionFailed.Broadcast();
 			});
 		}
 		else
 		{
-			AsyncTask(ENamedThreads::GameThread, [RecognizerTask, Result = RecognitionEventArgs.Result]
+			DispatchToGameThread([RecognizerTask_Local = MakeWeakObjectPtr(RecognizerTask), Result = RecognitionEventArgs.Result]
 			{
-				RecognizerTask->OnRecognitionUpdated(Result);
-				RecognizerTask->BroadcastFinalResult();
+				if (!RecognizerTask_Local.IsValid())
+				{
+					return;
+				}
+
+				RecognizerTask_Local->OnRecognitionUpdated(Result);
+				RecognizerTask_Local->BroadcastFinalResult();
 			});
 		}
 
@@ -319,9 +328,6 @@ bool FAzSpeechRecognitionRunnableBase::InsertPhraseList() const
 		return true;
 	}
 
-	UE_LOG(LogAzSpeech_Internal, Display, TEXT("Thread: %s; Function: %s; Message: Inserting Phrase List Data in Recognition Object"),
-	       *GetThreadName(), *FString(__FUNCTION__));
-
 	const auto PhraseListGrammar = MicrosoftSpeech::PhraseListGrammar::FromRecognizer(SpeechRecognizer);
 	if (!PhraseListGrammar)
 	{
@@ -330,11 +336,16 @@ bool FAzSpeechRecognitionRunnableBase::InsertPhraseList() const
 		return false;
 	}
 
-	for (const FString& PhraseListData : GetPhraseListFromGroup(RecognizerTask->PhraseListGroup))
+	// The phrases are converted to UTF-8 once, when the settings are indexed
+	const std::shared_ptr<const FAzSpeechMapGroupIndex> GroupIndex = FAzSpeechMapGroupIndex::Get();
+	const TArrayView<const std::string> PhraseList = GroupIndex->GetPhraseListUTF8(RecognizerTask->PhraseListGroup);
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("Thread: %s; Function: %s; Message: Inserting %d phrases of the group %s in Recognition Object"),
+	       *GetThreadName(), *FString(__FUNCTION__), PhraseList.Num(), *RecognizerTask->PhraseListGroup.ToString());
+
+	for (const std::string& PhraseListData : PhraseList)
 	{
-		UE_LOG(LogAzSpeech_Internal, Display, TEXT("Thread: %s; Function: %s; Message: Inserting Phrase List Data %s to Phrase List Grammar"),
-		       *GetThreadName(), *FString(__FUNCTION__), *PhraseListData);
-		PhraseListGrammar->AddPhrase(TCHAR_TO_UTF8(*PhraseListData));
+		PhraseListGrammar->AddPhrase(PhraseListData);
 	}
 
 	return true;
@@ -5,8 +5,10 @@
 #include "AzSpeech/Runnables/Synthesis/AzSpeechSynthesisRunnable.h"
 #include "AzSpeech/Tasks/Synthesis/Bases/AzSpeechSynthesizerTaskBase.h"
 #include "AzSpeech/AzSpeechSettings.h"
+#include "AzSpeech/AzSpeechEngineSubsystem.h"
 #include "LogAzSpeech.h"
-#include <Async/Async.h>
+#include <Engine/Engine.h>
+#include <Misc/ScopeLock.h>
 #include <Misc/ScopeTryLock.h>
 
 namespace MicrosoftSpeech = Microsoft::CognitiveServices::Speech;
@@ -15,6 +17,18 @@ FAzSpeechSynthesisRunnable::FAzSpeechSynthesisRunnable(UAzSpeechTaskBase* const
                                                        std::shared_ptr<MicrosoftSpeech::Audio::AudioConfig>&& InAudioConfig)
 	: FAzSpeechRunnableBase(InOwningTask, std::move(InAudioConfig))
 {
+	const UAzSpeechSynthesizerTaskBase* const SynthesizerTask = GetOwningSynthesizerTask();
+	if (!UAzSpeechTaskStatus::IsTaskStillValid(SynthesizerTask) || !SynthesizerTask->CanUseSynthesizerPool())
+	{
+		return;
+	}
+
+	if (const UAzSpeechEngineSubsystem* const AzSpeechSubsystem = GEngine ? GEngine->GetEngineSubsystem<UAzSpeechEngineSubsystem>() : nullptr)
+	{
+		SynthesizerPool = AzSpeechSubsystem->GetSynthesizerPool();
+		SynthesizerPoolKey = FAzSpeechSynthesizerPoolKey(SynthesizerTask->GetSubscriptionOptions(), SynthesizerTask->GetSynthesisOptions(),
+		                                                 SynthesizerTask->IsSSMLBased());
+	}
 }
 
 uint32 FAzSpeechSynthesisRunnable::Run()
@@ -59,21 +73,20 @@ uint32 FAzSpeechSynthesisRunnable::Run()
 	{
 		UE_LOG(LogAzSpeech_Internal, Error, TEXT("Thread: %s; Function: %s; Message: Synthesis failed to start."), *GetThreadName(),
 		       *FString(__FUNCTION__));
-		AsyncTask(ENamedThreads::GameThread, [SynthesizerTask]
+		DispatchToGameThread([SynthesizerTask_Local = MakeWeakObjectPtr(SynthesizerTask)]
 		{
-			SynthesizerTask->SynthesisFailed.Broadcast();
+			if (!SynthesizerTask_Local.IsValid())
+			{
+				return;
+			}
+
+			SynthesizerTask_Local->SynthesisFailed.Broadcast();
 		});
 
 		return 0u;
 	}
 
-	const float SleepTime = GetThreadUpdateInterval();
-	while (!IsPendingStop())
-	{
-		FPlatformProcess::Sleep(SleepTime);
-	}
-
-	return 1u;
+	return WaitForPendingStop();
 }
 
 void FAzSpeechSynthesisRunnable::Exit()
@@ -90,7 +103,16 @@ void FAzSpeechSynthesisRunnable::Exit()
 		SpeechSynthesizer->SynthesisStarted.DisconnectAll();
 		SpeechSynthesizer->Synthesizing.DisconnectAll();
 
-		SpeechSynthesizer->StopSpeakingAsync();
+		// Only synthesizers that completed their work are reusable: a canceled synthesis could still send events to the next task
+		if (SynthesizerPool.IsValid() && bCanReleaseSynthesizer)
+		{
+			// Pooled synthesizers were already pre-connected when they entered the pool for the first time
+			SynthesizerPool->Release(SynthesizerPoolKey, SpeechSynthesizer, !bUsingPooledSynthesizer && !bSynthesizerConnected);
+		}
+		else
+		{
+			SpeechSynthesizer->StopSpeakingAsync();
+		}
 	}
 
 	SpeechSynthesizer.reset();
@@ -129,7 +151,7 @@ const bool FAzSpeechSynthesisRunnable::ApplySDKSettings(const std::shared_ptr<Mi
 		return false;
 	}
 
-	InConfig->SetProperty("SpeechSynthesis_KeepConnectionAfterStopping", "false");
+	InConfig->SetProperty("SpeechSynthesis_KeepConnectionAfterStopping", SynthesizerPool.IsValid() ? "true" : "false");
 	InConfig->SetSpeechSynthesisOutputFormat(GetOutputFormat());
 
 	InsertProfanityFilterProperty(SynthesizerTask->GetSynthesisOptions().ProfanityFilter, InConfig);
@@ -172,6 +194,21 @@ bool FAzSpeechSynthesisRunnable::InitializeAzureObject()
 		return false;
 	}
 
+	if (SynthesizerPool.IsValid())
+	{
+		SpeechSynthesizer = SynthesizerPool->Acquire(SynthesizerPoolKey);
+
+		if (SpeechSynthesizer)
+		{
+			bUsingPooledSynthesizer = true;
+
+			UE_LOG(LogAzSpeech_Internal, Display, TEXT("Thread: %s; Function: %s; Message: Using pooled synthesizer object"), *GetThreadName(),
+			       *FString(__FUNCTION__));
+
+			return ConnectVisemeSignal() && ConnectSynthesisStartedSignal() && ConnectSynthesisUpdateSignals();
+		}
+	}
+
 	UE_LOG(LogAzSpeech_Internal, Display, TEXT("Thread: %s; Function: %s; Message: Creating synthesizer object"), *GetThreadName(),
 	       *FString(__FUNCTION__));
 
@@ -192,16 +229,23 @@ bool FAzSpeechSynthesisRunnable::InitializeAzureObject()
 		return false;
 	}
 
+	// Pooled synthesizers are shared between tasks: They don't write to any output and the audio data is read from the synthesis result
+	const std::shared_ptr<MicrosoftSpeech::Audio::AudioConfig> SynthesizerAudioConfig = SynthesizerPool.IsValid() ? nullptr : TaskAudioConfig;
+
 	if (!SynthesizerTask->IsSSMLBased() && SynthesizerTask->GetSynthesisOptions().bUseLanguageIdentification)
 	{
 		UE_LOG(LogAzSpeech_Internal, Display, TEXT("Thread: %s; Function: %s; Message: Initializing auto language detection"), *GetThreadName(),
 		       *FString(__FUNCTION__));
 		SpeechSynthesizer = MicrosoftSpeech::SpeechSynthesizer::FromConfig(
-			SpeechConfig, MicrosoftSpeech::AutoDetectSourceLanguageConfig::FromOpenRange(), TaskAudioConfig);
+			SpeechConfig, MicrosoftSpeech::AutoDetectSourceLanguageConfig::FromOpenRange(), SynthesizerAudioConfig);
+	}
+	else if (SynthesizerAudioConfig)
+	{
+		SpeechSynthesizer = MicrosoftSpeech::SpeechSynthesizer::FromConfig(SpeechConfig, SynthesizerAudioConfig);
 	}
 	else
 	{
-		SpeechSynthesizer = MicrosoftSpeech::SpeechSynthesizer::FromConfig(SpeechConfig, TaskAudioConfig);
+		SpeechSynthesizer = MicrosoftSpeech::SpeechSynthesizer::FromConfig(SpeechConfig, nullptr);
 	}
 
 	return ConnectVisemeSignal() && ConnectSynthesisStartedSignal() && ConnectSynthesisUpdateSignals();
@@ -236,14 +280,54 @@ bool FAzSpeechSynthesisRunnable::ConnectVisemeSignal()
 			return;
 		}
 
-		FAzSpeechVisemeData LastVisemeData;
-		LastVisemeData.VisemeID = VisemeEventArgs.VisemeId;
-		LastVisemeData.AudioOffsetMilliseconds = VisemeEventArgs.AudioOffset / 10000;
-		LastVisemeData.Animation = FString(UTF8_TO_TCHAR(VisemeEventArgs.Animation.c_str()));
+		// The animation is decoded here, in the SDK thread, straight from the UTF-8 string: The game thread only appends the decoded data
+		FAzSpeechVisemeTrack LastViseme;
+		LastViseme.Add(static_cast<int32>(VisemeEventArgs.VisemeId), static_cast<int64>(VisemeEventArgs.AudioOffset / 10000),
+		               VisemeEventArgs.Animation.c_str(), static_cast<int32>(VisemeEventArgs.Animation.size()));
+
+		if (!UAzSpeechSettings::Get()->bBatchVisemeEvents)
+		{
+			DispatchToGameThread([SynthesizerTask_Local = MakeWeakObjectPtr(SynthesizerTask), LastViseme = MoveTemp(LastViseme)]
+			{
+				if (!SynthesizerTask_Local.IsValid())
+				{
+					return;
+				}
+
+				SynthesizerTask_Local->OnVisemeBatchReceived(LastViseme);
+			});
+
+			return;
+		}
+
+		{
+			FScopeLock Lock(&PendingVisemes->Mutex);
+			PendingVisemes->Visemes.Append(LastViseme);
+
+			// A dispatch is already queued: The viseme will be delivered with the pending batch
+			if (PendingVisemes->bDispatchPending)
+			{
+				return;
+			}
+
+			PendingVisemes->bDispatchPending = true;
+		}
 
-		AsyncTask(ENamedThreads::GameThread, [SynthesizerTask, LastVisemeData]
+		DispatchToGameThread([SynthesizerTask_Local = MakeWeakObjectPtr(SynthesizerTask), PendingVisemes_Local = PendingVisemes]
 		{
-			SynthesizerTask->OnVisemeReceived(LastVisemeData);
+			if (!SynthesizerTask_Local.IsValid())
+			{
+				return;
+			}
+
+			FAzSpeechVisemeTrack VisemeBatch;
+			{
+				FScopeLock Lock(&PendingVisemes_Local->Mutex);
+				Swap(VisemeBatch, PendingVisemes_Local->Visemes);
+				PendingVisemes_Local->bDispatchPending = false;
+			}
+
+			SynthesizerTask_Local->OnVisemeBatchReceived(VisemeBatch);
 		});
 	});
 
@@ -267,9 +351,14 @@ bool FAzSpeechSynthesisRunnable::ConnectSynthesisStartedSignal()
 			}
 			else
 			{
-				AsyncTask(ENamedThreads::GameThread, [SynthesizerTask]
+				DispatchToGameThread([SynthesizerTask_Local = MakeWeakObjectPtr(SynthesizerTask)]
 				{
-					SynthesizerTask->SynthesisStarted.Broadcast();
+					if (!SynthesizerTask_Local.IsValid())
+					{
+						return;
+					}
+
+					SynthesizerTask_Local->SynthesisStarted.Broadcast();
 				});
 			}
 		});
@@ -293,9 +382,14 @@ bool FAzSpeechSynthesisRunnable::ConnectSynthesisUpdateSignals()
 		}
 		else
 		{
-			AsyncTask(ENamedThreads::GameThread, [SynthesizerTask, Result = SynthesisEventArgs.Result]
+			DispatchToGameThread([SynthesizerTask_Local = MakeWeakObjectPtr(SynthesizerTask), Result = SynthesisEventArgs.Result]
 			{
-				SynthesizerTask->OnSynthesisUpdate(Result);
+				if (!SynthesizerTask_Local.IsValid())
+				{
+					return;
+				}
+
+				SynthesizerTask_Local->OnSynthesisUpdate(Result);
 			});
 		}
 	});
@@ -309,19 +403,31 @@ bool FAzSpeechSynthesisRunnable::ConnectSynthesisUpdateSignals()
 		}
 
 		const bool bValidResult = ProcessSynthesisResult(SynthesisEventArgs.Result);
+		bCanReleaseSynthesizer = bValidResult;
+
 		if (!bValidResult)
 		{
-			AsyncTask(ENamedThreads::GameThread, [SynthesizerTask]
+			DispatchToGameThread([SynthesizerTask_Local = MakeWeakObjectPtr(SynthesizerTask)]
 			{
-				SynthesizerTask->SynthesisFailed.Broadcast();
+				if (!SynthesizerTask_Local.IsValid())
+				{
+					return;
+				}
+
+				SynthesizerTask_Local->SynthesisFailed.Broadcast();
 			});
 		}
 		else
 		{
-			AsyncTask(ENamedThreads::GameThread, [SynthesizerTask, Result = SynthesisEventArgs.Result]
+			DispatchToGameThread([SynthesizerTask_Local = MakeWeakObjectPtr(SynthesizerTask), Result = SynthesisEventArgs.Result]
 			{
-				SynthesizerTask->OnSynthesisUpdate(Result);
-				SynthesizerTask->BroadcastFinalResult();
+				if (!SynthesizerTask_Local.IsValid())
+				{
+					return;
+				}
+
+				SynthesizerTask_Local->OnSynthesisUpdate(Result);
+				SynthesizerTask_Local->BroadcastFinalResult();
 			});
 		}
 
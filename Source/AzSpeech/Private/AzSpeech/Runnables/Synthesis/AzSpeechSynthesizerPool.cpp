@@ -0,0 +1,240 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/Runnables/Synthesis/AzSpeechSynthesizerPool.h"
+#include "LogAzSpeech.h"
+#include <Misc/ScopeLock.h>
+
+namespace MicrosoftSpeech = Microsoft::CognitiveServices::Speech;
+
+FAzSpeechSynthesizerPoolKey::FAzSpeechSynthesizerPoolKey(const FAzSpeechSubscriptionOptions& InSubscriptionOptions,
+                                                         const FAzSpeechSynthesisOptions& InSynthesisOptions, const bool bInIsSSMLBased)
+	: SubscriptionKey(InSubscriptionOptions.SubscriptionKey), RegionID(InSubscriptionOptions.RegionID),
+	  PrivateEndpoint(InSubscriptionOptions.PrivateEndpoint), bUsePrivateEndpoint(InSubscriptionOptions.bUsePrivateEndpoint),
+	  OutputFormat(InSynthesisOptions.SpeechSynthesisOutputFormat), ProfanityFilter(InSynthesisOptions.ProfanityFilter), bIsSSMLBased(bInIsSSMLBased)
+{
+	// SSML based synthesizers get the language and voice from the SSML content: These options are not applied to the config
+	if (bIsSSMLBased)
+	{
+		return;
+	}
+
+	bUseLanguageIdentification = InSynthesisOptions.bUseLanguageIdentification;
+
+	if (bUseLanguageIdentification)
+	{
+		LanguageIdentificationMode = InSynthesisOptions.LanguageIdentificationMode;
+	}
+	else
+	{
+		Locale = InSynthesisOptions.Locale;
+		Voice = InSynthesisOptions.Voice;
+	}
+}
+
+bool FAzSpeechSynthesizerPoolKey::operator==(const FAzSpeechSynthesizerPoolKey& Other) const
+{
+	return SubscriptionKey.IsEqual(Other.SubscriptionKey, ENameCase::CaseSensitive) && RegionID == Other.RegionID && PrivateEndpoint == Other.
+		PrivateEndpoint && bUsePrivateEndpoint == Other.bUsePrivateEndpoint && Locale == Other.Locale && Voice == Other.Voice && OutputFormat == Other.
+		OutputFormat && ProfanityFilter == Other.ProfanityFilter && bUseLanguageIdentification == Other.bUseLanguageIdentification &&
+		LanguageIdentificationMode == Other.LanguageIdentificationMode && bIsSSMLBased == Other.bIsSSMLBased;
+}
+
+uint32 GetTypeHash(const FAzSpeechSynthesizerPoolKey& Key)
+{
+	uint32 Output = GetTypeHash(Key.SubscriptionKey);
+	Output = HashCombine(Output, GetTypeHash(Key.RegionID));
+	Output = HashCombine(Output, GetTypeHash(Key.PrivateEndpoint));
+	Output = HashCombine(Output, GetTypeHash(Key.Locale));
+	Output = HashCombine(Output, GetTypeHash(Key.Voice));
+	Output = HashCombine(Output, GetTypeHash(static_cast<uint8>(Key.OutputFormat)));
+	Output = HashCombine(Output, GetTypeHash(static_cast<uint8>(Key.ProfanityFilter)));
+	Output = HashCombine(Output, GetTypeHash(static_cast<uint8>(Key.LanguageIdentificationMode)));
+
+	const uint8 Flags = static_cast<uint8>(Key.bUsePrivateEndpoint) | static_cast<uint8>(Key.bUseLanguageIdentification) << 1 | static_cast<uint8>(Key.
+		bIsSSMLBased) << 2;
+
+	return HashCombine(Output, GetTypeHash(Flags));
+}
+
+FAzSpeechSynthesizerPool::FAzSpeechSynthesizerPool(const int32 InMaxPooledSynthesizers, const float InIdleTimeout, const bool bInPreConnect)
+	: MaxPooledSynthesizers(FMath::Max(1, InMaxPooledSynthesizers)), IdleTimeout(InIdleTimeout), bPreConnect(bInPreConnect)
+{
+}
+
+FAzSpeechSynthesizerPool::~FAzSpeechSynthesizerPool()
+{
+	Empty();
+}
+
+std::shared_ptr<MicrosoftSpeech::SpeechSynthesizer> FAzSpeechSynthesizerPool::Acquire(const FAzSpeechSynthesizerPoolKey& Key)
+{
+	FScopeLock Lock(&Mutex);
+
+	EvictIdleSynthesizers_Internal(FPlatformTime::Seconds());
+
+	TArray<FAzSpeechPooledSynthesizer>* const Items = PooledSynthesizers.Find(Key);
+	if (!Items || Items->IsEmpty())
+	{
+		UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: No pooled synthesizer available for voice '%s'."), *FString(__FUNCTION__), *Key.Voice.ToString());
+		return nullptr;
+	}
+
+	// The most recently used synthesizer has the highest chance of still being connected
+	const std::shared_ptr<MicrosoftSpeech::SpeechSynthesizer> Output = Items->Pop(false).Synthesizer;
+	--NumPooledSynthesizers;
+
+	if (Items->IsEmpty())
+	{
+		PooledSynthesizers.Remove(Key);
+	}
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Reusing pooled synthesizer for voice '%s'."), *FString(__FUNCTION__), *Key.Voice.ToString());
+
+	return Output;
+}
+
+void FAzSpeechSynthesizerPool::Release(const FAzSpeechSynthesizerPoolKey& Key, const std::shared_ptr<MicrosoftSpeech::SpeechSynthesizer>& Synthesizer,
+                                       const bool bIsNewSynthesizer)
+{
+	if (!Synthesizer)
+	{
+		return;
+	}
+
+	FAzSpeechPooledSynthesizer NewItem;
+	NewItem.Synthesizer = Synthesizer;
+
+	// Used to close the connection on eviction: Synthesizers keep their connection after stopping while they are pooled
+	NewItem.Connection = MicrosoftSpeech::Connection::FromSpeechSynthesizer(Synthesizer);
+
+	// Only opened once, when the synthesizer enters the pool: Reused synthesizers keep the connection of the previous task
+	if (bPreConnect && bIsNewSynthesizer && NewItem.Connection)
+	{
+		NewItem.Connection->Open(false);
+	}
+
+	FScopeLock Lock(&Mutex);
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	NewItem.LastUsedTime = CurrentTime;
+
+	EvictIdleSynthesizers_Internal(CurrentTime);
+
+	while (NumPooledSynthesizers >= MaxPooledSynthesizers)
+	{
+		EvictOldestSynthesizer_Internal();
+	}
+
+	PooledSynthesizers.FindOrAdd(Key).Add(MoveTemp(NewItem));
+	++NumPooledSynthesizers;
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("%s: Synthesizer for voice '%s' returned to the pool. Pooled synthesizers: %d"), *FString(__FUNCTION__),
+	       *Key.Voice.ToString(), NumPooledSynthesizers);
+}
+
+void FAzSpeechSynthesizerPool::EvictIdleSynthesizers()
+{
+	FScopeLock Lock(&Mutex);
+
+	EvictIdleSynthesizers_Internal(FPlatformTime::Seconds());
+}
+
+void FAzSpeechSynthesizerPool::Empty()
+{
+	FScopeLock Lock(&Mutex);
+
+	for (const TPair<FAzSpeechSynthesizerPoolKey, TArray<FAzSpeechPooledSynthesizer>>& Iterator : PooledSynthesizers)
+	{
+		for (const FAzSpeechPooledSynthesizer& Item : Iterator.Value)
+		{
+			CloseConnection(Item);
+		}
+	}
+
+	PooledSynthesizers.Empty();
+	NumPooledSynthesizers = 0;
+}
+
+const int32 FAzSpeechSynthesizerPool::Num() const
+{
+	FScopeLock Lock(&Mutex);
+
+	return NumPooledSynthesizers;
+}
+
+void FAzSpeechSynthesizerPool::EvictIdleSynthesizers_Internal(const double CurrentTime)
+{
+	if (IdleTimeout <= 0.f)
+	{
+		return;
+	}
+
+	for (auto Iterator = PooledSynthesizers.CreateIterator(); Iterator; ++Iterator)
+	{
+		const int32 RemovedNum = Iterator->Value.RemoveAll([this, CurrentTime](const FAzSpeechPooledSynthesizer& Item)
+		{
+			if (CurrentTime - Item.LastUsedTime < IdleTimeout)
+			{
+				return false;
+			}
+
+			CloseConnection(Item);
+			return true;
+		});
+
+		NumPooledSynthesizers -= RemovedNum;
+
+		if (Iterator->Value.IsEmpty())
+		{
+			Iterator.RemoveCurrent();
+		}
+	}
+}
+
+void FAzSpeechSynthesizerPool::EvictOldestSynthesizer_Internal()
+{
+	TArray<FAzSpeechPooledSynthesizer>* OldestItems = nullptr;
+	int32 OldestIndex = INDEX_NONE;
+	double OldestTime = TNumericLimits<double>::Max();
+
+	for (TPair<FAzSpeechSynthesizerPoolKey, TArray<FAzSpeechPooledSynthesizer>>& Iterator : PooledSynthesizers)
+	{
+		for (int32 Index = 0; Index < Iterator.Value.Num(); ++Index)
+		{
+			if (Iterator.Value[Index].LastUsedTime < OldestTime)
+			{
+				OldestItems = &Iterator.Value;
+				OldestIndex = Index;
+				OldestTime = Iterator.Value[Index].LastUsedTime;
+			}
+		}
+	}
+
+	if (!OldestItems)
+	{
+		NumPooledSynthesizers = 0;
+		return;
+	}
+
+	CloseConnection((*OldestItems)[OldestIndex]);
+	OldestItems->RemoveAt(OldestIndex);
+	--NumPooledSynthesizers;
+
+	for (auto Iterator = PooledSynthesizers.CreateIterator(); Iterator; ++Iterator)
+	{
+		if (Iterator->Value.IsEmpty())
+		{
+			Iterator.RemoveCurrent();
+		}
+	}
+}
+
+void FAzSpeechSynthesizerPool::CloseConnection(const FAzSpeechPooledSynthesizer& Item) const
+{
+	if (Item.Connection)
+	{
+		Item.Connection->Close();
+	}
+}
@@ -0,0 +1,120 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/Runnables/Synthesis/AzSpeechSynthesizerWarmUpRunnable.h"
+#include "AzSpeech/Tasks/Synthesis/WarmUpSynthesizerAsync.h"
+#include "LogAzSpeech.h"
+#include <future>
+
+THIRD_PARTY_INCLUDES_START
+#include <speechapi_cxx_connection.h>
+THIRD_PARTY_INCLUDES_END
+
+namespace MicrosoftSpeech = Microsoft::CognitiveServices::Speech;
+
+FAzSpeechSynthesizerWarmUpRunnable::FAzSpeechSynthesizerWarmUpRunnable(UAzSpeechTaskBase* const InOwningTask,
+                                                                       std::shared_ptr<MicrosoftSpeech::Audio::AudioConfig>&& InAudioConfig)
+	: FAzSpeechSynthesisRunnable(InOwningTask, std::move(InAudioConfig))
+{
+}
+
+uint32 FAzSpeechSynthesizerWarmUpRunnable::Run()
+{
+	if (!SynthesizerPool.IsValid())
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("Thread: %s; Function: %s; Message: Synthesizer pool is disabled: Nothing to warm up"), *GetThreadName(),
+		       *FString(__FUNCTION__));
+		return 0u;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	if (FAzSpeechRunnableBase::Run() == 0u)
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("Thread: %s; Function: %s; Message: Run returned 0"), *GetThreadName(), *FString(__FUNCTION__));
+		return 0u;
+	}
+
+	UWarmUpSynthesizerAsync* const WarmUpTask = GetOwningWarmUpTask();
+	if (!IsSpeechSynthesizerValid() || !UAzSpeechTaskStatus::IsTaskStillValid(WarmUpTask))
+	{
+		return 0u;
+	}
+
+	// A synthesizer taken from the pool is already connected: Just give it back in the exit
+	const bool bConnected = bUsingPooledSynthesizer || OpenSynthesizerConnection();
+	const float WarmUpTime = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	UE_LOG(LogAzSpeech_Debugging, Display, TEXT("Thread: %s; Function: %s; Message: Warm up %s in %.3f ms"), *GetThreadName(), *FString(__FUNCTION__),
+	       bConnected ? TEXT("succeeded") : TEXT("failed"), WarmUpTime);
+
+	WarmUpTask->WarmUpTime = WarmUpTime;
+	WarmUpTask->bWarmUpSucceeded = bConnected;
+
+	bCanReleaseSynthesizer = bConnected;
+	bSynthesizerConnected = bConnected;
+	StopAzSpeechRunnableTask();
+
+	return WaitForPendingStop();
+}
+
+const bool FAzSpeechSynthesizerWarmUpRunnable::OpenSynthesizerConnection() const
+{
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("Thread: %s; Function: %s; Message: Opening synthesizer connection"), *GetThreadName(),
+	       *FString(__FUNCTION__));
+
+	const std::shared_ptr<MicrosoftSpeech::Connection> Connection = MicrosoftSpeech::Connection::FromSpeechSynthesizer(SpeechSynthesizer);
+	if (!Connection)
+	{
+		return false;
+	}
+
+	// The signals can be called from any SDK thread and more than once: Only the first one sets the result
+	const auto ConnectionPromise = std::make_shared<std::promise<bool>>();
+	const auto bPromiseSet = std::make_shared<std::atomic<bool>>(false);
+
+	const auto SetConnectionResult_Lambda = [ConnectionPromise, bPromiseSet](const bool bResult)
+	{
+		if (!bPromiseSet->exchange(true))
+		{
+			ConnectionPromise->set_value(bResult);
+		}
+	};
+
+	Connection->Connected.Connect([SetConnectionResult_Lambda]([[maybe_unused]] const MicrosoftSpeech::ConnectionEventArgs& EventArgs)
+	{
+		SetConnectionResult_Lambda(true);
+	});
+
+	Connection->Disconnected.Connect([SetConnectionResult_Lambda]([[maybe_unused]] const MicrosoftSpeech::ConnectionEventArgs& EventArgs)
+	{
+		SetConnectionResult_Lambda(false);
+	});
+
+	std::future<bool> Future = ConnectionPromise->get_future();
+	Connection->Open(false);
+
+	const bool bOutput = Future.wait_for(GetTaskTimeout()) == std::future_status::ready && Future.get();
+
+	Connection->Connected.DisconnectAll();
+	Connection->Disconnected.DisconnectAll();
+
+	if (!bOutput)
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("Thread: %s; Function: %s; Message: Failed to open synthesizer connection"), *GetThreadName(),
+		       *FString(__FUNCTION__));
+	}
+
+	return bOutput;
+}
+
+UWarmUpSynthesizerAsync* FAzSpeechSynthesizerWarmUpRunnable::GetOwningWarmUpTask() const
+{
+	if (!GetOwningTask())
+	{
+		return nullptr;
+	}
+
+	return Cast<UWarmUpSynthesizerAsync>(GetOwningTask());
+}
@@ -112,6 +112,10 @@ void FAzSpeechRecognitionOptions::SetDefaults()
 		SegmentationSilenceTimeoutMs = Settings->DefaultOptions.RecognitionOptions.SegmentationSilenceTimeoutMs;
 		InitialSilenceTimeoutMs = Settings->DefaultOptions.RecognitionOptions.InitialSilenceTimeoutMs;
 		KeywordRecognitionModelPath = Settings->DefaultOptions.RecognitionOptions.KeywordRecognitionModelPath;
+		AudioInputMode = Settings->DefaultOptions.RecognitionOptions.AudioInputMode;
+		bEnableVoiceActivityDetection = Settings->DefaultOptions.RecognitionOptions.bEnableVoiceActivityDetection;
+		VoiceActivityThresholdDb = Settings->DefaultOptions.RecognitionOptions.VoiceActivityThresholdDb;
+		VoiceActivityHangoverMs = Settings->DefaultOptions.RecognitionOptions.VoiceActivityHangoverMs;
 	}
 }
 
@@ -171,5 +175,6 @@ void FAzSpeechSynthesisOptions::SetDefaults()
 		bUseLanguageIdentification = Settings->DefaultOptions.SynthesisOptions.bUseLanguageIdentification;
 		ProfanityFilter = Settings->DefaultOptions.SynthesisOptions.ProfanityFilter;
 		LanguageIdentificationMode = Settings->DefaultOptions.SynthesisOptions.LanguageIdentificationMode;
+		bEnableStreamingPlayback = Settings->DefaultOptions.SynthesisOptions.bEnableStreamingPlayback;
 	}
 }
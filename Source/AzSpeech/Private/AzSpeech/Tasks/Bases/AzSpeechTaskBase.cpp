@@ -10,7 +10,6 @@
 #include "AzSpeech/Structures/AzSpeechTaskData.h"
 #include "AzSpeechInternalFuncs.h"
 #include "LogAzSpeech.h"
-#include <Misc/ScopeTryLock.h>
 
 #if WITH_EDITOR
 #include <Editor.h>
@@ -41,7 +40,12 @@ void UAzSpeechTaskBase::Activate()
 	UE_LOG(LogAzSpeech, Display, TEXT("Task: %s (%d); Function: %s; Message: Activating task"), *TaskName.ToString(), GetUniqueID(),
 	       *FString(__FUNCTION__));
 
-	bIsTaskActive = true;
+	if (!TrySetTaskState(EAzSpeechTaskState::Inactive, EAzSpeechTaskState::Active))
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("Task: %s (%d); Function: %s; Message: Task was already activated"), *TaskName.ToString(),
+		       GetUniqueID(), *FString(__FUNCTION__));
+		return;
+	}
 
 	Super::Activate();
 
@@ -54,6 +58,12 @@ void UAzSpeechTaskBase::Activate()
 		return;
 	}
 
+	// Tasks completed with a cached result finish during the activation: There's nothing left to track
+	if (UAzSpeechTaskStatus::IsTaskReadyToDestroy(this))
+	{
+		return;
+	}
+
 	if (const UAzSpeechEngineSubsystem* const Subsystem = GEngine->GetEngineSubsystem<UAzSpeechEngineSubsystem>())
 	{
 		Subsystem->RegisterAzSpeechTask(this);
@@ -73,16 +83,13 @@ void UAzSpeechTaskBase::Activate()
 
 void UAzSpeechTaskBase::StopAzSpeechTask()
 {
-	const FScopeTryLock TryLock(&Mutex);
-
-	if (!TryLock.IsLocked() || !UAzSpeechTaskStatus::IsTaskActive(this) || UAzSpeechTaskStatus::IsTaskReadyToDestroy(this))
+	if (!IsValid(this) || !TrySetTaskState(EAzSpeechTaskState::Active, EAzSpeechTaskState::Finished))
 	{
 		return;
 	}
 
 	UE_LOG(LogAzSpeech, Display, TEXT("Task: %s (%d); Function: %s; Message: Stopping task"), *TaskName.ToString(), GetUniqueID(),
 	       *FString(__FUNCTION__));
-	bIsTaskActive = false;
 
 	if (RunnableTask.IsValid())
 	{
@@ -116,12 +123,16 @@ void UAzSpeechTaskBase::SetSubscriptionOptions(const FAzSpeechSubscriptionOption
 
 void UAzSpeechTaskBase::SetReadyToDestroy()
 {
-	const FScopeTryLock TryLock(&Mutex);
-
-	if (!TryLock.IsLocked() || UAzSpeechTaskStatus::IsTaskReadyToDestroy(this))
+	// Only the first caller runs the destruction, even if it's called again by the delegates below
+	EAzSpeechTaskState CurrentState = GetTaskState();
+	do
 	{
-		return;
+		if (CurrentState == EAzSpeechTaskState::Destroying || CurrentState == EAzSpeechTaskState::ReadyToDestroy)
+		{
+			return;
+		}
 	}
+	while (!TaskState.compare_exchange_weak(CurrentState, EAzSpeechTaskState::Destroying));
 
 	InternalOnTaskFinished.ExecuteIfBound(FAzSpeechTaskData{GetUniqueID(), GetClass()});
 	InternalOnTaskFinished.Unbind();
@@ -133,7 +144,7 @@ void UAzSpeechTaskBase::SetReadyToDestroy()
 
 	UE_LOG(LogAzSpeech, Display, TEXT("Task: %s (%d); Function: %s; Message: Setting task as Ready to Destroy"), *TaskName.ToString(), GetUniqueID(),
 	       *FString(__FUNCTION__));
-	bIsReadyToDestroy = true;
+	TaskState = EAzSpeechTaskState::ReadyToDestroy;
 
 #if WITH_EDITOR
 	if (bIsEditorTask)
@@ -175,7 +186,7 @@ void UAzSpeechTaskBase::BroadcastFinalResult()
 
 	FScopeLock Lock(&Mutex);
 
-	if (!bIsTaskActive)
+	if (!TrySetTaskState(EAzSpeechTaskState::Active, EAzSpeechTaskState::Finished))
 	{
 		return;
 	}
@@ -185,8 +196,16 @@ void UAzSpeechTaskBase::BroadcastFinalResult()
 
 	UE_LOG(LogAzSpeech_Internal, Display, TEXT("Task: %s (%d); Function: %s; Message: Task completed, broadcasting final result"),
 	       *TaskName.ToString(), GetUniqueID(), *FString(__FUNCTION__));
+}
 
-	bIsTaskActive = false;
+const bool UAzSpeechTaskBase::TrySetTaskState(EAzSpeechTaskState ExpectedState, const EAzSpeechTaskState NewState)
+{
+	return TaskState.compare_exchange_strong(ExpectedState, NewState);
+}
+
+const EAzSpeechTaskState UAzSpeechTaskBase::GetTaskState() const
+{
+	return TaskState.load();
 }
 
 #if WITH_EDITOR
@@ -207,12 +226,12 @@ void UAzSpeechTaskBase::PrePIEEnded(bool bIsSimulating)
 
 bool UAzSpeechTaskStatus::IsTaskActive(const UAzSpeechTaskBase* const Test)
 {
-	return IsValid(Test) && Test->bIsTaskActive;
+	return IsValid(Test) && Test->GetTaskState() == EAzSpeechTaskState::Active;
 }
 
 bool UAzSpeechTaskStatus::IsTaskReadyToDestroy(const UAzSpeechTaskBase* const Test)
 {
-	return IsValid(Test) && Test->bIsReadyToDestroy;
+	return IsValid(Test) && Test->GetTaskState() == EAzSpeechTaskState::ReadyToDestroy;
 }
 
 bool UAzSpeechTaskStatus::IsTaskStillValid(const UAzSpeechTaskBase* const Test)
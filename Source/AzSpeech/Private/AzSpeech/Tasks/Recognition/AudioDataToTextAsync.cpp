@@ -0,0 +1,162 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/Tasks/Recognition/AudioDataToTextAsync.h"
+#include "AzSpeechInternalFuncs.h"
+#include "LogAzSpeech.h"
+#include <Audio.h>
+
+THIRD_PARTY_INCLUDES_START
+#include <speechapi_cxx_audio_stream.h>
+THIRD_PARTY_INCLUDES_END
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AudioDataToTextAsync)
+#endif
+
+namespace MicrosoftSpeech = Microsoft::CognitiveServices::Speech;
+
+UAudioDataToTextAsync* UAudioDataToTextAsync::AudioDataToText_DefaultOptions(UObject* const WorldContextObject, const TArray<uint8>& AudioData,
+                                                                             const FString& Locale, const FName& PhraseListGroup)
+{
+	return AudioDataToText_CustomOptions(WorldContextObject, FAzSpeechSubscriptionOptions(), FAzSpeechRecognitionOptions(*Locale), AudioData,
+	                                     PhraseListGroup);
+}
+
+UAudioDataToTextAsync* UAudioDataToTextAsync::AudioDataToText_CustomOptions(UObject* const WorldContextObject,
+                                                                            const FAzSpeechSubscriptionOptions& SubscriptionOptions,
+                                                                            const FAzSpeechRecognitionOptions& RecognitionOptions,
+                                                                            const TArray<uint8>& AudioData, const FName& PhraseListGroup)
+{
+	// Blueprint arrays are owned by the graph: This is the only copy of the data until it's read by the SDK
+	if (AudioData.Num() > 0)
+	{
+		FAzSpeechAudioBuffer::RegisterCopy(AudioData.Num());
+	}
+
+	return AudioBufferToText(WorldContextObject, SubscriptionOptions, RecognitionOptions, FAzSpeechAudioBuffer::FromArray(TArray<uint8>(AudioData)),
+	                         PhraseListGroup);
+}
+
+UAudioDataToTextAsync* UAudioDataToTextAsync::AudioBufferToText(UObject* const WorldContextObject,
+                                                                const FAzSpeechSubscriptionOptions& SubscriptionOptions,
+                                                                const FAzSpeechRecognitionOptions& RecognitionOptions,
+                                                                const FAzSpeechAudioBuffer& AudioData, const FName& PhraseListGroup)
+{
+	UAudioDataToTextAsync* const NewAsyncTask = NewObject<UAudioDataToTextAsync>();
+	NewAsyncTask->SubscriptionOptions = SubscriptionOptions;
+	NewAsyncTask->RecognitionOptions = RecognitionOptions;
+	NewAsyncTask->AudioData = AudioData;
+	NewAsyncTask->PhraseListGroup = PhraseListGroup;
+	NewAsyncTask->bIsSSMLBased = false;
+	NewAsyncTask->TaskName = *FString(__FUNCTION__);
+
+	NewAsyncTask->RegisterWithGameInstance(WorldContextObject);
+
+	return NewAsyncTask;
+}
+
+bool UAudioDataToTextAsync::StartAzureTaskWork()
+{
+	if (!Super::StartAzureTaskWork())
+	{
+		return false;
+	}
+
+	if (AzSpeech::Internal::HasEmptyParam(GetRecognitionOptions().Locale))
+	{
+		return false;
+	}
+
+	if (AudioData.IsEmpty())
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("Task: %s (%d); Function: %s; Message: Audio data is empty"), *TaskName.ToString(), GetUniqueID(),
+		       *FString(__FUNCTION__));
+		return false;
+	}
+
+	auto AudioConfig = CreateAudioDataConfig();
+	if (!AudioConfig)
+	{
+		return false;
+	}
+
+	StartRecognitionWork(std::move(AudioConfig));
+
+	return true;
+}
+
+std::shared_ptr<MicrosoftSpeech::Audio::AudioConfig> UAudioDataToTextAsync::CreateAudioDataConfig() const
+{
+	const uint8* SampleData = AudioData.GetData();
+	int32 SampleDataSize = AudioData.Num();
+
+	// Data without a riff header is considered raw PCM in the default format of the SDK
+	uint32 SampleRate = 16000u;
+	uint16 BitsPerSample = 16u;
+	uint16 NumChannels = 1u;
+
+	if (SampleDataSize > 4 && FMemory::Memcmp(SampleData, "RIFF", 4) == 0)
+	{
+		FWaveModInfo WaveInfo;
+		if (!WaveInfo.ReadWaveInfo(SampleData, SampleDataSize, nullptr, true))
+		{
+			UE_LOG(LogAzSpeech_Internal, Error, TEXT("Task: %s (%d); Function: %s; Message: Failed to read the wav header"), *TaskName.ToString(),
+			       GetUniqueID(), *FString(__FUNCTION__));
+			return nullptr;
+		}
+
+		if (*WaveInfo.pFormatTag != 1u)
+		{
+			UE_LOG(LogAzSpeech_Internal, Error, TEXT("Task: %s (%d); Function: %s; Message: Only PCM wav data is supported. Format tag: %d"),
+			       *TaskName.ToString(), GetUniqueID(), *FString(__FUNCTION__), *WaveInfo.pFormatTag);
+			return nullptr;
+		}
+
+		SampleRate = *WaveInfo.pSamplesPerSec;
+		BitsPerSample = *WaveInfo.pBitsPerSample;
+		NumChannels = *WaveInfo.pChannels;
+
+		// Streamed wav files may have an unknown data size in the header: Only the available data is read
+		const int32 HeaderSize = static_cast<int32>(WaveInfo.SampleDataStart - SampleData);
+		SampleDataSize = static_cast<int32>(FMath::Min<int64>(WaveInfo.SampleDataSize, SampleDataSize - HeaderSize));
+		SampleData = WaveInfo.SampleDataStart;
+	}
+
+	if (BitsPerSample != 16u || NumChannels != 1u)
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("Task: %s (%d); Function: %s; Message: Only 16 bits mono PCM is supported. Bits per sample: %d; Channels: %d"),
+		       *TaskName.ToString(), GetUniqueID(), *FString(__FUNCTION__), BitsPerSample, NumChannels);
+		return nullptr;
+	}
+
+	if (SampleDataSize <= 0)
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("Task: %s (%d); Function: %s; Message: Audio data has no samples"), *TaskName.ToString(),
+		       GetUniqueID(), *FString(__FUNCTION__));
+		return nullptr;
+	}
+
+	// The callback keeps a reference to the buffer: The SDK reads the samples from the same memory, even if the task is destroyed first
+	auto ReadCallback = [Owner = AudioData, SampleData, SampleDataSize, Position = 0](uint8_t* const Buffer, const uint32_t Size) mutable -> int
+	{
+		const int32 NumBytes = FMath::Min(static_cast<int32>(FMath::Min<uint32>(Size, MAX_int32)), SampleDataSize - Position);
+		if (NumBytes <= 0)
+		{
+			// Zero bytes signals the end of the stream
+			return 0;
+		}
+
+		FMemory::Memcpy(Buffer, SampleData + Position, NumBytes);
+		Position += NumBytes;
+
+		return NumBytes;
+	};
+
+	const auto StreamFormat = MicrosoftSpeech::Audio::AudioStreamFormat::GetWaveFormatPCM(SampleRate, static_cast<uint8_t>(BitsPerSample),
+	                                                                                        static_cast<uint8_t>(NumChannels));
+	const auto PullStream = MicrosoftSpeech::Audio::AudioInputStream::CreatePullStream(StreamFormat, std::move(ReadCallback));
+
+	return MicrosoftSpeech::Audio::AudioConfig::FromStreamInput(PullStream);
+}
@@ -5,6 +5,7 @@
 #include "AzSpeech/Tasks/Recognition/Bases/AzSpeechRecognizerTaskBase.h"
 #include "AzSpeech/Runnables/Recognition/AzSpeechRecognitionRunnable.h"
 #include "AzSpeech/AzSpeechSettings.h"
+#include "AzSpeech/AzSpeechMicrophoneCapture.h"
 #include "LogAzSpeech.h"
 #include <Async/Async.h>
 
@@ -37,28 +38,34 @@ void UAzSpeechRecognizerTaskBase::SetRecognitionOptions(const FAzSpeechRecogniti
 
 const FString UAzSpeechRecognizerTaskBase::GetRecognizedString() const
 {
-	FScopeLock Lock(&Mutex);
-
-	if (RecognizedText.empty())
-	{
-		return FString();
-	}
-
-	return FString(UTF8_TO_TCHAR(RecognizedText.c_str()));
+	return GetRecognitionResult()->RecognizedString;
 }
 
 const int64 UAzSpeechRecognizerTaskBase::GetRecognitionDuration() const
 {
-	FScopeLock Lock(&Mutex);
-
-	return RecognitionDuration;
+	return GetRecognitionResult()->RecognitionDuration;
 }
 
 const int32 UAzSpeechRecognizerTaskBase::GetRecognitionLatency() const
 {
-	FScopeLock Lock(&Mutex);
+	return GetRecognitionResult()->RecognitionLatency;
+}
 
-	return RecognitionLatency;
+const std::shared_ptr<const FAzSpeechRecognitionResultSnapshot> UAzSpeechRecognizerTaskBase::GetRecognitionResult() const
+{
+	return std::atomic_load_explicit(&RecognitionResult, std::memory_order_acquire);
+}
+
+void UAzSpeechRecognizerTaskBase::SetReadyToDestroy()
+{
+	// Closing the push stream also ends the recognition of the remaining audio
+	if (MicrophoneCapture.IsValid())
+	{
+		MicrophoneCapture->Stop();
+		MicrophoneCapture.Reset();
+	}
+
+	Super::SetReadyToDestroy();
 }
 
 void UAzSpeechRecognizerTaskBase::StartRecognitionWork(std::shared_ptr<Microsoft::CognitiveServices::Speech::Audio::AudioConfig>&& InAudioConfig)
@@ -74,6 +81,39 @@ void UAzSpeechRecognizerTaskBase::StartRecognitionWork(std::shared_ptr<Microsoft
 	RunnableTask->StartAzSpeechRunnableTask();
 }
 
+std::shared_ptr<MicrosoftSpeech::Audio::AudioConfig> UAzSpeechRecognizerTaskBase::CreateMicrophoneAudioConfig(
+	const FAzSpeechAudioInputDeviceInfo& DeviceInfo, const bool bUseDefaultDevice)
+{
+	if (GetRecognitionOptions().AudioInputMode == EAzSpeechAudioInputMode::SDKMicrophone)
+	{
+		return bUseDefaultDevice
+			       ? MicrosoftSpeech::Audio::AudioConfig::FromDefaultMicrophoneInput()
+			       : MicrosoftSpeech::Audio::AudioConfig::FromMicrophoneInput(TCHAR_TO_UTF8(*DeviceInfo.GetAudioInputDeviceEndpointID()));
+	}
+
+	FAzSpeechVoiceActivitySettings VoiceActivitySettings;
+	VoiceActivitySettings.SampleRate = FAzSpeechMicrophoneCapture::StreamSampleRate;
+	VoiceActivitySettings.EnergyThresholdDb = GetRecognitionOptions().VoiceActivityThresholdDb;
+
+	// The service needs to receive the silence after the speech to complete the phrase
+	VoiceActivitySettings.HangoverMs = FMath::Max(GetRecognitionOptions().VoiceActivityHangoverMs,
+	                                              GetRecognitionOptions().SegmentationSilenceTimeoutMs + VoiceActivitySettings.FrameDurationMs);
+
+	MicrophoneCapture = MakeShared<FAzSpeechMicrophoneCapture, ESPMode::ThreadSafe>(GetRecognitionOptions().bEnableVoiceActivityDetection,
+	                                                                                VoiceActivitySettings);
+
+	if (!MicrophoneCapture->Start(bUseDefaultDevice ? FString() : DeviceInfo.GetDeviceID()))
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("Task: %s (%d); Function: %s; Message: Failed to start the engine audio capture"), *TaskName.ToString(),
+		       GetUniqueID(), *FString(__FUNCTION__));
+
+		MicrophoneCapture.Reset();
+		return nullptr;
+	}
+
+	return MicrophoneCapture->GetAudioConfig();
+}
+
 void UAzSpeechRecognizerTaskBase::BroadcastFinalResult()
 {
 	FScopeLock Lock(&Mutex);
@@ -96,26 +136,27 @@ void UAzSpeechRecognizerTaskBase::OnRecognitionUpdated(const std::shared_ptr<Mic
 {
 	check(IsInGameThread());
 
-	FScopeLock Lock(&Mutex);
-
-	RecognizedText = LastResult->Text;
-
 	const auto TicksToMs = [](const auto& Ticks)
 	{
 		return static_cast<int64>(Ticks / 10000u);
 	};
 
-	RecognitionDuration = TicksToMs(LastResult->Duration());
-	RecognitionLatency = GetProperty<int32>(LastResult, MicrosoftSpeech::PropertyId::SpeechServiceResponse_RecognitionLatencyMs);
+	// The text is converted only once here: Readers get the same string until the next update is published
+	const std::shared_ptr<FAzSpeechRecognitionResultSnapshot> NewResult = std::make_shared<FAzSpeechRecognitionResultSnapshot>();
+	NewResult->RecognizedString = UTF8_TO_TCHAR(LastResult->Text.c_str());
+	NewResult->RecognitionDuration = TicksToMs(LastResult->Duration());
+	NewResult->RecognitionLatency = GetProperty<int32>(LastResult, MicrosoftSpeech::PropertyId::SpeechServiceResponse_RecognitionLatencyMs);
+
+	std::atomic_store_explicit(&RecognitionResult, std::shared_ptr<const FAzSpeechRecognitionResultSnapshot>(NewResult), std::memory_order_release);
 
-	RecognitionUpdated.Broadcast(GetRecognizedString());
+	RecognitionUpdated.Broadcast(NewResult->RecognizedString);
 
 	if (UAzSpeechSettings::Get()->bEnableDebuggingLogs || UAzSpeechSettings::Get()->bEnableDebuggingPrints)
 	{
 		const FStringFormatOrderedArguments Arguments{
-			TaskName.ToString(), GetUniqueID(), FString(__func__), FString(UTF8_TO_TCHAR(LastResult->Text.c_str())), RecognitionDuration,
+			TaskName.ToString(), GetUniqueID(), FString(__func__), NewResult->RecognizedString, NewResult->RecognitionDuration,
 			TicksToMs(LastResult->Offset()), static_cast<int32>(LastResult->Reason), FString(UTF8_TO_TCHAR(LastResult->ResultId.c_str())),
-			RecognitionLatency
+			NewResult->RecognitionLatency
 		};
 
 		const FString MountedDebuggingInfo = FString::Format(
@@ -79,9 +79,12 @@ bool USpeechToTextAsync::StartAzureTaskWork()
 	UE_LOG(LogAzSpeech_Internal, Display, TEXT("Task: %s (%d); Function: %s; Message: Using audio input device: %s"), *TaskName.ToString(),
 	       GetUniqueID(), *FString(__FUNCTION__), IsUsingDefaultAudioInputDevice() ? *FString("Default") : *DeviceInfo.GetAudioInputDeviceEndpointID());
 
-	auto AudioConfig = IsUsingDefaultAudioInputDevice()
-		                   ? MicrosoftSpeech::Audio::AudioConfig::FromDefaultMicrophoneInput()
-		                   : MicrosoftSpeech::Audio::AudioConfig::FromMicrophoneInput(TCHAR_TO_UTF8(*DeviceInfo.GetAudioInputDeviceEndpointID()));
+	auto AudioConfig = CreateMicrophoneAudioConfig(DeviceInfo, IsUsingDefaultAudioInputDevice());
+	if (!AudioConfig)
+	{
+		return false;
+	}
+
 	StartRecognitionWork(std::move(AudioConfig));
 
 	return true;
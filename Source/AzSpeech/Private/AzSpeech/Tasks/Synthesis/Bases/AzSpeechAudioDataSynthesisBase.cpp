@@ -28,3 +28,13 @@ bool UAzSpeechAudioDataSynthesisBase::StartAzureTaskWork()
 
 	return true;
 }
+
+const bool UAzSpeechAudioDataSynthesisBase::CanUseSynthesizerPool() const
+{
+	return true;
+}
+
+const bool UAzSpeechAudioDataSynthesisBase::CanUseSynthesisCache() const
+{
+	return true;
+}
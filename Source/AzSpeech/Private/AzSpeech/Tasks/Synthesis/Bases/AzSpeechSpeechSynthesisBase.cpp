@@ -5,9 +5,13 @@
 #include "AzSpeech/Tasks/Synthesis/Bases/AzSpeechSpeechSynthesisBase.h"
 #include "AzSpeech/Structures/AzSpeechTaskData.h"
 #include "AzSpeech/AzSpeechHelper.h"
+#include "AzSpeechInternalFuncs.h"
+#include "LogAzSpeech.h"
 #include <Components/AudioComponent.h>
 #include <Kismet/GameplayStatics.h>
 #include <Sound/SoundWave.h>
+#include <Sound/SoundWaveProcedural.h>
+#include <Audio.h>
 #include <Async/Async.h>
 
 #ifdef UE_INLINE_GENERATED_CPP_BY_NAME
@@ -18,11 +22,15 @@ void UAzSpeechSpeechSynthesisBase::StopAzSpeechTask()
 {
 	Super::StopAzSpeechTask();
 
+	PlaybackStartTime = -1.0;
+
 	if (!AudioComponent.IsValid())
 	{
 		return;
 	}
 
+	UnbindPlaybackPercent();
+
 	if (AudioComponent->IsPlaying())
 	{
 		AudioComponent->Stop();
@@ -40,9 +48,22 @@ void UAzSpeechSpeechSynthesisBase::SetReadyToDestroy()
 		return;
 	}
 
+	UnbindPlaybackPercent();
+
 	Super::SetReadyToDestroy();
 }
 
+const float UAzSpeechSpeechSynthesisBase::GetPlaybackTimeMilliseconds() const
+{
+	const double StartTime = PlaybackStartTime.load(std::memory_order_relaxed);
+	if (StartTime < 0.0)
+	{
+		return -1.f;
+	}
+
+	return static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
 void UAzSpeechSpeechSynthesisBase::BroadcastFinalResult()
 {
 	FScopeLock Lock(&Mutex);
@@ -56,7 +77,12 @@ void UAzSpeechSpeechSynthesisBase::BroadcastFinalResult()
 
 	AsyncTask(ENamedThreads::GameThread, [this]
 	{
-		if (bAutoPlayAudio)
+		if (StreamingSoundWave.IsValid())
+		{
+			// The audio is already playing: Stop it as soon as the queued chunks are consumed
+			bStreamingInputFinished = true;
+		}
+		else if (bAutoPlayAudio)
 		{
 			PlayAudio();
 		}
@@ -65,6 +91,29 @@ void UAzSpeechSpeechSynthesisBase::BroadcastFinalResult()
 	});
 }
 
+void UAzSpeechSpeechSynthesisBase::OnSynthesisAudioChunk(const FAzSpeechAudioBuffer& ChunkData)
+{
+	Super::OnSynthesisAudioChunk(ChunkData);
+
+	if (!bAutoPlayAudio || !GetSynthesisOptions().bEnableStreamingPlayback || ChunkData.IsEmpty())
+	{
+		return;
+	}
+
+	if (!bStreamingPlaybackStarted)
+	{
+		bStreamingPlaybackStarted = true;
+		StartStreamingPlayback();
+	}
+
+	if (!StreamingSoundWave.IsValid())
+	{
+		return;
+	}
+
+	UAzSpeechHelper::QueueStreamingAudioChunk(StreamingSoundWave.Get(), ChunkData);
+}
+
 void UAzSpeechSpeechSynthesisBase::OnAudioPlayStateChanged(const EAudioComponentPlayState PlayState)
 {
 	FScopeLock Lock(&Mutex);
@@ -76,6 +125,9 @@ void UAzSpeechSpeechSynthesisBase::OnAudioPlayStateChanged(const EAudioComponent
 
 	if (PlayState == EAudioComponentPlayState::Stopped)
 	{
+		PlaybackStartTime = -1.0;
+		UnbindPlaybackPercent();
+
 		InternalAudioFinished.ExecuteIfBound(FAzSpeechTaskData{GetUniqueID(), GetClass()});
 		InternalAudioFinished.Unbind();
 
@@ -83,21 +135,95 @@ void UAzSpeechSpeechSynthesisBase::OnAudioPlayStateChanged(const EAudioComponent
 	}
 }
 
+void UAzSpeechSpeechSynthesisBase::OnAudioPlaybackPercent([[maybe_unused]] const UAudioComponent* InAudioComponent, const USoundWave* InSoundWave,
+                                                          const float Percent)
+{
+	// Streamed audio has no known duration: Keep the clock started with the playback
+	if (!InSoundWave || InSoundWave->Duration <= 0.f || InSoundWave->Duration >= INDEFINITELY_LOOPING_DURATION)
+	{
+		return;
+	}
+
+	// Re-sync the clock with the position reported by the audio component to absorb the audio device latency
+	PlaybackStartTime = FPlatformTime::Seconds() - static_cast<double>(Percent * InSoundWave->Duration);
+}
+
 void UAzSpeechSpeechSynthesisBase::PlayAudio()
 {
 	check(IsInGameThread());
 
-	AudioComponent = UGameplayStatics::CreateSound2D(WorldContextObject.Get(), UAzSpeechHelper::ConvertAudioDataToSoundWave(GetAudioData()));
+	if (!PlaySound(UAzSpeechHelper::ConvertAudioBufferToTransientSoundWave(GetAudioBuffer())))
+	{
+		SetReadyToDestroy();
+	}
+}
+
+const bool UAzSpeechSpeechSynthesisBase::PlaySound(USoundWave* const SoundWave)
+{
+	// A previous component (e.g. the streaming playback) must not keep updating the playback clock
+	UnbindPlaybackPercent();
+
+	AudioComponent = UGameplayStatics::CreateSound2D(WorldContextObject.Get(), SoundWave);
 
 	if (!AudioComponent.IsValid())
 	{
-		SetReadyToDestroy();
-		return;
+		return false;
 	}
 
 	FScriptDelegate UniqueDelegate_AudioStateChanged;
 	UniqueDelegate_AudioStateChanged.BindUFunction(this, TEXT("OnAudioPlayStateChanged"));
 	AudioComponent->OnAudioPlayStateChanged.AddUnique(UniqueDelegate_AudioStateChanged);
+	AudioComponent->OnAudioPlaybackPercentNative.RemoveAll(this);
+	AudioComponent->OnAudioPlaybackPercentNative.AddUObject(this, &UAzSpeechSpeechSynthesisBase::OnAudioPlaybackPercent);
 
 	AudioComponent->Play();
+	PlaybackStartTime = FPlatformTime::Seconds();
+
+	return true;
+}
+
+void UAzSpeechSpeechSynthesisBase::UnbindPlaybackPercent()
+{
+	if (AudioComponent.IsValid())
+	{
+		AudioComponent->OnAudioPlaybackPercentNative.RemoveAll(this);
+	}
+}
+
+void UAzSpeechSpeechSynthesisBase::StartStreamingPlayback()
+{
+	check(IsInGameThread());
+
+	USoundWaveProcedural* const SoundWave = UAzSpeechHelper::CreateStreamingSoundWave(
+		AzSpeech::Internal::GetSampleRate(GetSynthesisOptions().SpeechSynthesisOutputFormat));
+	SoundWave->OnSoundWaveProceduralUnderflow.BindUObject(this, &UAzSpeechSpeechSynthesisBase::OnStreamingAudioUnderflow);
+
+	StreamingSoundWave = SoundWave;
+
+	if (!PlaySound(SoundWave))
+	{
+		// The final result will fall back to the default playback
+		StreamingSoundWave.Reset();
+		return;
+	}
+
+	UE_LOG(LogAzSpeech_Debugging, Display, TEXT("Task: %s (%d); Function: %s; Message: Streaming playback started after %d ms"), *TaskName.ToString(),
+	       GetUniqueID(), *FString(__FUNCTION__), GetTimeToFirstAudio());
+}
+
+void UAzSpeechSpeechSynthesisBase::OnStreamingAudioUnderflow(USoundWaveProcedural* InProceduralWave, [[maybe_unused]] const int32 SamplesRequired)
+{
+	// Called from the audio render thread: The underflow is only the end of the audio after the complete result is received
+	if (!bStreamingInputFinished || InProceduralWave->GetAvailableAudioByteCount() > 0 || bStreamingStopRequested.exchange(true))
+	{
+		return;
+	}
+
+	AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UAzSpeechSpeechSynthesisBase>(this)]
+	{
+		if (WeakThis.IsValid() && WeakThis->AudioComponent.IsValid() && WeakThis->AudioComponent->IsPlaying())
+		{
+			WeakThis->AudioComponent->Stop();
+		}
+	});
 }
@@ -4,14 +4,14 @@
 
 #include "AzSpeech/Tasks/Synthesis/Bases/AzSpeechSynthesizerTaskBase.h"
 #include "AzSpeech/Runnables/Synthesis/AzSpeechSynthesisRunnable.h"
+#include "AzSpeech/Cache/AzSpeechSynthesisCache.h"
+#include "AzSpeech/Cache/AzSpeechSynthesisDiskCache.h"
+#include "AzSpeech/AzSpeechEngineSubsystem.h"
 #include "AzSpeech/AzSpeechSettings.h"
-#include "AzSpeech/AzSpeechHelper.h"
-#include "AzSpeechInternalFuncs.h"
 #include "LogAzSpeech.h"
 
-#if !UE_BUILD_SHIPPING
 #include <Engine/Engine.h>
-#endif
+#include <Async/Async.h>
 
 #ifdef UE_INLINE_GENERATED_CPP_BY_NAME
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechSynthesizerTaskBase)
@@ -19,61 +19,90 @@
 
 namespace MicrosoftSpeech = Microsoft::CognitiveServices::Speech;
 
+const FAzSpeechVisemeTrack FAzSpeechSynthesisResultSnapshot::GetVisemeTrack() const
+{
+	FAzSpeechVisemeTrack Output;
+	VisemeBatches.ForEach([&Output](const FAzSpeechVisemeTrack& VisemeBatch)
+	{
+		Output.Append(VisemeBatch);
+	});
+
+	return Output;
+}
+
 const FAzSpeechVisemeData UAzSpeechSynthesizerTaskBase::GetLastVisemeData() const
 {
-	FScopeLock Lock(&Mutex);
+	const std::shared_ptr<const FAzSpeechSynthesisResultSnapshot> Result = GetSynthesisResult();
 
-	if (AzSpeech::Internal::HasEmptyParam(VisemeDataArray))
+	// Empty batches are never added: The last viseme is always in the last batch
+	if (Result->VisemeBatches.IsEmpty())
 	{
 		UE_LOG(LogAzSpeech_Internal, Error, TEXT("Task: %s (%d); Function: %s; Message: Viseme data is empty"), *TaskName.ToString(), GetUniqueID(),
 		       *FString(__FUNCTION__));
 		return FAzSpeechVisemeData();
 	}
 
-	return VisemeDataArray.Top();
+	const FAzSpeechVisemeTrack& LastBatch = Result->VisemeBatches.Last();
+	return LastBatch.GetVisemeData(LastBatch.Num() - 1);
 }
 
 const TArray<FAzSpeechVisemeData> UAzSpeechSynthesizerTaskBase::GetVisemeDataArray() const
 {
-	FScopeLock Lock(&Mutex);
+	TArray<FAzSpeechVisemeData> Output;
+	GetSynthesisResult()->VisemeBatches.ForEach([&Output](const FAzSpeechVisemeTrack& VisemeBatch)
+	{
+		Output.Append(VisemeBatch.ToArray());
+	});
 
-	return VisemeDataArray;
+	return Output;
 }
 
 const TArray<uint8> UAzSpeechSynthesizerTaskBase::GetAudioData() const
 {
-	FScopeLock Lock(&Mutex);
+	return GetAudioBuffer().ToArray();
+}
 
-	if (AudioData.empty())
+const FAzSpeechAudioBuffer UAzSpeechSynthesizerTaskBase::GetAudioBuffer() const
+{
+	const std::shared_ptr<const FAzSpeechSynthesisResultSnapshot> Result = GetSynthesisResult();
+
+	// While the synthesis is running, the audio data is only available as chunks: Each call copies them into a new buffer
+	if (Result->AudioData.IsEmpty() && !Result->AudioChunks.IsEmpty())
 	{
-		return TArray<uint8>();
+		return FAzSpeechAudioBuffer::Concatenate(Result->AudioChunks.ToArray());
 	}
 
-	TArray<uint8> OutputArr;
-	OutputArr.Append(AudioData.data(), AudioData.size());
-
-	return OutputArr;
+	return Result->AudioData;
 }
 
 const FAzSpeechAnimationData UAzSpeechSynthesizerTaskBase::GetLastExtractedAnimationData() const
 {
-	FScopeLock Lock(&Mutex);
+	const std::shared_ptr<const FAzSpeechSynthesisResultSnapshot> Result = GetSynthesisResult();
 
-	return UAzSpeechHelper::ExtractAnimationDataFromVisemeData(GetLastVisemeData());
+	if (Result->VisemeBatches.IsEmpty())
+	{
+		return FAzSpeechAnimationData();
+	}
+
+	// The blend shapes are already decoded: There's no need to parse the animation string again
+	const FAzSpeechVisemeTrack& LastBatch = Result->VisemeBatches.Last();
+	return LastBatch.GetAnimationData(LastBatch.Num() - 1);
 }
 
 const TArray<FAzSpeechAnimationData> UAzSpeechSynthesizerTaskBase::GetExtractedAnimationDataArray() const
 {
-	FScopeLock Lock(&Mutex);
+	TArray<FAzSpeechAnimationData> Output;
+	GetSynthesisResult()->VisemeBatches.ForEach([&Output](const FAzSpeechVisemeTrack& VisemeBatch)
+	{
+		Output.Append(VisemeBatch.ToAnimationDataArray());
+	});
 
-	return UAzSpeechHelper::ExtractAnimationDataFromVisemeDataArray(GetVisemeDataArray());
+	return Output;
 }
 
 const bool UAzSpeechSynthesizerTaskBase::IsLastResultValid() const
 {
-	FScopeLock Lock(&Mutex);
-
-	return bLastResultIsValid;
+	return GetSynthesisResult()->bLastResultIsValid;
 }
 
 const FString UAzSpeechSynthesizerTaskBase::GetSynthesisText() const
@@ -105,48 +134,81 @@ const bool UAzSpeechSynthesizerTaskBase::IsSSMLBased() const
 
 const int64 UAzSpeechSynthesizerTaskBase::GetAudioDuration() const
 {
-	FScopeLock Lock(&Mutex);
-
-	return AudioDuration;
+	return GetSynthesisResult()->AudioDuration;
 }
 
 const int32 UAzSpeechSynthesizerTaskBase::GetConnectionLatency() const
 {
-	FScopeLock Lock(&Mutex);
-
-	return ConnectionLatency;
+	return GetSynthesisResult()->ConnectionLatency;
 }
 
 const int32 UAzSpeechSynthesizerTaskBase::GetFinishLatency() const
 {
-	FScopeLock Lock(&Mutex);
-
-	return FinishLatency;
+	return GetSynthesisResult()->FinishLatency;
 }
 
 const int32 UAzSpeechSynthesizerTaskBase::GetFirstByteLatency() const
 {
-	FScopeLock Lock(&Mutex);
-
-	return FirstByteLatency;
+	return GetSynthesisResult()->FirstByteLatency;
 }
 
 const int32 UAzSpeechSynthesizerTaskBase::GetNetworkLatency() const
 {
-	FScopeLock Lock(&Mutex);
-
-	return NetworkLatency;
+	return GetSynthesisResult()->NetworkLatency;
 }
 
 const int32 UAzSpeechSynthesizerTaskBase::GetServiceLatency() const
+{
+	return GetSynthesisResult()->ServiceLatency;
+}
+
+const int32 UAzSpeechSynthesizerTaskBase::GetTimeToFirstAudio() const
+{
+	return GetSynthesisResult()->TimeToFirstAudio;
+}
+
+const std::shared_ptr<const FAzSpeechSynthesisResultSnapshot> UAzSpeechSynthesizerTaskBase::GetSynthesisResult() const
+{
+	return std::atomic_load_explicit(&SynthesisResult, std::memory_order_acquire);
+}
+
+void UAzSpeechSynthesizerTaskBase::UpdateSynthesisResult(const TFunctionRef<void(FAzSpeechSynthesisResultSnapshot&)> Updater)
+{
+	check(IsInGameThread());
+
+	// Readers keep the previous snapshot alive until they release it: A snapshot is never changed after being published. The chunks and visemes are
+	// kept in shared segment lists, so this copy has the same cost for the first and the last update of the synthesis
+	const std::shared_ptr<FAzSpeechSynthesisResultSnapshot> NewResult = std::make_shared<FAzSpeechSynthesisResultSnapshot>(*GetSynthesisResult());
+	Updater(*NewResult);
+
+	std::atomic_store_explicit(&SynthesisResult, std::shared_ptr<const FAzSpeechSynthesisResultSnapshot>(NewResult), std::memory_order_release);
+}
+
+void UAzSpeechSynthesizerTaskBase::BroadcastFinalResult()
 {
 	FScopeLock Lock(&Mutex);
 
-	return ServiceLatency;
+	if (!UAzSpeechTaskStatus::IsTaskActive(this))
+	{
+		return;
+	}
+
+	AddResultToSynthesisCache();
+
+	Super::BroadcastFinalResult();
 }
 
 void UAzSpeechSynthesizerTaskBase::StartSynthesisWork(std::shared_ptr<MicrosoftSpeech::Audio::AudioConfig>&& InAudioConfig)
 {
+	SynthesisStartTime = FPlatformTime::Seconds();
+
+	if (CompleteFromSynthesisCache())
+	{
+		// Release the unused output (e.g. wav file) before the caller's scope ends
+		InAudioConfig.reset();
+		return;
+	}
+
 	RunnableTask = MakeUnique<FAzSpeechSynthesisRunnable>(this, std::move(InAudioConfig));
 
 	if (!RunnableTask)
@@ -158,61 +220,143 @@ void UAzSpeechSynthesizerTaskBase::StartSynthesisWork(std::shared_ptr<MicrosoftS
 	RunnableTask->StartAzSpeechRunnableTask();
 }
 
-void UAzSpeechSynthesizerTaskBase::OnVisemeReceived(const FAzSpeechVisemeData& VisemeData)
+const bool UAzSpeechSynthesizerTaskBase::CanUseSynthesizerPool() const
+{
+	return false;
+}
+
+const bool UAzSpeechSynthesizerTaskBase::CanUseSynthesisCache() const
+{
+	return false;
+}
+
+const bool UAzSpeechSynthesizerTaskBase::IsCompletedFromCache() const
+{
+	return bCompletedFromCache;
+}
+
+void UAzSpeechSynthesizerTaskBase::OnVisemeBatchReceived(const FAzSpeechVisemeTrack& VisemeBatch)
 {
 	check(IsInGameThread());
 
-	FScopeLock Lock(&Mutex);
+	if (VisemeBatch.IsEmpty())
+	{
+		return;
+	}
+
+	UpdateSynthesisResult([&VisemeBatch](FAzSpeechSynthesisResultSnapshot& Result)
+	{
+		Result.VisemeBatches.Add(VisemeBatch);
+	});
+
+	// Rebuilding the viseme structures has a cost: Only do it if there's something bound to the delegates
+	if (VisemeReceived.IsBound() || VisemeBatchReceived.IsBound())
+	{
+		const TArray<FAzSpeechVisemeData> VisemeDataArray = VisemeBatch.ToArray();
 
-	VisemeDataArray.Add(VisemeData);
+		for (const FAzSpeechVisemeData& Iterator : VisemeDataArray)
+		{
+			VisemeReceived.Broadcast(Iterator);
+		}
 
-	VisemeReceived.Broadcast(GetLastVisemeData());
+		VisemeBatchReceived.Broadcast(VisemeDataArray);
+	}
 
 	if (UAzSpeechSettings::Get()->bEnableDebuggingLogs || UAzSpeechSettings::Get()->bEnableDebuggingPrints)
 	{
-		const FStringFormatOrderedArguments Arguments{
-			TaskName.ToString(), GetUniqueID(), FString(__func__), VisemeData.VisemeID, VisemeData.AudioOffsetMilliseconds, VisemeData.Animation
-		};
+		for (int32 Index = 0; Index < VisemeBatch.Num(); ++Index)
+		{
+			const FStringFormatOrderedArguments Arguments{
+				TaskName.ToString(), GetUniqueID(), FString(__func__), VisemeBatch.GetVisemeID(Index), VisemeBatch.GetAudioOffsetMilliseconds(Index),
+				VisemeBatch.GetNumFrames(Index), VisemeBatch.Num()
+			};
 
-		const FString MountedDebuggingInfo = FString::Format(
-			TEXT("Task: {0} ({1});\n\tFunction: {2};\n\tViseme ID: {3}\n\tViseme audio offset: {4}ms\n\tViseme animation: {5}"), Arguments);
+			const FString MountedDebuggingInfo = FString::Format(
+				TEXT("Task: {0} ({1});\n\tFunction: {2};\n\tViseme ID: {3}\n\tViseme audio offset: {4}ms\n\tViseme animation frames: {5}\n\tBatch size: {6}"),
+				Arguments);
 
-		UE_LOG(LogAzSpeech_Debugging, Display, TEXT("%s"), *MountedDebuggingInfo);
+			UE_LOG(LogAzSpeech_Debugging, Display, TEXT("%s"), *MountedDebuggingInfo);
 
 #if !UE_BUILD_SHIPPING
-		if (UAzSpeechSettings::Get()->bEnableDebuggingPrints)
-		{
-			GEngine->AddOnScreenDebugMessage(static_cast<int32>(GetUniqueID()), 5.f, FColor::Yellow, MountedDebuggingInfo);
-		}
+			if (UAzSpeechSettings::Get()->bEnableDebuggingPrints)
+			{
+				GEngine->AddOnScreenDebugMessage(static_cast<int32>(GetUniqueID()), 5.f, FColor::Yellow, MountedDebuggingInfo);
+			}
 #endif
+		}
 	}
 }
 
+void UAzSpeechSynthesizerTaskBase::OnSynthesisAudioChunk([[maybe_unused]] const FAzSpeechAudioBuffer& ChunkData)
+{
+}
+
 void UAzSpeechSynthesizerTaskBase::OnSynthesisUpdate(const std::shared_ptr<MicrosoftSpeech::SpeechSynthesisResult>& LastResult)
 {
 	check(IsInGameThread());
 
-	FScopeLock Lock(&Mutex);
+	// Shares the buffer owned by the SDK result: The audio data is never copied here
+	const FAzSpeechAudioBuffer ResultData(LastResult->GetAudioData());
+
+	bool bIsFirstAudioChunk = false;
+
+	UpdateSynthesisResult([this, &LastResult, &ResultData, &bIsFirstAudioChunk](FAzSpeechSynthesisResultSnapshot& Result)
+	{
+		if (LastResult->Reason == MicrosoftSpeech::ResultReason::SynthesizingAudio)
+		{
+			// Synthesizing events only carry the new chunk: Keep it to build the audio received so far on demand
+			if (Result.AudioChunks.IsEmpty() && !ResultData.IsEmpty())
+			{
+				Result.TimeToFirstAudio = static_cast<int32>((FPlatformTime::Seconds() - SynthesisStartTime) * 1000.0);
+				bIsFirstAudioChunk = true;
+			}
+
+			if (!ResultData.IsEmpty())
+			{
+				Result.AudioChunks.Add(ResultData);
+			}
+		}
+		else
+		{
+			// The final result carries the complete audio data, including the wav header. If it doesn't, the chunks are concatenated only once here
+			Result.AudioData = ResultData.IsEmpty() && !Result.AudioChunks.IsEmpty()
+				                   ? FAzSpeechAudioBuffer::Concatenate(Result.AudioChunks.ToArray())
+				                   : ResultData;
+			Result.AudioChunks.Empty();
+		}
+
+		Result.bLastResultIsValid = !Result.AudioData.IsEmpty() || !Result.AudioChunks.IsEmpty();
+
+		Result.AudioDuration = LastResult->AudioDuration.count();
 
-	AudioData = *LastResult->GetAudioData().get();
-	bLastResultIsValid = !AudioData.empty();
+		Result.ConnectionLatency = GetProperty<int32>(LastResult, MicrosoftSpeech::PropertyId::SpeechServiceResponse_SynthesisConnectionLatencyMs);
+		Result.FinishLatency = GetProperty<int32>(LastResult, MicrosoftSpeech::PropertyId::SpeechServiceResponse_SynthesisFinishLatencyMs);
+		Result.FirstByteLatency = GetProperty<int32>(LastResult, MicrosoftSpeech::PropertyId::SpeechServiceResponse_SynthesisFirstByteLatencyMs);
+		Result.NetworkLatency = GetProperty<int32>(LastResult, MicrosoftSpeech::PropertyId::SpeechServiceResponse_SynthesisNetworkLatencyMs);
+		Result.ServiceLatency = GetProperty<int32>(LastResult, MicrosoftSpeech::PropertyId::SpeechServiceResponse_SynthesisServiceLatencyMs);
+	});
 
-	AudioDuration = LastResult->AudioDuration.count();
+	const std::shared_ptr<const FAzSpeechSynthesisResultSnapshot> Result = GetSynthesisResult();
 
-	ConnectionLatency = GetProperty<int32>(LastResult, MicrosoftSpeech::PropertyId::SpeechServiceResponse_SynthesisConnectionLatencyMs);
-	FinishLatency = GetProperty<int32>(LastResult, MicrosoftSpeech::PropertyId::SpeechServiceResponse_SynthesisFinishLatencyMs);
-	FirstByteLatency = GetProperty<int32>(LastResult, MicrosoftSpeech::PropertyId::SpeechServiceResponse_SynthesisFirstByteLatencyMs);
-	NetworkLatency = GetProperty<int32>(LastResult, MicrosoftSpeech::PropertyId::SpeechServiceResponse_SynthesisNetworkLatencyMs);
-	ServiceLatency = GetProperty<int32>(LastResult, MicrosoftSpeech::PropertyId::SpeechServiceResponse_SynthesisServiceLatencyMs);
+	if (bIsFirstAudioChunk)
+	{
+		UE_LOG(LogAzSpeech_Debugging, Display, TEXT("Task: %s (%d); Function: %s; Message: First audio chunk received after %d ms"),
+		       *TaskName.ToString(), GetUniqueID(), *FString(__FUNCTION__), Result->TimeToFirstAudio);
+	}
+
+	if (LastResult->Reason == MicrosoftSpeech::ResultReason::SynthesizingAudio && !ResultData.IsEmpty())
+	{
+		OnSynthesisAudioChunk(ResultData);
+	}
 
 	SynthesisUpdated.Broadcast();
 
 	if (UAzSpeechSettings::Get()->bEnableDebuggingLogs || UAzSpeechSettings::Get()->bEnableDebuggingPrints)
 	{
 		const FStringFormatOrderedArguments Arguments{
-			TaskName.ToString(), GetUniqueID(), FString(__func__), AudioDuration, (LastResult->GetAudioLength()),
-			static_cast<uint32>(LastResult->GetAudioData().get()->size()), static_cast<int32>(LastResult->Reason),
-			FString(UTF8_TO_TCHAR(LastResult->ResultId.c_str())), ConnectionLatency, FinishLatency, FirstByteLatency, NetworkLatency, ServiceLatency
+			TaskName.ToString(), GetUniqueID(), FString(__func__), Result->AudioDuration, (LastResult->GetAudioLength()),
+			static_cast<uint32>(ResultData.Num()), static_cast<int32>(LastResult->Reason), FString(UTF8_TO_TCHAR(LastResult->ResultId.c_str())),
+			Result->ConnectionLatency, Result->FinishLatency, Result->FirstByteLatency, Result->NetworkLatency, Result->ServiceLatency
 		};
 
 		const FString MountedDebuggingInfo = FString::Format(TEXT(
@@ -228,3 +372,109 @@ void UAzSpeechSynthesizerTaskBase::OnSynthesisUpdate(const std::shared_ptr<Micro
 #endif
 	}
 }
+
+const bool UAzSpeechSynthesizerTaskBase::CompleteFromSynthesisCache()
+{
+	check(IsInGameThread());
+
+	if (!CanUseSynthesisCache())
+	{
+		return false;
+	}
+
+	const UAzSpeechEngineSubsystem* const Subsystem = GEngine->GetEngineSubsystem<UAzSpeechEngineSubsystem>();
+	if (!Subsystem)
+	{
+		return false;
+	}
+
+	const FString CacheKeyContent = FAzSpeechSynthesisCache::MakeKeyContent(SynthesisText, bIsSSMLBased, SynthesisOptions);
+	const uint64 CacheKey = FAzSpeechSynthesisCache::MakeKey(CacheKeyContent);
+
+	const TSharedPtr<FAzSpeechSynthesisCache, ESPMode::ThreadSafe> SynthesisCache = Subsystem->GetSynthesisCache();
+	TSharedPtr<const FAzSpeechCachedSynthesis, ESPMode::ThreadSafe> CachedResult = SynthesisCache.IsValid() ? SynthesisCache->Find(CacheKey) : nullptr;
+
+	// Results persisted by previous sessions are promoted to the memory cache: The audio data stays in the mapped file
+	if (const TSharedPtr<FAzSpeechSynthesisDiskCache, ESPMode::ThreadSafe> SynthesisDiskCache = Subsystem->GetSynthesisDiskCache(); !CachedResult.
+		IsValid() && SynthesisDiskCache.IsValid())
+	{
+		CachedResult = SynthesisDiskCache->Find(CacheKey, CacheKeyContent);
+
+		if (CachedResult.IsValid() && SynthesisCache.IsValid())
+		{
+			SynthesisCache->Add(CacheKey, CachedResult.ToSharedRef());
+		}
+	}
+
+	if (!CachedResult.IsValid())
+	{
+		return false;
+	}
+
+	UE_LOG(LogAzSpeech_Internal, Display, TEXT("Task: %s (%d); Function: %s; Message: Completing task with a cached synthesis result"),
+	       *TaskName.ToString(), GetUniqueID(), *FString(__FUNCTION__));
+
+	bCompletedFromCache = true;
+
+	UpdateSynthesisResult([&CachedResult](FAzSpeechSynthesisResultSnapshot& Result)
+	{
+		Result.AudioData = CachedResult->AudioData;
+		Result.AudioDuration = CachedResult->AudioDuration;
+		Result.bLastResultIsValid = true;
+	});
+
+	// Keep the same delegate order of a synthesized result: Started, Visemes, Updated and Completed
+	SynthesisStarted.Broadcast();
+
+	OnVisemeBatchReceived(CachedResult->VisemeTrack);
+
+	SynthesisUpdated.Broadcast();
+	BroadcastFinalResult();
+
+	return true;
+}
+
+void UAzSpeechSynthesizerTaskBase::AddResultToSynthesisCache() const
+{
+	const std::shared_ptr<const FAzSpeechSynthesisResultSnapshot> Result = GetSynthesisResult();
+
+	if (bCompletedFromCache || !Result->bLastResultIsValid || Result->AudioData.IsEmpty() || !CanUseSynthesisCache())
+	{
+		return;
+	}
+
+	const UAzSpeechEngineSubsystem* const Subsystem = GEngine->GetEngineSubsystem<UAzSpeechEngineSubsystem>();
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	const TSharedPtr<FAzSpeechSynthesisCache, ESPMode::ThreadSafe> SynthesisCache = Subsystem->GetSynthesisCache();
+	const TSharedPtr<FAzSpeechSynthesisDiskCache, ESPMode::ThreadSafe> SynthesisDiskCache = Subsystem->GetSynthesisDiskCache();
+	if (!SynthesisCache.IsValid() && !SynthesisDiskCache.IsValid())
+	{
+		return;
+	}
+
+	const FString CacheKeyContent = FAzSpeechSynthesisCache::MakeKeyContent(SynthesisText, bIsSSMLBased, SynthesisOptions);
+	const uint64 CacheKey = FAzSpeechSynthesisCache::MakeKey(CacheKeyContent);
+
+	// The audio buffer is shared with the cache: Only the viseme batches are merged into a single track
+	const TSharedRef<FAzSpeechCachedSynthesis, ESPMode::ThreadSafe> NewResult = MakeShared<FAzSpeechCachedSynthesis, ESPMode::ThreadSafe>();
+	NewResult->AudioData = Result->AudioData;
+	NewResult->VisemeTrack = Result->GetVisemeTrack();
+	NewResult->AudioDuration = Result->AudioDuration;
+
+	if (SynthesisCache.IsValid())
+	{
+		SynthesisCache->Add(CacheKey, NewResult);
+	}
+
+	if (SynthesisDiskCache.IsValid())
+	{
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [SynthesisDiskCache, CacheKey, CacheKeyContent, NewResult]
+		{
+			SynthesisDiskCache->Add(CacheKey, CacheKeyContent, *NewResult);
+		});
+	}
+}
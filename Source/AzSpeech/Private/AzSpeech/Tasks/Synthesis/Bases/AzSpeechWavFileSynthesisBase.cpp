@@ -7,6 +7,7 @@
 #include "AzSpeechInternalFuncs.h"
 #include "LogAzSpeech.h"
 #include <HAL/FileManager.h>
+#include <Misc/FileHelper.h>
 
 #ifdef UE_INLINE_GENERATED_CPP_BY_NAME
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechWavFileSynthesisBase)
@@ -71,11 +72,29 @@ void UAzSpeechWavFileSynthesisBase::BroadcastFinalResult()
 	}
 
 	Super::BroadcastFinalResult();
+
+	// Cached results already contain the wav header: Write them to the requested file instead of synthesizing it again
+	if (IsCompletedFromCache() && !FFileHelper::SaveArrayToFile(GetAudioBuffer().GetView(), *UAzSpeechHelper::QualifyWAVFileName(FilePath, FileName)))
+	{
+		UE_LOG(LogAzSpeech_Internal, Error, TEXT("Task: %s (%d); Function: %s; Message: Failed to write the cached result to '%s'."),
+		       *TaskName.ToString(), GetUniqueID(), *FString(__FUNCTION__), *UAzSpeechHelper::QualifyWAVFileName(FilePath, FileName));
+
+		SynthesisCompleted.Broadcast(false);
+		SetReadyToDestroy();
+
+		return;
+	}
+
 	SynthesisCompleted.Broadcast(IsLastResultValid() && UAzSpeechHelper::IsAudioDataValid(GetAudioData()));
 
 	SetReadyToDestroy();
 }
 
+const bool UAzSpeechWavFileSynthesisBase::CanUseSynthesisCache() const
+{
+	return true;
+}
+
 bool UAzSpeechWavFileSynthesisBase::StartAzureTaskWork()
 {
 	if (!Super::StartAzureTaskWork())
@@ -55,7 +55,11 @@ void USSMLToAudioDataAsync::BroadcastFinalResult()
 	}
 
 	Super::BroadcastFinalResult();
-	SynthesisCompleted.Broadcast(GetAudioData());
+	// Blueprint delegates need an owned array: Skip the copy if nobody is listening
+	if (SynthesisCompleted.IsBound())
+	{
+		SynthesisCompleted.Broadcast(GetAudioData());
+	}
 
 	SetReadyToDestroy();
 }
@@ -43,7 +43,7 @@ void USSMLToSoundWaveAsync::BroadcastFinalResult()
 	}
 
 	Super::BroadcastFinalResult();
-	SynthesisCompleted.Broadcast(UAzSpeechHelper::ConvertAudioDataToSoundWave(GetAudioData()));
+	SynthesisCompleted.Broadcast(UAzSpeechHelper::ConvertAudioBufferToTransientSoundWave(GetAudioBuffer()));
 
 	SetReadyToDestroy();
 }
@@ -58,7 +58,11 @@ void UTextToAudioDataAsync::BroadcastFinalResult()
 	}
 
 	Super::BroadcastFinalResult();
-	SynthesisCompleted.Broadcast(GetAudioData());
+	// Blueprint delegates need an owned array: Skip the copy if nobody is listening
+	if (SynthesisCompleted.IsBound())
+	{
+		SynthesisCompleted.Broadcast(GetAudioData());
+	}
 
 	SetReadyToDestroy();
 }
@@ -45,7 +45,7 @@ void UTextToSoundWaveAsync::BroadcastFinalResult()
 	}
 
 	Super::BroadcastFinalResult();
-	SynthesisCompleted.Broadcast(UAzSpeechHelper::ConvertAudioDataToSoundWave(GetAudioData()));
+	SynthesisCompleted.Broadcast(UAzSpeechHelper::ConvertAudioBufferToTransientSoundWave(GetAudioBuffer()));
 
 	SetReadyToDestroy();
 }
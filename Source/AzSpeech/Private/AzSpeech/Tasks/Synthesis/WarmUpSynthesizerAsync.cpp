@@ -0,0 +1,92 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeech/Tasks/Synthesis/WarmUpSynthesizerAsync.h"
+#include "AzSpeech/Runnables/Synthesis/AzSpeechSynthesizerWarmUpRunnable.h"
+#include "LogAzSpeech.h"
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(WarmUpSynthesizerAsync)
+#endif
+
+namespace MicrosoftSpeech = Microsoft::CognitiveServices::Speech;
+
+UWarmUpSynthesizerAsync* UWarmUpSynthesizerAsync::WarmUpSynthesizer_DefaultOptions(UObject* const WorldContextObject, const FString& Voice,
+                                                                                   const FString& Locale)
+{
+	return WarmUpSynthesizer_CustomOptions(WorldContextObject, FAzSpeechSubscriptionOptions(), FAzSpeechSynthesisOptions(*Locale, *Voice));
+}
+
+UWarmUpSynthesizerAsync* UWarmUpSynthesizerAsync::WarmUpSynthesizer_CustomOptions(UObject* const WorldContextObject,
+                                                                                  const FAzSpeechSubscriptionOptions& SubscriptionOptions,
+                                                                                  const FAzSpeechSynthesisOptions& SynthesisOptions,
+                                                                                  const bool bWarmUpSSMLTasks)
+{
+	UWarmUpSynthesizerAsync* const NewAsyncTask = NewObject<UWarmUpSynthesizerAsync>();
+	NewAsyncTask->SubscriptionOptions = SubscriptionOptions;
+	NewAsyncTask->SynthesisOptions = SynthesisOptions;
+	NewAsyncTask->bIsSSMLBased = bWarmUpSSMLTasks;
+	NewAsyncTask->TaskName = *FString(__FUNCTION__);
+
+	NewAsyncTask->RegisterWithGameInstance(WorldContextObject);
+
+	return NewAsyncTask;
+}
+
+const float UWarmUpSynthesizerAsync::GetWarmUpTime() const
+{
+	return WarmUpTime.load();
+}
+
+bool UWarmUpSynthesizerAsync::StartAzureTaskWork()
+{
+	if (!Super::StartAzureTaskWork())
+	{
+		return false;
+	}
+
+	// The warmed synthesizer doesn't write to any output: The audio config is only required by the runnable base
+	RunnableTask = MakeUnique<FAzSpeechSynthesizerWarmUpRunnable>(
+		this, MicrosoftSpeech::Audio::AudioConfig::FromStreamOutput(MicrosoftSpeech::Audio::AudioOutputStream::CreatePullStream()));
+
+	if (!RunnableTask)
+	{
+		return false;
+	}
+
+	RunnableTask->StartAzSpeechRunnableTask();
+
+	return true;
+}
+
+void UWarmUpSynthesizerAsync::BroadcastFinalResult()
+{
+	FScopeLock Lock(&Mutex);
+
+	if (!UAzSpeechTaskStatus::IsTaskActive(this))
+	{
+		return;
+	}
+
+	Super::BroadcastFinalResult();
+
+	if (bWarmUpSucceeded)
+	{
+		UE_LOG(LogAzSpeech, Display, TEXT("Task: %s (%d); Function: %s; Message: Synthesizer warmed up in %.3f ms"), *TaskName.ToString(), GetUniqueID(),
+		       *FString(__FUNCTION__), GetWarmUpTime());
+
+		WarmUpCompleted.Broadcast(GetWarmUpTime());
+	}
+	else
+	{
+		SynthesisFailed.Broadcast();
+	}
+
+	SetReadyToDestroy();
+}
+
+const bool UWarmUpSynthesizerAsync::CanUseSynthesizerPool() const
+{
+	return true;
+}
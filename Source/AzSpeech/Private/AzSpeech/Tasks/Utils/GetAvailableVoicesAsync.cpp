@@ -4,19 +4,16 @@
 
 #include "AzSpeech/Tasks/Utils/GetAvailableVoicesAsync.h"
 #include "AzSpeech/AzSpeechSettings.h"
+#include "AzSpeech/AzSpeechEngineSubsystem.h"
+#include "AzSpeech/Cache/AzSpeechVoiceCatalog.h"
 #include "LogAzSpeech.h"
 #include <Async/Async.h>
-
-THIRD_PARTY_INCLUDES_START
-#include <speechapi_cxx_speech_synthesizer.h>
-THIRD_PARTY_INCLUDES_END
+#include <Engine/Engine.h>
 
 #ifdef UE_INLINE_GENERATED_CPP_BY_NAME
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GetAvailableVoicesAsync)
 #endif
 
-namespace MicrosoftSpeech = Microsoft::CognitiveServices::Speech;
-
 UGetAvailableVoicesAsync* UGetAvailableVoicesAsync::GetAvailableVoicesAsync(UObject* const WorldContextObject, const FString& Locale)
 {
 	UGetAvailableVoicesAsync* const NewAsyncTask = NewObject<UGetAvailableVoicesAsync>();
@@ -41,6 +38,38 @@ void UGetAvailableVoicesAsync::Activate()
 	UE_LOG(LogAzSpeech, Display, TEXT("Task: %s (%d); Function: %s; Message: Activating task"), *TaskName.ToString(), GetUniqueID(),
 	       *FString(__FUNCTION__));
 
+	// The catalog answers immediately when the locale is cached: Tasks only wait for Azure on the first request of each locale
+	const UAzSpeechEngineSubsystem* const Subsystem = GEngine ? GEngine->GetEngineSubsystem<UAzSpeechEngineSubsystem>() : nullptr;
+	if (const TSharedPtr<FAzSpeechVoiceCatalog, ESPMode::ThreadSafe> VoiceCatalog = Subsystem ? Subsystem->GetVoiceCatalog() : nullptr)
+	{
+		VoiceCatalog->Get(Locale, [WeakThis = TWeakObjectPtr<UGetAvailableVoicesAsync>(this)](const FAzSpeechVoiceCatalog::FVoiceListPtr& Voices)
+		{
+			if (!WeakThis.IsValid())
+			{
+				return;
+			}
+
+			TArray<FString> TaskResult;
+			TaskResult.Reserve(Voices->Num());
+
+			for (const FAzSpeechVoiceInfo& Voice : *Voices)
+			{
+				TaskResult.Add(Voice.ShortName);
+			}
+
+			// Cached voices are returned during the activation: Broadcast in the next game thread task to keep the same order of the uncached requests
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, TaskResult]
+			{
+				if (WeakThis.IsValid())
+				{
+					WeakThis->BroadcastResult(TaskResult);
+				}
+			});
+		});
+
+		return;
+	}
+
 	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this]
 	{
 		const TArray<FString> TaskResult = GetAvailableVoices();
@@ -93,53 +122,13 @@ const TArray<FString> UGetAvailableVoicesAsync::GetAvailableVoices() const
 {
 	TArray<FString> Output;
 
-	std::shared_ptr<MicrosoftSpeech::SpeechConfig> SpeechConfig;
-	const UAzSpeechSettings* const Settings = UAzSpeechSettings::Get();
-	const std::string SubscriptionKey = TCHAR_TO_UTF8(*Settings->DefaultOptions.SubscriptionOptions.SubscriptionKey.ToString());
-
-	if (Settings->DefaultOptions.SubscriptionOptions.bUsePrivateEndpoint)
-	{
-		const std::string RegionID = TCHAR_TO_UTF8(*Settings->DefaultOptions.SubscriptionOptions.RegionID.ToString());
-		SpeechConfig = MicrosoftSpeech::SpeechConfig::FromSubscription(SubscriptionKey, RegionID);
-	}
-	else
+	if (TArray<FAzSpeechVoiceInfo> Voices; FAzSpeechVoiceCatalog::FetchVoices(UAzSpeechSettings::Get()->DefaultOptions.SubscriptionOptions, Locale, Voices))
 	{
-		const std::string Endpoint = TCHAR_TO_UTF8(*Settings->DefaultOptions.SubscriptionOptions.PrivateEndpoint.ToString());
-		SpeechConfig = MicrosoftSpeech::SpeechConfig::FromEndpoint(Endpoint, SubscriptionKey);
-	}
+		Output.Reserve(Voices.Num());
 
-	if (SpeechConfig)
-	{
-		if (const std::shared_ptr<MicrosoftSpeech::SpeechSynthesizer> SpeechSynthesizer =
-			MicrosoftSpeech::SpeechSynthesizer::FromConfig(SpeechConfig))
+		for (const FAzSpeechVoiceInfo& Voice : Voices)
 		{
-			const auto SynthesisVoices = SpeechSynthesizer->GetVoicesAsync(TCHAR_TO_UTF8(*Locale)).get();
-
-			for (const auto& Voice : SynthesisVoices->Voices)
-			{
-				Output.Emplace(UTF8_TO_TCHAR(Voice->ShortName.c_str()));
-
-				const FStringFormatOrderedArguments Arguments{
-					TaskName.ToString(), GetUniqueID(), FString(__func__), FString(UTF8_TO_TCHAR(Voice->Name.c_str())),
-					FString(UTF8_TO_TCHAR(Voice->ShortName.c_str())), FString(UTF8_TO_TCHAR(Voice->LocalName.c_str())),
-					FString(UTF8_TO_TCHAR(Voice->VoicePath.c_str())), FString(UTF8_TO_TCHAR(Voice->Locale.c_str())),
-					static_cast<int32>(Voice->Gender), static_cast<int32>(Voice->VoiceType)
-				};
-
-				const FString MountedDebuggingInfo = FString::Format(
-					TEXT(
-						"Task: {0} ({1});\n\tFunction: {2};\n\tVoice Name: {3}\n\tVoice Short Name: {4}\n\tVoice Local Name: {5}\n\tVoice Path: {6};\n\tVoice Locale: {7}\n\tVoice Gender: {8}\n\tVoice Type: {9}"),
-					Arguments);
-
-				UE_LOG(LogAzSpeech_Debugging, Display, TEXT("%s"), *MountedDebuggingInfo);
-
-#if !UE_BUILD_SHIPPING
-				if (UAzSpeechSettings::Get()->bEnableDebuggingPrints)
-				{
-					GEngine->AddOnScreenDebugMessage(static_cast<int32>(GetUniqueID()), 5.f, FColor::Yellow, MountedDebuggingInfo);
-				}
-#endif
-			}
+			Output.Add(Voice.ShortName);
 		}
 	}
 
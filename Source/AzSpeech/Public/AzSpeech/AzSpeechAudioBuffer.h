@@ -0,0 +1,49 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeech/Structures/AzSpeechAudioBufferStats.h"
+#include <memory>
+#include <vector>
+
+/**
+ *
+ */
+class AZSPEECH_API FAzSpeechAudioBuffer
+{
+public:
+	FAzSpeechAudioBuffer() = default;
+
+	/* Shares the audio data received from the SDK without copying it */
+	explicit FAzSpeechAudioBuffer(const std::shared_ptr<std::vector<uint8_t>>& InData);
+
+	/* Shares a memory region kept alive by its owner, e.g. a memory mapped file */
+	FAzSpeechAudioBuffer(const std::shared_ptr<const void>& InOwner, const uint8* InData, const int32 InNum);
+
+	/* Takes the ownership of the array without copying it */
+	static FAzSpeechAudioBuffer FromArray(TArray<uint8>&& InData);
+
+	/* Copies the audio data of all chunks into a single buffer */
+	static FAzSpeechAudioBuffer Concatenate(const TArray<FAzSpeechAudioBuffer>& Chunks);
+
+	const uint8* GetData() const;
+	const int32 Num() const;
+	const bool IsEmpty() const;
+
+	TArrayView<const uint8> GetView() const;
+
+	/* Copies the audio data to a new array: Only use it when an owned array is required, e.g. Blueprint delegates */
+	TArray<uint8> ToArray() const;
+
+	static const FAzSpeechAudioBufferStats GetStats();
+	static void ResetStats();
+	static void RegisterCopy(const int64 NumBytes);
+
+private:
+	// Aliases the owner of the memory: A SDK vector or a mapped file region
+	std::shared_ptr<const uint8> Data;
+	int32 DataNum = 0;
+};
@@ -0,0 +1,70 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+/**
+ * Converts interleaved float audio to the mono format expected by the recognizers: Downmix, polyphase resampling and 16 bits conversion
+ * All buffers are allocated in the constructor: Processing never allocates, longer inputs are processed in blocks
+ */
+class AZSPEECH_API FAzSpeechAudioConverter
+{
+public:
+	FAzSpeechAudioConverter() = delete;
+	FAzSpeechAudioConverter(const int32 InInputSampleRate, const int32 InNumInputChannels, const int32 InOutputSampleRate = 16000,
+	                        const int32 InMaxInputFrames = 4800);
+
+	/* Maximum number of frames written by a call with this number of input frames */
+	const int32 GetMaxOutputFrames(const int32 NumInputFrames) const;
+
+	/* Converts interleaved input frames: Returns the number of samples written to the output, never more than its size */
+	const int32 Process(const float* const InAudio, const int32 NumInputFrames, const TArrayView<float> OutAudio);
+
+	/* Clears the resampler history: Use it when the input is interrupted */
+	void Reset();
+
+	const int32 GetInputSampleRate() const;
+	const int32 GetNumInputChannels() const;
+	const int32 GetOutputSampleRate() const;
+
+	/* Averages the channels of interleaved frames */
+	static void Downmix(const float* const InAudio, const int32 NumFrames, const int32 NumChannels, float* const OutAudio);
+
+	/* Clamps to [-1, 1] and scales to 16 bits samples */
+	static void FloatToInt16(const float* const InAudio, const int32 NumSamples, int16* const OutAudio);
+
+	/* Maximum number of filter phases: Sample rates that need more phases use the closest phase */
+	static constexpr int32 MaxPhases = 512;
+
+	/* Filter taps per phase: Multiple of 4 */
+	static constexpr int32 TapsPerPhase = 32;
+
+private:
+	void BuildFilter();
+	const int32 Process_Internal(const float* const InAudio, const int32 NumInputFrames, float* const OutAudio, const int32 MaxOutput);
+
+	int32 InputSampleRate;
+	int32 NumInputChannels;
+	int32 OutputSampleRate;
+	int32 MaxInputFrames;
+
+	// The input advances Step / NumPhases samples per output sample
+	int32 NumPhases = 1;
+	int32 Step = 1;
+
+	bool bPassThrough = false;
+
+	// Coefficients of each phase in reverse order: The dot product is made with the input in ascending order
+	TArray<float> Coefficients;
+
+	// History of the previous calls followed by the downmixed input
+	TArray<float> Window;
+	int32 NumWindowSamples = 0;
+
+	// Start of the next filter window and the phase of the next output sample
+	int32 WindowStart = 0;
+	int32 Phase = 0;
+};
@@ -0,0 +1,65 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeech/Structures/AzSpeechAudioInputDeviceInfo.h"
+#include <Templates/SharedPointer.h>
+#include <atomic>
+#include <memory>
+
+/**
+ *
+ */
+struct FAzSpeechAudioInputDeviceSnapshot
+{
+	TArray<FAzSpeechAudioInputDeviceInfo> Devices;
+
+	/* Keyed by the device ID with braces: {ID} */
+	TMap<FString, int32> DeviceIndices;
+
+	const FAzSpeechAudioInputDeviceInfo* Find(const FString& DeviceID) const;
+};
+
+/**
+ * Caches the available audio input devices: The devices are enumerated in the background when the system notifies a device change
+ */
+class AZSPEECH_API FAzSpeechAudioInputDeviceRegistry : public TSharedFromThis<FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe>
+{
+public:
+	FAzSpeechAudioInputDeviceRegistry();
+	~FAzSpeechAudioInputDeviceRegistry();
+
+	/* Starts the first enumeration and listens to device changes */
+	void Initialize();
+	void Shutdown();
+
+	/* Thread safe: Enumerates the devices synchronously only if the first enumeration isn't finished yet */
+	const std::shared_ptr<const FAzSpeechAudioInputDeviceSnapshot> GetSnapshot();
+
+	/* Enumerates the devices again in the background: Called on device change notifications */
+	void RequestRefresh();
+
+	/* Called in the game thread after a refresh that changed the available devices */
+	FSimpleMulticastDelegate OnDevicesChanged;
+
+	/* Direct enumeration using the audio capture module: Slow, avoid calling it in the game thread */
+	static const TArray<FAzSpeechAudioInputDeviceInfo> EnumerateDevices();
+
+private:
+	void Refresh();
+
+	std::shared_ptr<const FAzSpeechAudioInputDeviceSnapshot> Snapshot;
+
+	std::atomic<bool> bIsRefreshing = false;
+	std::atomic<bool> bRefreshRequested = false;
+	std::atomic<bool> bIsShuttingDown = false;
+
+	FDelegateHandle ApplicationReactivatedHandle;
+
+#if PLATFORM_WINDOWS
+	class FAzSpeechDeviceNotificationClient* NotificationClient = nullptr;
+#endif
+};
@@ -0,0 +1,63 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeech/AzSpeechSegmentList.h"
+
+class FAzSpeechVisemeTrack;
+
+/**
+ *
+ */
+class AZSPEECH_API FAzSpeechBlendShapeTimeline
+{
+public:
+	/* The service sends the facial expression animation at 60 frames per second */
+	explicit FAzSpeechBlendShapeTimeline(const float InFrameRate = 60.f);
+
+	/* Adds NumFrames * NumBlendShapes weights starting at the frame index of the animation received with a viseme */
+	void Append(const int32 FrameIndex, const int64 AudioOffsetMilliseconds, const TArrayView<const float> Weights, const int32 InNumBlendShapes);
+
+	/* Appends the visemes added to the track since the last update: Call it whenever the task receives new visemes */
+	void Update(const FAzSpeechVisemeTrack& Track);
+
+	/* Appends the viseme batches added since the last update: Only the new batches are visited */
+	void Update(const TAzSpeechSegmentList<FAzSpeechVisemeTrack>& VisemeBatches);
+
+	void Empty();
+
+	/* Interpolates the weights of all blend shapes at the given audio time. Times out of the timeline are clamped to the first or last frame */
+	const bool Sample(const float TimeMilliseconds, TArray<float>& OutWeights) const;
+	const bool Sample(const float TimeMilliseconds, const TArrayView<float> OutWeights) const;
+
+	const int32 GetNumFrames() const;
+	const int32 GetNumBlendShapes() const;
+	const float GetDuration() const;
+
+	/* Weights of a single frame: NumBlendShapes values */
+	TArrayView<const float> GetFrameWeights(const int32 FrameIndex) const;
+
+	/* Contiguous weights of all frames: NumFrames * NumBlendShapes values */
+	TArrayView<const float> GetWeights() const;
+	TArrayView<const float> GetFrameTimes() const;
+
+private:
+	const float GetFrameTime(const int32 FrameIndex, const int64 AudioOffsetMilliseconds);
+	void AppendTrack(const FAzSpeechVisemeTrack& Track, const int32 FirstIndex);
+
+	float FrameDuration;
+
+	TArray<float> FrameTimes;
+	TArray<float> Weights;
+	int32 NumBlendShapes = 0;
+
+	double TimeBase = 0.0;
+	bool bHasTimeBase = false;
+
+	int32 NumConsumedVisemes = 0;
+	int32 NumConsumedBatches = 0;
+	TAzSpeechSegmentList<FAzSpeechVisemeTrack>::FHandle LastConsumedBatch;
+};
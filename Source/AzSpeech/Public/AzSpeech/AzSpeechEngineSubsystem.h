@@ -6,15 +6,25 @@
 
 #include <CoreMinimal.h>
 #include <Subsystems/EngineSubsystem.h>
+#include <Tickable.h>
 #include "AzSpeech/Structures/AzSpeechTaskData.h"
+#include "AzSpeech/Structures/AzSpeechThreadPoolStats.h"
+#include "AzSpeech/Structures/AzSpeechAudioBufferStats.h"
+#include "AzSpeech/Structures/AzSpeechSynthesisCacheStats.h"
+#include "AzSpeech/Structures/AzSpeechSettingsOptions.h"
+#include "AzSpeech/Structures/AzSpeechVoiceInfo.h"
 #include "AzSpeechEngineSubsystem.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAzSpeechTaskRegistrationUpdate, const FAzSpeechTaskData, TaskData);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FAzSpeechTaskQueueExecutionProgress, const int64, QueueId, const FAzSpeechTaskData, TaskData);
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FAzSpeechAudioInputDevicesChanged);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAzSpeechVoiceCatalogUpdate, const FString&, Locale);
+
 UCLASS(Category = "AzSpeech")
-class AZSPEECH_API UAzSpeechEngineSubsystem : public UEngineSubsystem
+class AZSPEECH_API UAzSpeechEngineSubsystem : public UEngineSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
@@ -26,6 +36,15 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual bool IsTickableInEditor() const override;
+	virtual bool IsTickableWhenPaused() const override;
+	virtual TStatId GetStatId() const override;
+	// End of FTickableGameObject interface
+
 	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management")
 	UAzSpeechTaskBase* GetRegisteredAzSpeechTask(const FAzSpeechTaskData& Data) const;
 
@@ -50,6 +69,60 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management")
 	bool IsQueueEmpty(const int64 QueueId) const;
 
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management")
+	FAzSpeechThreadPoolStats GetThreadPoolStats() const;
+
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management")
+	FAzSpeechAudioBufferStats GetAudioBufferStats() const;
+
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management")
+	void ResetAudioBufferStats() const;
+
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management")
+	FAzSpeechSynthesisCacheStats GetSynthesisCacheStats() const;
+
+	/* Removes all cached synthesis results: Tasks that are already running are not affected */
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management")
+	void ClearSynthesisCache() const;
+
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management")
+	FAzSpeechSynthesisCacheStats GetSynthesisDiskCacheStats() const;
+
+	/* Removes all synthesis results persisted in Saved/AzSpeechCache */
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management")
+	void ClearSynthesisDiskCache() const;
+
+	/* Opens a synthesizer connection ahead of time so the first synthesis with the same options skips the connection setup */
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management", meta = (WorldContext = "WorldContextObject"))
+	class UWarmUpSynthesizerAsync* WarmUpSynthesizer(UObject* const WorldContextObject, const FAzSpeechSubscriptionOptions& SubscriptionOptions,
+	                                                 const FAzSpeechSynthesisOptions& SynthesisOptions, const bool bWarmUpSSMLTasks = false) const;
+
+	/* Returns the cached voices of the locale without waiting for Azure: Missing or expired locales are requested in the background and reported by OnVoiceCatalogUpdated */
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management")
+	bool GetCachedVoices(const FString& Locale, TArray<FAzSpeechVoiceInfo>& Voices) const;
+
+	/* Requests the voices of the locale in the background, even if the cached voices are still valid */
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management")
+	void RefreshVoiceCatalog(const FString& Locale) const;
+
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management")
+	void ClearVoiceCatalog() const;
+
+	/* Enumerates the audio input devices again in the background: Device changes are already detected automatically where the platform notifies them */
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Management")
+	void RefreshAudioInputDevices() const;
+
+	/* Dispatches all events queued by the running tasks without waiting for the next tick: e.g. when there's no engine loop running */
+	void DispatchPendingEvents() const;
+
+	TSharedPtr<class FAzSpeechRunnablePool, ESPMode::ThreadSafe> GetRunnablePool() const;
+	TSharedPtr<class FAzSpeechEventQueue, ESPMode::ThreadSafe> GetEventQueue() const;
+	TSharedPtr<class FAzSpeechSynthesizerPool, ESPMode::ThreadSafe> GetSynthesizerPool() const;
+	TSharedPtr<class FAzSpeechSynthesisCache, ESPMode::ThreadSafe> GetSynthesisCache() const;
+	TSharedPtr<class FAzSpeechSynthesisDiskCache, ESPMode::ThreadSafe> GetSynthesisDiskCache() const;
+	TSharedPtr<class FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe> GetAudioInputDeviceRegistry() const;
+	TSharedPtr<class FAzSpeechVoiceCatalog, ESPMode::ThreadSafe> GetVoiceCatalog() const;
+
 private:
 	void RegisterAzSpeechTask(class UAzSpeechTaskBase* const Task) const;
 	void UnregisterAzSpeechTask(class UAzSpeechTaskBase* const Task) const;
@@ -62,6 +135,9 @@ private:
 	void DequeueAudioExecutionQueue(const int64 QueueId) const;
 	void OnQueueAudioExecutionCompleted(const FAzSpeechTaskData Data, const int64 QueueId) const;
 
+	void OnAudioInputDevicesChangedNative() const;
+	void OnVoiceCatalogUpdatedNative(const FString& Locale) const;
+
 public:
 	UPROPERTY(BlueprintAssignable, Category = "AzSpeech | Management")
 	FAzSpeechTaskRegistrationUpdate OnAzSpeechTaskRegistered;
@@ -72,6 +148,12 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "AzSpeech | Management")
 	FAzSpeechTaskQueueExecutionProgress OnAzSpeechExecutionQueueProgressed;
 
+	UPROPERTY(BlueprintAssignable, Category = "AzSpeech | Management")
+	FAzSpeechAudioInputDevicesChanged OnAudioInputDevicesChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "AzSpeech | Management")
+	FAzSpeechVoiceCatalogUpdate OnVoiceCatalogUpdated;
+
 private:
 	mutable TArray<TWeakObjectPtr<class UAzSpeechTaskBase>> RegisteredTasks;
 
@@ -81,4 +163,15 @@ private:
 
 	// TMap doesnt support TQueue, so we use TArray instead
 	mutable TMap<int64, TArray<TWeakObjectPtr<class UAzSpeechTaskBase>>> TaskAudioQueueMap;
+
+	TSharedPtr<class FAzSpeechRunnablePool, ESPMode::ThreadSafe> RunnablePool;
+	TSharedPtr<class FAzSpeechEventQueue, ESPMode::ThreadSafe> EventQueue;
+	TSharedPtr<class FAzSpeechSynthesizerPool, ESPMode::ThreadSafe> SynthesizerPool;
+	TSharedPtr<class FAzSpeechSynthesisCache, ESPMode::ThreadSafe> SynthesisCache;
+	TSharedPtr<class FAzSpeechSynthesisDiskCache, ESPMode::ThreadSafe> SynthesisDiskCache;
+	TSharedPtr<class FAzSpeechAudioInputDeviceRegistry, ESPMode::ThreadSafe> AudioInputDeviceRegistry;
+	TSharedPtr<class FAzSpeechVoiceCatalog, ESPMode::ThreadSafe> VoiceCatalog;
+
+	double NextSynthesizerPoolEvictionTime = 0.0;
+	double NextSynthesisDiskCacheFlushTime = 0.0;
 };
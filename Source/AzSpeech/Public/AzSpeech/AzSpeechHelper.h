@@ -9,6 +9,7 @@
 #include "AzSpeech/Structures/AzSpeechAudioInputDeviceInfo.h"
 #include "AzSpeech/Structures/AzSpeechAnimationData.h"
 #include "AzSpeech/Structures/AzSpeechVisemeData.h"
+#include "AzSpeech/Structures/AzSpeechRecognitionMap.h"
 #include "AzSpeechHelper.generated.h"
 
 /**
@@ -76,6 +77,23 @@ public:
 	static USoundWave* ConvertAudioDataToSoundWave(const TArray<uint8>& RawData, const FString& OutputModule = "",
 	                                               const FString& RelativeOutputDirectory = "", const FString& OutputAssetName = "");
 
+	/* Same as ConvertAudioDataToSoundWave, but reads the shared audio buffer of the tasks without creating an intermediate array */
+	static USoundWave* ConvertAudioBufferToSoundWave(const class FAzSpeechAudioBuffer& AudioBuffer, const FString& OutputModule = "",
+	                                                 const FString& RelativeOutputDirectory = "", const FString& OutputAssetName = "");
+
+	/* Convert audio data (TArray<uint8>) to a transient USoundWave to be played at runtime: Faster than ConvertAudioDataToSoundWave, but the result can't be saved as an asset */
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Audio")
+	static USoundWave* ConvertAudioDataToTransientSoundWave(const TArray<uint8>& RawData);
+
+	/* Same as ConvertAudioDataToTransientSoundWave, but reads the shared audio buffer of the tasks without creating an intermediate array */
+	static USoundWave* ConvertAudioBufferToTransientSoundWave(const class FAzSpeechAudioBuffer& AudioBuffer);
+
+	/* Create a mono procedural sound wave to queue the synthesized chunks while the synthesis is still running */
+	static class USoundWaveProcedural* CreateStreamingSoundWave(const int32 SampleRate);
+
+	/* Queue a synthesized chunk into a streaming sound wave, skipping the wav header sent with the first chunk of riff formats. Returns the queued size */
+	static const int32 QueueStreamingAudioChunk(class USoundWaveProcedural* const SoundWave, const class FAzSpeechAudioBuffer& ChunkData);
+
 	/* Load a given .xml file and return the content as string */
 	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Utils", meta = (DisplayName = "Load XML to String"))
 	static const FString LoadXMLToString(const FString& FilePath, const FString& FileName);
@@ -172,6 +190,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AzSpeech | Data")
 	static const TArray<FAzSpeechAnimationData> ExtractAnimationDataFromVisemeDataArray(const TArray<FAzSpeechVisemeData>& VisemeData);
 
+	/* Synchronous version of Check Return from Recognition Map: Returns the value of the key that best matches the input string or -1 if there's no match (See Project Settings -> AzSpeech: Recognition Map) */
+	UFUNCTION(BlueprintPure, Category = "AzSpeech | Recognition Map", meta = (DisplayName = "Check Recognition Map"))
+	static const int32 CheckRecognitionMap(const FString& InString, const FName& GroupName, const bool bStopAtFirstTrigger, int32& MatchPoints);
+
+	/* Scores the input string against every group of the recognition map in a single pass: Returns a match per group, in the order of the settings */
+	UFUNCTION(BlueprintPure, Category = "AzSpeech | Recognition Map", meta = (DisplayName = "Check Recognition Map Groups"))
+	static const TArray<FAzSpeechRecognitionMatch> CheckRecognitionMapGroups(const FString& InString, const bool bStopAtFirstTrigger);
+
 	/* Cast object to AzSpeech Task Base */
 	UFUNCTION(BlueprintPure, Category = "AzSpeech | Casting")
 	static class UAzSpeechTaskBase* CastToAzSpeechTaskBase(UObject* const Object);
@@ -185,6 +211,15 @@ public:
 	static class UAzSpeechSynthesizerTaskBase* CastToAzSpeechSynthesizerTaskBase(UObject* const Object);
 
 	static const FString GetAzSpeechLogsBaseDir();
+	static const FString GetAzSpeechCacheBaseDir();
+
+	/* Create a task object that doesnt activate on creation. Use it to insert the task in an execution queue of AzSpeech Subsystem */
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Execution Queue",
+		meta = (WorldContext = "WorldContextObject", AutoCreateRefTerm = "PhraseListGroup"))
+	static class UAzSpeechTaskBase* CreateAudioDataToTextTask(UObject* const WorldContextObject,
+	                                                          const FAzSpeechSubscriptionOptions& SubscriptionOptions,
+	                                                          const FAzSpeechRecognitionOptions& RecognitionOptions, const TArray<uint8>& AudioData,
+	                                                          const FName& PhraseListGroup = NAME_None);
 
 	/* Create a task object that doesnt activate on creation. Use it to insert the task in an execution queue of AzSpeech Subsystem */
 	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Execution Queue",
@@ -257,4 +292,10 @@ public:
 	                                                        const FAzSpeechSubscriptionOptions& SubscriptionOptions,
 	                                                        const FAzSpeechRecognitionOptions& RecognitionOptions, const FString& FilePath,
 	                                                        const FString& FileName, const FName& PhraseListGroup = NAME_None);
+
+private:
+	static USoundWave* ConvertRawAudioToSoundWave(const TArrayView<const uint8>& RawData, const FString& OutputModule,
+	                                              const FString& RelativeOutputDirectory, const FString& OutputAssetName);
+
+	static USoundWave* CreateTransientSoundWave(const TArrayView<const uint8>& RawData);
 };
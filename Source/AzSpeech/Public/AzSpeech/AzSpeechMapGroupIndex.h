@@ -0,0 +1,49 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeech/Structures/AzSpeechPhraseListMap.h"
+#include "AzSpeech/Structures/AzSpeechRecognitionMap.h"
+#include <memory>
+#include <string>
+
+class UAzSpeechSettings;
+
+/**
+ * Immutable snapshot of the phrase list and recognition map groups of the settings, indexed by group name
+ */
+class AZSPEECH_API FAzSpeechMapGroupIndex
+{
+public:
+	FAzSpeechMapGroupIndex() = default;
+	explicit FAzSpeechMapGroupIndex(const UAzSpeechSettings& Settings);
+
+	/* Empty view if the group doesn't exist: Views are valid while the index is alive */
+	TArrayView<const FString> GetPhraseList(const FName& GroupName) const;
+
+	/* Phrases converted to UTF-8 when the index is built, ready to be sent to the SDK */
+	TArrayView<const std::string> GetPhraseListUTF8(const FName& GroupName) const;
+
+	/* Nullptr if the group doesn't exist or is empty */
+	const FAzSpeechRecognitionMap* FindRecognitionMap(const FName& GroupName) const;
+
+	/* Groups with a valid name and data, in the order of the settings */
+	TArrayView<const FAzSpeechRecognitionMap> GetRecognitionMaps() const;
+
+	/* Thread safe: Returns the current index, building it from the settings at the first use */
+	static std::shared_ptr<const FAzSpeechMapGroupIndex> Get();
+
+	/* Replaces the current index: Called by the settings when they are loaded or changed */
+	static void Rebuild(const UAzSpeechSettings& Settings);
+
+private:
+	TArray<FAzSpeechPhraseListMap> PhraseLists;
+	TArray<TArray<std::string>> PhraseListsUTF8;
+	TMap<FName, int32> PhraseListIndices;
+
+	TArray<FAzSpeechRecognitionMap> RecognitionMaps;
+	TMap<FName, int32> RecognitionMapIndices;
+};
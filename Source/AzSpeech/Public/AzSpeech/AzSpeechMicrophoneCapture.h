@@ -0,0 +1,71 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeech/AzSpeechAudioConverter.h"
+#include "AzSpeech/AzSpeechVoiceActivityDetector.h"
+#include <atomic>
+
+THIRD_PARTY_INCLUDES_START
+#include <speechapi_cxx_audio_config.h>
+#include <speechapi_cxx_audio_stream.h>
+THIRD_PARTY_INCLUDES_END
+
+namespace Audio
+{
+	class FAudioCapture;
+}
+
+/**
+ * Captures the microphone with the engine audio capture and feeds a push stream: Silence can be removed by the voice activity detector
+ */
+class AZSPEECH_API FAzSpeechMicrophoneCapture
+{
+public:
+	FAzSpeechMicrophoneCapture() = delete;
+	FAzSpeechMicrophoneCapture(const bool bInEnableVoiceActivityDetection, const FAzSpeechVoiceActivitySettings& InVoiceActivitySettings);
+
+	~FAzSpeechMicrophoneCapture();
+
+	/* Opens the capture device and starts feeding the push stream: Empty ID to use the default device */
+	const bool Start(const FString& DeviceID);
+
+	/* Closes the capture device and the push stream: The recognizer receives the end of the stream */
+	void Stop();
+
+	std::shared_ptr<Microsoft::CognitiveServices::Speech::Audio::AudioConfig> GetAudioConfig() const;
+
+	const int64 GetNumCapturedSamples() const;
+	const int64 GetNumSentSamples() const;
+
+	/* Format expected by the recognizers: 16 kHz 16 bits mono PCM */
+	static constexpr int32 StreamSampleRate = 16000;
+
+private:
+	void OnAudioCaptured(const float* const InAudio, const int32 NumFrames, const int32 NumChannels, const int32 SampleRate);
+	void Send(const TArrayView<const float> Samples);
+
+	TUniquePtr<Audio::FAudioCapture> AudioCapture;
+
+	std::shared_ptr<Microsoft::CognitiveServices::Speech::Audio::PushAudioInputStream> PushStream;
+	std::shared_ptr<Microsoft::CognitiveServices::Speech::Audio::AudioConfig> AudioConfig;
+
+	bool bEnableVoiceActivityDetection;
+	FAzSpeechVoiceActivityDetector VoiceActivityDetector;
+
+	// Created with the format of the first callback: Only recreated if the device format changes
+	TUniquePtr<FAzSpeechAudioConverter> AudioConverter;
+
+	// Capture thread buffers: Reused between callbacks
+	TArray<float> ResampledBuffer;
+	TArray<int16> PCMBuffer;
+
+	FCriticalSection Mutex;
+	bool bIsCapturing = false;
+
+	std::atomic<int64> NumCapturedSamples = 0;
+	std::atomic<int64> NumSentSamples = 0;
+};
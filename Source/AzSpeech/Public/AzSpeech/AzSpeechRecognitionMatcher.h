@@ -0,0 +1,109 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+struct FAzSpeechRecognitionMap;
+struct FAzSpeechRecognitionMatch;
+
+/**
+ * Recognition map group compiled into a case-insensitive Aho-Corasick automaton: All keys are matched in a single pass over the string
+ */
+class AZSPEECH_API FAzSpeechRecognitionMatcher
+{
+public:
+	FAzSpeechRecognitionMatcher() = delete;
+	FAzSpeechRecognitionMatcher(const FAzSpeechRecognitionMap& InMap, const FString& InStringDelimiters);
+
+	/* Compiles all groups into a single automaton: The string is scored against every group in the same pass */
+	FAzSpeechRecognitionMatcher(const TArrayView<const FAzSpeechRecognitionMap> InMaps, const FString& InStringDelimiters);
+
+	/* Returns the value of the recognition data of the first group that best matches the string or -1 if there's no match */
+	const int32 Match(const FString& InString, const bool bStopAtFirstTrigger, uint32& OutMatchPoints) const;
+
+	/* Scores the string against every group: Outputs a match per group, in the order of the groups */
+	void MatchAllGroups(const FString& InString, const bool bStopAtFirstTrigger, TArray<FAzSpeechRecognitionMatch>& OutMatches) const;
+
+	const FName GetGroupName(const int32 GroupIndex = 0) const;
+	const int32 GetNumGroups() const;
+	const int32 GetNumKeys() const;
+	const SIZE_T GetAllocatedSize() const;
+
+	/* Thread safe: Returns the compiled group of the recognition map in the settings, compiling it at the first use */
+	static TSharedPtr<const FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe> GetCompiledGroup(const FName& InGroupName);
+
+	/* Thread safe: Returns all groups of the recognition map in the settings compiled together, compiling them at the first use */
+	static TSharedPtr<const FAzSpeechRecognitionMatcher, ESPMode::ThreadSafe> GetCompiledMap();
+
+	/* Discards the compiled groups: Called when the settings change */
+	static void InvalidateCompiledGroups();
+
+private:
+	enum class EAzSpeechKeyType : uint8
+	{
+		Requirement,
+		GlobalIgnore,
+		Ignore,
+		Trigger
+	};
+
+	struct FAzSpeechKeyUsage
+	{
+		EAzSpeechKeyType Type = EAzSpeechKeyType::Trigger;
+		int32 GroupIndex = 0;
+		int32 DataIndex = INDEX_NONE;
+	};
+
+	struct FAzSpeechKeyPattern
+	{
+		int32 Length = 0;
+		int32 FirstUsage = 0;
+		int32 NumUsages = 0;
+	};
+
+	struct FAzSpeechMatcherNode
+	{
+		int32 FirstEdge = 0;
+		int32 NumEdges = 0;
+		int32 Fail = 0;
+		int32 DictionaryLink = INDEX_NONE;
+		int32 Pattern = INDEX_NONE;
+	};
+
+	struct FAzSpeechMatcherEntry
+	{
+		int32 Value = -1;
+		int32 Weight = 1;
+	};
+
+	struct FAzSpeechMatcherGroup
+	{
+		FName GroupName = NAME_None;
+		bool bHasRequirementKeys = false;
+	};
+
+	void Compile(const TArrayView<const FAzSpeechRecognitionMap> InMaps);
+	void SetStringDelimiters(const FString& InStringDelimiters);
+
+	/* Single pass over the string: Calls the function with the group index, value and match points of each group */
+	void MatchGroups(const FString& InString, const bool bStopAtFirstTrigger, const TFunctionRef<void(int32, int32, uint32)> Function) const;
+
+	const int32 FindTransition(const int32 Node, const TCHAR Character) const;
+	const bool IsDelimiter(const TCHAR Character) const;
+
+	TArray<FAzSpeechMatcherGroup> Groups;
+
+	TArray<FAzSpeechMatcherNode> Nodes;
+	TArray<TCHAR> EdgeCharacters;
+	TArray<int32> EdgeTargets;
+
+	TArray<FAzSpeechKeyPattern> Patterns;
+	TArray<FAzSpeechKeyUsage> Usages;
+	TArray<FAzSpeechMatcherEntry> Entries;
+
+	uint64 AsciiDelimiters[2] = {0u, 0u};
+	TArray<TCHAR> OtherDelimiters;
+};
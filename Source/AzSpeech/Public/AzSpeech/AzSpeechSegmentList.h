@@ -0,0 +1,166 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <memory>
+
+/**
+ * Append-only list of immutable segments: Copies share all segments, so a copy followed by an Add costs O(1) regardless of the list size
+ */
+template <typename ValueType>
+class TAzSpeechSegmentList
+{
+	struct FSegment;
+
+public:
+	/* Identifies the last segment of a list without keeping it alive: Used to check if another list extends the one the handle was taken from */
+	class FHandle
+	{
+		friend class TAzSpeechSegmentList;
+
+		std::weak_ptr<const FSegment> Segment;
+		int32 NumSegments = 0;
+	};
+
+	TAzSpeechSegmentList() = default;
+	TAzSpeechSegmentList(const TAzSpeechSegmentList&) = default;
+	TAzSpeechSegmentList(TAzSpeechSegmentList&&) = default;
+	TAzSpeechSegmentList& operator=(const TAzSpeechSegmentList&) = default;
+	TAzSpeechSegmentList& operator=(TAzSpeechSegmentList&&) = default;
+
+	~TAzSpeechSegmentList()
+	{
+		Empty();
+	}
+
+	/* Links a new segment to the current ones: The previous segments are never copied or changed, other copies of the list don't see it */
+	void Add(ValueType&& Value)
+	{
+		Head = std::make_shared<const FSegment>(MoveTemp(Value), Head, Num() + 1);
+	}
+
+	void Add(const ValueType& Value)
+	{
+		Add(ValueType(Value));
+	}
+
+	void Empty()
+	{
+		// Releases the segments only owned by this list one by one: The recursive destruction of a long list could overflow the stack
+		while (Head && Head.use_count() == 1)
+		{
+			std::shared_ptr<const FSegment> Previous = Head->Previous;
+			Head = MoveTemp(Previous);
+		}
+
+		Head.reset();
+	}
+
+	const int32 Num() const
+	{
+		return Head ? Head->NumSegments : 0;
+	}
+
+	const bool IsEmpty() const
+	{
+		return !Head;
+	}
+
+	/* Last added segment: The list must not be empty */
+	const ValueType& Last() const
+	{
+		check(Head);
+		return Head->Value;
+	}
+
+	const FHandle GetLastHandle() const
+	{
+		FHandle Output;
+		Output.Segment = Head;
+		Output.NumSegments = Num();
+
+		return Output;
+	}
+
+	/* True if this list contains the segment of the handle: Same list or extended from a copy of it, not a new list with more segments */
+	const bool Contains(const FHandle& Handle) const
+	{
+		if (Handle.NumSegments == 0)
+		{
+			return true;
+		}
+
+		// The segment is alive while a list contains it: An expired handle can't belong to this list
+		const std::shared_ptr<const FSegment> HandleSegment = Handle.Segment.lock();
+		if (!HandleSegment || Handle.NumSegments > Num())
+		{
+			return false;
+		}
+
+		const FSegment* Segment = Head.get();
+		for (int32 Index = Num(); Index > Handle.NumSegments; --Index)
+		{
+			Segment = Segment->Previous.get();
+		}
+
+		return Segment == HandleSegment.get();
+	}
+
+	/* Calls the function for each segment in the order they were added, starting at the given index: Only the visited segments are walked */
+	template <typename FunctionType>
+	void ForEach(FunctionType&& Function, const int32 FirstIndex = 0) const
+	{
+		const int32 NumVisited = Num() - FMath::Max(FirstIndex, 0);
+		if (NumVisited <= 0)
+		{
+			return;
+		}
+
+		// Segments are linked from the last to the first one
+		TArray<const ValueType*, TInlineAllocator<32>> Values;
+		Values.SetNumUninitialized(NumVisited);
+
+		const FSegment* Segment = Head.get();
+		for (int32 Index = NumVisited - 1; Index >= 0; --Index, Segment = Segment->Previous.get())
+		{
+			Values[Index] = &Segment->Value;
+		}
+
+		for (const ValueType* const Value : Values)
+		{
+			Function(*Value);
+		}
+	}
+
+	/* Copies the segments to a new array in the order they were added */
+	TArray<ValueType> ToArray() const
+	{
+		TArray<ValueType> Output;
+		Output.Reserve(Num());
+
+		ForEach([&Output](const ValueType& Value)
+		{
+			Output.Add(Value);
+		});
+
+		return Output;
+	}
+
+private:
+	struct FSegment
+	{
+		FSegment(ValueType&& InValue, const std::shared_ptr<const FSegment>& InPrevious, const int32 InNumSegments)
+			: Value(MoveTemp(InValue)), Previous(InPrevious), NumSegments(InNumSegments)
+		{
+		}
+
+		const ValueType Value;
+		const std::shared_ptr<const FSegment> Previous;
+		const int32 NumSegments;
+	};
+
+	std::shared_ptr<const FSegment> Head;
+};
@@ -36,15 +36,94 @@ public:
 	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Thread", Meta = (DisplayName = "Thread Priority"))
 	EAzSpeechThreadPriority TasksThreadPriority;
 
-	/* Thread update interval: Sleep time between task update checks */
+	/* Thread update interval: Sleep time between task update checks. Only used by dedicated threads when Use Stop Event is disabled */
 	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Thread",
-		Meta = (DisplayName = "Thread Update Interval", ClampMin = "0.0001", UIMin = "0.0001", ClampMax = "1", UIMax = "1"))
+		Meta = (DisplayName = "Thread Update Interval", EditCondition = "!bUseStopEvent", ClampMin = "0.0001", UIMin = "0.0001", ClampMax = "1",
+			UIMax = "1", DeprecatedProperty, DeprecationMessage = "Dedicated threads wait on a stop event: Only used when Use Stop Event is disabled"))
 	float ThreadUpdateInterval;
 
+	/* If enabled, dedicated threads wait on an event until the task reaches its final result instead of polling it every Thread Update Interval */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Thread", Meta = (DisplayName = "Use Stop Event"))
+	bool bUseStopEvent;
+
+	/* If enabled, tasks will share a fixed number of worker threads instead of creating a dedicated thread per task */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Thread", Meta = (DisplayName = "Use Shared Thread Pool", ConfigRestartRequired = true))
+	bool bUseSharedThreadPool;
+
+	/* Number of worker threads used by the shared thread pool */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Thread",
+		Meta = (DisplayName = "Thread Pool Size", EditCondition = "bUseSharedThreadPool", ClampMin = "1", UIMin = "1", ClampMax = "32", UIMax = "32",
+			ConfigRestartRequired = true))
+	int32 ThreadPoolSize;
+
+	/* If enabled, the events sent by the Azure SDK are queued and dispatched in batches once per frame instead of scheduling a game thread task per event */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Thread", Meta = (DisplayName = "Use Batched Event Dispatch", ConfigRestartRequired = true))
+	bool bUseBatchedEventDispatch;
+
+	/* Maximum time in milliseconds spent dispatching queued events per frame: Remaining events are dispatched in the next frame. 0 to dispatch all events */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Thread",
+		Meta = (DisplayName = "Event Dispatch Budget in Milliseconds", EditCondition = "bUseBatchedEventDispatch", ClampMin = "0", UIMin = "0",
+			ClampMax = "100", UIMax = "100"))
+	float EventDispatchFrameBudget;
+
+	/* If enabled, audio data synthesis tasks will reuse warm synthesizers created with the same subscription, language, voice and output format: Idle pooled synthesizers keep their service connection until evicted */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Synthesizer Pool", Meta = (DisplayName = "Enable Synthesizer Pool", ConfigRestartRequired = true))
+	bool bEnableSynthesizerPool;
+
+	/* Maximum number of idle synthesizers kept alive by the pool */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Synthesizer Pool",
+		Meta = (DisplayName = "Synthesizer Pool Size", EditCondition = "bEnableSynthesizerPool", ClampMin = "1", UIMin = "1", ClampMax = "64", UIMax = "64",
+			ConfigRestartRequired = true))
+	int32 SynthesizerPoolSize;
+
+	/* Time in seconds that an idle synthesizer can stay in the pool before being released: 0 to never release idle synthesizers */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Synthesizer Pool",
+		Meta = (DisplayName = "Synthesizer Pool Idle Timeout in Seconds", EditCondition = "bEnableSynthesizerPool", ClampMin = "0", UIMin = "0",
+			ConfigRestartRequired = true))
+	float SynthesizerPoolIdleTimeout;
+
+	/* If enabled, new synthesizers will open their connection once when they enter the pool: It stays open until the synthesizer is evicted */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Synthesizer Pool",
+		Meta = (DisplayName = "Pre-Connect Pooled Synthesizers", EditCondition = "bEnableSynthesizerPool", ConfigRestartRequired = true))
+	bool bPreConnectPooledSynthesizers;
+
+	/* If enabled, audio and viseme results of synthesis tasks will be kept in memory and reused by tasks with the same content and options: Disabled by default, repeated requests are sent to the service unless this is enabled */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Synthesis Cache", Meta = (DisplayName = "Enable Synthesis Cache", ConfigRestartRequired = true))
+	bool bEnableSynthesisCache;
+
+	/* Maximum memory in megabytes used by the synthesis cache: The least recently used results are removed when this limit is reached */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Synthesis Cache",
+		Meta = (DisplayName = "Synthesis Cache Memory Budget in MB", EditCondition = "bEnableSynthesisCache", ClampMin = "1", UIMin = "1",
+			ConfigRestartRequired = true))
+	int32 SynthesisCacheMemoryBudget;
+
+	/* If enabled, synthesis results will also be persisted in Saved/AzSpeechCache and reused after restarts */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Synthesis Cache", Meta = (DisplayName = "Enable Synthesis Disk Cache", ConfigRestartRequired = true))
+	bool bEnableSynthesisDiskCache;
+
+	/* Maximum size in megabytes of the synthesis disk cache: The least recently used files are removed when this limit is reached */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Synthesis Cache",
+		Meta = (DisplayName = "Synthesis Disk Cache Size in MB", EditCondition = "bEnableSynthesisDiskCache", ClampMin = "1", UIMin = "1",
+			ConfigRestartRequired = true))
+	int32 SynthesisDiskCacheSize;
+
+	/* Time in hours that the voices of a locale are reused before being requested again in the background: 0 to never expire */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Voice Catalog",
+		Meta = (DisplayName = "Voice Catalog Time To Live in Hours", ClampMin = "0", UIMin = "0", ConfigRestartRequired = true))
+	float VoiceCatalogTimeToLive;
+
+	/* If enabled, the voice catalog will be persisted in Saved/AzSpeechCache and reused after restarts */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Voice Catalog", Meta = (DisplayName = "Enable Voice Catalog Disk Cache", ConfigRestartRequired = true))
+	bool bEnableVoiceCatalogDiskCache;
+
 	/* If enabled, SSML synthesizers tasks with viseme output type set to FacialExpression will return only data that contains the Animation property */
 	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Information", Meta = (DisplayName = "Filter Viseme Facial Expression"))
 	bool bFilterVisemeFacialExpression;
 
+	/* If enabled, the viseme data received in the same frame is delivered to the tasks as a single batch instead of one game thread event per viseme */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Information", Meta = (DisplayName = "Batch Viseme Events"))
+	bool bBatchVisemeEvents;
+
 	/* If enabled, logs will be generated inside Saved/Logs/AzSpeech folder whenever a task fails - Disabled for Android, iOS & Shipping builds */
 	UPROPERTY(GlobalConfig, EditAnywhere, Category = "Information", Meta = (DisplayName = "Enable Azure SDK Logs"))
 	bool bEnableSDKLogs;
@@ -113,6 +192,7 @@ private:
 	void ValidateCandidateLanguages(const bool bRemoveEmpties = false);
 	void ToggleInternalLogs();
 	void ValidateRecognitionMap();
+	void UpdateMapGroups() const;
 	void ValidatePhraseList();
 	void ValidateEndpoint();
 
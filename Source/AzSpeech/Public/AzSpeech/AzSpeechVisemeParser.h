@@ -0,0 +1,34 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+/**
+ *
+ */
+struct FAzSpeechVisemeAnimationInfo
+{
+	int32 FrameIndex = 0;
+	int32 NumFrames = 0;
+};
+
+/**
+ *
+ */
+class AZSPEECH_API FAzSpeechVisemeParser
+{
+public:
+	/*
+	 * Reads the animation sent with the viseme events: {"FrameIndex":0,"BlendShapes":[[...],[...]]}
+	 * The weights of each frame are appended to OutBlendShapes using InOutNumBlendShapes as the frame stride: 0 to use the size of the first frame
+	 * Nothing is appended if the animation is malformed
+	 */
+	static const bool ParseAnimation(const ANSICHAR* const Data, const int32 Num, FAzSpeechVisemeAnimationInfo& OutInfo, int32& InOutNumBlendShapes,
+	                                 TArray<float>& OutBlendShapes);
+
+	static const bool ParseAnimation(const TCHAR* const Data, const int32 Num, FAzSpeechVisemeAnimationInfo& OutInfo, int32& InOutNumBlendShapes,
+	                                 TArray<float>& OutBlendShapes);
+};
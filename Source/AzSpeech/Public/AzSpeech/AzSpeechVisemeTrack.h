@@ -0,0 +1,70 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeech/Structures/AzSpeechVisemeData.h"
+#include "AzSpeech/Structures/AzSpeechAnimationData.h"
+
+/**
+ *
+ */
+class AZSPEECH_API FAzSpeechVisemeTrack
+{
+public:
+	FAzSpeechVisemeTrack() = default;
+
+	/* Decodes the animation of the viseme into the blend shape buffer: The animation string is not stored */
+	void Add(const FAzSpeechVisemeData& VisemeData);
+
+	/* Decodes the animation directly from the UTF-8 string received from the SDK */
+	void Add(const int32 VisemeID, const int64 AudioOffsetMilliseconds, const ANSICHAR* const Animation, const int32 AnimationLength);
+	void Append(const FAzSpeechVisemeTrack& Other);
+	void Empty();
+
+	const int32 Num() const;
+	const bool IsEmpty() const;
+
+	const int32 GetVisemeID(const int32 Index) const;
+	const int64 GetAudioOffsetMilliseconds(const int32 Index) const;
+
+	/* Index of the first animation frame delivered with the viseme */
+	const int32 GetFrameIndex(const int32 Index) const;
+
+	/* Number of blend shapes of each animation frame */
+	const int32 GetNumBlendShapes() const;
+	const int32 GetNumFrames(const int32 Index) const;
+
+	/* Blend shape weights of all animation frames delivered with the viseme: NumFrames * NumBlendShapes values */
+	TArrayView<const float> GetBlendShapes(const int32 Index) const;
+
+	/* Rebuilds the viseme data, including the animation string: Only use it when the original structure is required, e.g. Blueprint delegates */
+	const FAzSpeechVisemeData GetVisemeData(const int32 Index) const;
+	const TArray<FAzSpeechVisemeData> ToArray() const;
+
+	const FAzSpeechAnimationData GetAnimationData(const int32 Index) const;
+	const TArray<FAzSpeechAnimationData> ToAnimationDataArray() const;
+
+	const int64 GetAllocatedSize() const;
+
+	friend FArchive& operator<<(FArchive& Ar, FAzSpeechVisemeTrack& Track);
+
+private:
+	template <typename CharType>
+	void Add_Internal(const int32 VisemeID, const int64 AudioOffsetMilliseconds, const CharType* const Animation, const int32 AnimationLength);
+
+	struct FAzSpeechVisemeEntry
+	{
+		int32 VisemeID = -1;
+		int32 FrameIndex = 0;
+		int64 AudioOffsetMilliseconds = -1;
+		int32 FirstBlendShapeIndex = 0;
+		int32 NumFrames = 0;
+	};
+
+	TArray<FAzSpeechVisemeEntry> Entries;
+	TArray<float> BlendShapes;
+	int32 NumBlendShapes = 0;
+};
@@ -0,0 +1,87 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Templates/Function.h>
+
+/**
+ *
+ */
+struct FAzSpeechVoiceActivitySettings
+{
+	int32 SampleRate = 16000;
+	int32 FrameDurationMs = 20;
+
+	/* Frames below this energy are never voiced: dBFS */
+	float EnergyThresholdDb = -45.f;
+
+	/* Frames must be louder than the estimated noise floor by this margin to be voiced: dB */
+	float NoiseFloorMarginDb = 9.f;
+
+	/* Zero crossings per sample above this rate are considered noise unless the frame is much louder than the threshold */
+	float MaxZeroCrossingRate = 0.35f;
+
+	/* Time that unvoiced frames keep being forwarded after the last voiced frame */
+	int32 HangoverMs = 800;
+
+	/* Time of audio kept before the first voiced frame: Avoids cutting the start of the speech */
+	int32 PreRollMs = 200;
+};
+
+/**
+ * Energy and zero crossing voice activity detector: Only the voiced frames, the pre-roll and the hangover are forwarded
+ */
+class AZSPEECH_API FAzSpeechVoiceActivityDetector
+{
+public:
+	FAzSpeechVoiceActivityDetector() = delete;
+	explicit FAzSpeechVoiceActivityDetector(const FAzSpeechVoiceActivitySettings& InSettings);
+
+	/* Processes mono samples in frames: Incomplete frames are kept until the next call */
+	void Process(TArrayView<const float> Samples, TFunctionRef<void(TArrayView<const float>)> OnForward);
+
+	/* Returns true if the frame is voiced and updates the noise floor with unvoiced frames */
+	const bool IsVoicedFrame(TArrayView<const float> Frame);
+
+	void Reset();
+
+	const bool IsVoiceActive() const;
+	const int32 GetFrameSize() const;
+
+	const int64 GetNumProcessedFrames() const;
+	const int64 GetNumForwardedFrames() const;
+
+	/* Mean of the squared samples */
+	static const float GetFrameEnergy(const float* const Samples, const int32 NumSamples);
+
+	/* Number of sign changes between consecutive samples */
+	static const int32 GetZeroCrossings(const float* const Samples, const int32 NumSamples);
+
+private:
+	void ProcessFrame(const float* const Frame, TFunctionRef<void(TArrayView<const float>)> OnForward);
+
+	FAzSpeechVoiceActivitySettings Settings;
+
+	int32 FrameSize = 0;
+	int32 HangoverFrames = 0;
+	int32 PreRollFrames = 0;
+
+	float EnergyThreshold = 0.f;
+	float NoiseFloorMargin = 0.f;
+	float NoiseFloor = 0.f;
+
+	TArray<float> PendingSamples;
+
+	// Ring buffer with the last unvoiced frames
+	TArray<float> PreRollBuffer;
+	int32 PreRollHead = 0;
+	int32 PreRollCount = 0;
+
+	int32 RemainingHangoverFrames = 0;
+
+	int64 NumProcessedFrames = 0;
+	int64 NumForwardedFrames = 0;
+};
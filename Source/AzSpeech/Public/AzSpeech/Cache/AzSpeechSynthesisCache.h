@@ -0,0 +1,72 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Containers/List.h>
+#include "AzSpeech/AzSpeechAudioBuffer.h"
+#include "AzSpeech/Structures/AzSpeechSettingsOptions.h"
+#include "AzSpeech/AzSpeechVisemeTrack.h"
+#include "AzSpeech/Structures/AzSpeechSynthesisCacheStats.h"
+
+/**
+ *
+ */
+struct FAzSpeechCachedSynthesis
+{
+	FAzSpeechAudioBuffer AudioData;
+	FAzSpeechVisemeTrack VisemeTrack;
+	int64 AudioDuration = 0;
+
+	const int64 GetAllocatedSize() const;
+};
+
+/**
+ *
+ */
+class AZSPEECH_API FAzSpeechSynthesisCache
+{
+public:
+	FAzSpeechSynthesisCache() = delete;
+	explicit FAzSpeechSynthesisCache(const int64 InBudgetBytes);
+
+	/* Hash of the content and options that change the synthesized audio */
+	static const uint64 MakeKey(const FString& SynthesisText, const bool bIsSSMLBased, const FAzSpeechSynthesisOptions& SynthesisOptions);
+	static const uint64 MakeKey(const FString& KeyContent);
+
+	/* Full content hashed by MakeKey: Stored by the disk cache to reject hash collisions */
+	static const FString MakeKeyContent(const FString& SynthesisText, const bool bIsSSMLBased, const FAzSpeechSynthesisOptions& SynthesisOptions);
+
+	/* Returns the cached result and marks it as the most recently used one */
+	TSharedPtr<const FAzSpeechCachedSynthesis, ESPMode::ThreadSafe> Find(const uint64 Key);
+
+	void Add(const uint64 Key, const TSharedRef<const FAzSpeechCachedSynthesis, ESPMode::ThreadSafe>& Value);
+	void Empty();
+
+	const FAzSpeechSynthesisCacheStats GetStats() const;
+
+private:
+	struct FAzSpeechSynthesisCacheEntry
+	{
+		TSharedPtr<const FAzSpeechCachedSynthesis, ESPMode::ThreadSafe> Value;
+		TDoubleLinkedList<uint64>::TDoubleLinkedListNode* LruNode = nullptr;
+		int64 AllocatedSize = 0;
+	};
+
+	void Remove_Internal(const uint64 Key);
+
+	mutable FCriticalSection Mutex;
+	TMap<uint64, FAzSpeechSynthesisCacheEntry> Entries;
+
+	// Head: Most recently used. Tail: Next to be evicted
+	TDoubleLinkedList<uint64> LruList;
+
+	int64 BudgetBytes;
+	int64 UsedBytes = 0;
+
+	int64 NumHits = 0;
+	int64 NumMisses = 0;
+	int64 NumEvictions = 0;
+};
@@ -0,0 +1,86 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeech/Cache/AzSpeechSynthesisCache.h"
+#include <atomic>
+
+/**
+ *
+ */
+class FAzSpeechSynthesisDiskCache : public TSharedFromThis<FAzSpeechSynthesisDiskCache, ESPMode::ThreadSafe>
+{
+public:
+	FAzSpeechSynthesisDiskCache() = delete;
+	FAzSpeechSynthesisDiskCache(const FString& InCacheDirectory, const int64 InBudgetBytes);
+
+	~FAzSpeechSynthesisDiskCache();
+
+	/* Loads the index in a background task: Find returns a miss until the index is ready */
+	void LoadIndexAsync();
+
+	/* Maps the cached file in memory: The audio data of the result points to the mapped region. The key content is compared with the stored one to reject hash collisions */
+	TSharedPtr<const FAzSpeechCachedSynthesis, ESPMode::ThreadSafe> Find(const uint64 Key, const FString& KeyContent);
+
+	/* Writes the result to the cache directory: Prefer to call it outside the game thread */
+	void Add(const uint64 Key, const FString& KeyContent, const FAzSpeechCachedSynthesis& Value);
+
+	/* Saves the index file if there are pending changes: Find and Add only mark the index as changed */
+	void Flush();
+
+	/* Saves the index file in a background task if there are pending changes */
+	void FlushAsync();
+
+	void Empty();
+
+	const FAzSpeechSynthesisCacheStats GetStats() const;
+
+private:
+	struct FAzSpeechDiskCacheEntry
+	{
+		int64 FileSize = 0;
+		int64 LastAccessTicks = 0;
+
+		// Not persisted: Identifies the write of the entry, so a failed read only removes the entry that was read
+		uint64 Revision = 0;
+	};
+
+	const FString GetEntryFileName(const uint64 Key) const;
+	const FString GetIndexFileName() const;
+
+	/* Loads the index if it wasn't loaded yet and blocks until it's ready: Avoid calling it in the game thread */
+	void LoadIndex_Internal();
+
+	/* Reads the index and removes leftover files: Doesn't touch the members protected by the mutex */
+	void ReadIndex_Internal(TMap<uint64, FAzSpeechDiskCacheEntry>& OutEntries, int64& OutUsedBytes) const;
+
+	/* Removes the entry from the index: The file is deleted by the caller, after releasing the mutex */
+	const bool Remove_Internal(const uint64 Key);
+	void DeleteEntryFile(const uint64 Key) const;
+
+	void OnFindFailed(const uint64 Key, const uint64 Revision, const bool bRemoveEntry);
+
+	mutable FCriticalSection Mutex;
+	TMap<uint64, FAzSpeechDiskCacheEntry> Entries;
+
+	// Serializes the index loading, which scans the cache directory without holding the main mutex
+	FCriticalSection LoadMutex;
+
+	// Serializes the index writes, which run without holding the main mutex: An older index must never replace a newer one
+	FCriticalSection SaveMutex;
+
+	FString CacheDirectory;
+	int64 BudgetBytes;
+	int64 UsedBytes = 0;
+
+	bool bIndexLoaded = false;
+	bool bIndexDirty = false;
+	uint64 NextRevision = 1;
+
+	std::atomic<int64> NumHits = 0;
+	std::atomic<int64> NumMisses = 0;
+	int64 NumEvictions = 0;
+};
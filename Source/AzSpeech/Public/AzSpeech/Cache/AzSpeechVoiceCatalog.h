@@ -0,0 +1,90 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeech/Structures/AzSpeechVoiceInfo.h"
+#include "AzSpeech/Structures/AzSpeechSettingsOptions.h"
+#include <Templates/SharedPointer.h>
+#include <Templates/Function.h>
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FAzSpeechVoiceCatalogUpdated, const FString& /* Locale */);
+
+/**
+ * Keeps the voices available to the default subscription per locale: Expired locales are still returned while they're refreshed in the background
+ */
+class AZSPEECH_API FAzSpeechVoiceCatalog : public TSharedFromThis<FAzSpeechVoiceCatalog, ESPMode::ThreadSafe>
+{
+public:
+	using FVoiceList = TArray<FAzSpeechVoiceInfo>;
+	using FVoiceListPtr = TSharedPtr<const FVoiceList, ESPMode::ThreadSafe>;
+
+	FAzSpeechVoiceCatalog() = delete;
+
+	/* Empty cache file name to keep the catalog only in memory */
+	FAzSpeechVoiceCatalog(const FString& InCacheFileName, const FTimespan& InTimeToLive);
+
+	/* Reads the cache file in a background task: Otherwise the first Find or Get reads it */
+	void LoadAsync();
+
+	/* Thread safe: Returns the cached voices of the locale and requests a refresh if they're missing or expired. Empty locale for all voices */
+	FVoiceListPtr Find(const FString& Locale);
+
+	/* Calls back immediately if the locale is cached, otherwise in the game thread once the voices are received: Empty list if the request fails */
+	void Get(const FString& Locale, TFunction<void(const FVoiceListPtr&)>&& Callback);
+
+	/* Requests the voices of the locale in the background, even if they're still valid */
+	void RequestRefresh(const FString& Locale);
+
+	/* Saves the catalog if there are pending changes: The file is written without holding the catalog lock */
+	void Flush();
+	void Empty();
+
+	/* Called in the game thread when the voices of a locale are updated */
+	FAzSpeechVoiceCatalogUpdated OnVoicesUpdated;
+
+	/* Blocking request to Azure: Avoid calling it in the game thread */
+	static const bool FetchVoices(const FAzSpeechSubscriptionOptions& SubscriptionOptions, const FString& Locale, FVoiceList& OutVoices);
+
+private:
+	struct FAzSpeechVoiceCatalogEntry
+	{
+		FVoiceListPtr Voices;
+		int64 UpdateTicks = 0;
+	};
+
+	FVoiceListPtr Find_Internal(const FString& Locale, bool& bOutExpired);
+	void RequestRefresh_Internal(const FString& Locale);
+	void OnVoicesReceived(const FString& Locale, const FString& RequestSourceID, const FVoiceListPtr& Voices);
+
+	const bool IsExpired(const FAzSpeechVoiceCatalogEntry& Entry) const;
+
+	void ValidateSource_Internal();
+
+	/* Reads the cache file if it wasn't read yet: The file is read without holding the main mutex */
+	void Load();
+	void ReadCatalog(const FString& ExpectedSourceID, TMap<FString, FAzSpeechVoiceCatalogEntry>& OutEntries) const;
+
+	static const FString GetSourceID(const FAzSpeechSubscriptionOptions& SubscriptionOptions);
+
+	mutable FCriticalSection Mutex;
+	TMap<FString, FAzSpeechVoiceCatalogEntry> Entries;
+
+	// Serialize the file reads and writes, which run without holding the main mutex
+	FCriticalSection LoadMutex;
+	FCriticalSection SaveMutex;
+
+	// Locales with requests in progress and the callbacks waiting for them
+	TMap<FString, TArray<TFunction<void(const FVoiceListPtr&)>>> PendingRequests;
+
+	FString CacheFileName;
+	FTimespan TimeToLive;
+
+	// Region or endpoint used to get the voices: The catalog is discarded if the default subscription changes
+	FString SourceID;
+
+	bool bLoaded = false;
+	bool bDirty = false;
+};
@@ -0,0 +1,41 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Containers/Queue.h>
+#include <HAL/ThreadSafeCounter64.h>
+#include <atomic>
+
+/**
+ *
+ */
+class FAzSpeechEventQueue
+{
+public:
+	FAzSpeechEventQueue() = default;
+	~FAzSpeechEventQueue();
+
+	/* Can be called from any thread: Returns false if the queue is no longer accepting events */
+	const bool Enqueue(TUniqueFunction<void()>&& Event);
+
+	/* Executes the queued events in the order they were added until the queue is empty or the budget is exceeded: Game thread only */
+	const int32 DispatchPendingEvents(const double TimeBudgetSeconds = 0.0);
+
+	/* Stops accepting new events and executes the pending ones, ignoring the budget: Events drained outside the game thread are sent to it */
+	void Shutdown();
+	const bool IsShuttingDown() const;
+
+	const int32 Num() const;
+	const int64 GetNumDispatchedEvents() const;
+
+private:
+	TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> PendingEvents;
+	std::atomic<int32> NumPendingEvents = 0;
+	std::atomic<int32> NumActiveProducers = 0;
+	std::atomic<bool> bIsShuttingDown = false;
+
+	FThreadSafeCounter64 NumDispatchedEvents;
+};
@@ -6,7 +6,10 @@
 
 #include <CoreMinimal.h>
 #include <HAL/Runnable.h>
+#include "AzSpeech/Runnables/Bases/AzSpeechRunnablePool.h"
+#include "AzSpeech/Runnables/Bases/AzSpeechRunnableStopSignal.h"
 #include "AzSpeech/Structures/AzSpeechSettingsOptions.h"
+#include <atomic>
 
 THIRD_PARTY_INCLUDES_START
 #include <speechapi_cxx_embedded_speech_config.h>
@@ -17,12 +20,15 @@ THIRD_PARTY_INCLUDES_START
 THIRD_PARTY_INCLUDES_END
 
 class UAzSpeechTaskBase;
+class FAzSpeechEventQueue;
 
 /**
  *
  */
 class FAzSpeechRunnableBase : public FRunnable
 {
+	friend class FAzSpeechRunnablePool;
+
 public:
 	FAzSpeechRunnableBase() = delete;
 	FAzSpeechRunnableBase(UAzSpeechTaskBase* const InOwningTask,
@@ -49,6 +55,13 @@ protected:
 	virtual bool InitializeAzureObject();
 	virtual bool CanInitializeTask() const;
 
+	/* Blocks dedicated threads until the work is pending stop: Waits on the stop signal, or polls it if Use Stop Event is disabled. Pooled runnables return immediately to release the worker */
+	const uint32 WaitForPendingStop() const;
+	const bool IsRunningInPool() const;
+
+	/* Sends the event to the game thread: Uses the subsystem event queue when available to dispatch the events in batches once per frame */
+	void DispatchToGameThread(TUniqueFunction<void()>&& Event) const;
+
 	std::shared_ptr<Microsoft::CognitiveServices::Speech::Audio::AudioConfig> GetAudioConfig() const;
 	std::shared_ptr<Microsoft::CognitiveServices::Speech::SpeechConfig> CreateSpeechConfig() const;
 
@@ -72,8 +85,29 @@ private:
 	FName ThreadName;
 	void StoreThreadInformation();
 
-	bool bStopTask = false;
+	enum class EPooledRunnableState : uint8
+	{
+		None,
+		Starting,
+		Active,
+		Exiting,
+		Finished
+	};
+
+	const bool ExecutePooledWork(const EAzSpeechRunnableWorkType WorkType);
+
+	/* Finishes a pooled work that will never be started: The owning task is released instead of waiting for a result */
+	void AbortPooledWork();
+
+	FAzSpeechRunnableStopSignal StopSignal;
+
+	// Signaled by the runnable pool when no worker is executing this runnable anymore
+	FEvent* PoolReleaseEvent;
+	std::atomic<EPooledRunnableState> PooledState = EPooledRunnableState::None;
+
 	TUniquePtr<FRunnableThread> Thread;
+	TSharedPtr<FAzSpeechRunnablePool, ESPMode::ThreadSafe> RunnablePool;
+	TSharedPtr<FAzSpeechEventQueue, ESPMode::ThreadSafe> EventQueue;
 	TWeakObjectPtr<UAzSpeechTaskBase> OwningTask;
 	std::shared_ptr<Microsoft::CognitiveServices::Speech::Audio::AudioConfig> AudioConfig;
 
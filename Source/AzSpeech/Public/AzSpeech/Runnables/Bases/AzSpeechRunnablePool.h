@@ -0,0 +1,71 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <HAL/Runnable.h>
+#include <HAL/ThreadSafeCounter.h>
+#include <HAL/ThreadSafeCounter64.h>
+#include "AzSpeech/Structures/AzSpeechThreadPoolStats.h"
+#include <atomic>
+
+class FAzSpeechRunnableBase;
+
+enum class EAzSpeechRunnableWorkType : uint8
+{
+	Start,
+	Exit
+};
+
+/**
+ *
+ */
+class FAzSpeechRunnablePool
+{
+	friend class FAzSpeechRunnablePoolWorker;
+
+public:
+	FAzSpeechRunnablePool() = delete;
+	FAzSpeechRunnablePool(const int32 InNumWorkers, const EThreadPriority InThreadPriority);
+
+	~FAzSpeechRunnablePool();
+
+	const bool EnqueueWork(FAzSpeechRunnableBase* const Runnable, const EAzSpeechRunnableWorkType WorkType);
+	void CancelPendingWork(FAzSpeechRunnableBase* const Runnable);
+
+	void Shutdown();
+	const bool IsShuttingDown() const;
+
+	const FAzSpeechThreadPoolStats GetStats() const;
+
+private:
+	using FAzSpeechRunnableWork = TPair<FAzSpeechRunnableBase*, EAzSpeechRunnableWorkType>;
+
+	const bool DequeueWork(FAzSpeechRunnableWork& OutWork);
+	void ExecuteWork(const FAzSpeechRunnableWork& Work);
+	void ReleaseRunnable_Internal(FAzSpeechRunnableBase* const Runnable);
+
+	const int32 GetNumPendingWork_Internal() const;
+	void CompactPendingWork_Internal();
+
+	mutable FCriticalSection Mutex;
+
+	// FIFO queue: Dequeued works are skipped by the head index and only removed from the array in batches
+	TArray<FAzSpeechRunnableWork> PendingWork;
+	int32 PendingWorkHead = 0;
+
+	TArray<FAzSpeechRunnableBase*> ExecutingRunnables;
+	TSet<FAzSpeechRunnableBase*> ActiveRunnables;
+
+	TArray<TUniquePtr<FRunnable>> Workers;
+	TArray<TUniquePtr<FRunnableThread>> Threads;
+	FEvent* WorkEvent;
+
+	std::atomic<bool> bIsShuttingDown = false;
+
+	FThreadSafeCounter NumBusyWorkers;
+	FThreadSafeCounter PeakQueueDepth;
+	FThreadSafeCounter64 NumCompletedWorks;
+};
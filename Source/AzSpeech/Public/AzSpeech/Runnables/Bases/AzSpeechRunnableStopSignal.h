@@ -0,0 +1,37 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <atomic>
+
+/**
+ * Stop request of a runnable: Dedicated threads block on it until the work reaches its final result
+ */
+class AZSPEECH_API FAzSpeechRunnableStopSignal
+{
+public:
+	FAzSpeechRunnableStopSignal();
+	~FAzSpeechRunnableStopSignal();
+
+	FAzSpeechRunnableStopSignal(const FAzSpeechRunnableStopSignal&) = delete;
+	FAzSpeechRunnableStopSignal& operator=(const FAzSpeechRunnableStopSignal&) = delete;
+
+	/* Sets the stop request and wakes the waiting thread: Returns true only for the first request */
+	const bool Request();
+
+	const bool IsRequested() const;
+
+	/* Time in seconds of the first request: FPlatformTime::Seconds */
+	const double GetRequestTime() const;
+
+	/* Blocks until the stop is requested: Waits on an event, or sleeps between checks if a poll interval in seconds is set (legacy behavior) */
+	void Wait(const float PollInterval = 0.f) const;
+
+private:
+	std::atomic<bool> bRequested = false;
+	std::atomic<double> RequestTime = 0.0;
+	FEvent* Event;
+};
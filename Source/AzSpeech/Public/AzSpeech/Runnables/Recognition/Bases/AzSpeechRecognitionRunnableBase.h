@@ -33,7 +33,6 @@ protected:
 	class UAzSpeechRecognizerTaskBase* GetOwningRecognizerTask() const;
 
 	const std::vector<std::string> GetCandidateLanguages() const;
-	const TArray<FString> GetPhraseListFromGroup(const FName& InGroup) const;
 	const Microsoft::CognitiveServices::Speech::OutputFormat GetOutputFormat() const;
 
 	virtual const bool ApplySDKSettings(const std::shared_ptr<Microsoft::CognitiveServices::Speech::SpeechConfig>& InConfig) const override;
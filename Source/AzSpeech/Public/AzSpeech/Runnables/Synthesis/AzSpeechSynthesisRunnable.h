@@ -6,6 +6,8 @@
 
 #include <CoreMinimal.h>
 #include "AzSpeech/Runnables/Bases/AzSpeechRunnableBase.h"
+#include "AzSpeech/Runnables/Synthesis/AzSpeechSynthesizerPool.h"
+#include "AzSpeech/AzSpeechVisemeTrack.h"
 
 THIRD_PARTY_INCLUDES_START
 #include <speechapi_cxx_speech_synthesizer.h>
@@ -44,4 +46,24 @@ private:
 protected:
 	bool bFilterVisemeData = false;
 	std::shared_ptr<Microsoft::CognitiveServices::Speech::SpeechSynthesizer> SpeechSynthesizer;
+
+	TSharedPtr<FAzSpeechSynthesizerPool, ESPMode::ThreadSafe> SynthesizerPool;
+	std::atomic<bool> bCanReleaseSynthesizer = false;
+	bool bUsingPooledSynthesizer = false;
+
+	// Set when the connection was already opened by the runnable: e.g. warm up tasks
+	bool bSynthesizerConnected = false;
+
+private:
+	FAzSpeechSynthesizerPoolKey SynthesizerPoolKey;
+
+	/* Visemes received since the last dispatch: Shared with the dispatched event, which can outlive the runnable */
+	struct FAzSpeechPendingVisemes
+	{
+		FCriticalSection Mutex;
+		FAzSpeechVisemeTrack Visemes;
+		bool bDispatchPending = false;
+	};
+
+	TSharedRef<FAzSpeechPendingVisemes, ESPMode::ThreadSafe> PendingVisemes = MakeShared<FAzSpeechPendingVisemes, ESPMode::ThreadSafe>();
 };
@@ -0,0 +1,83 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeech/Structures/AzSpeechSettingsOptions.h"
+
+THIRD_PARTY_INCLUDES_START
+#include <speechapi_cxx_speech_synthesizer.h>
+#include <speechapi_cxx_connection.h>
+THIRD_PARTY_INCLUDES_END
+
+/**
+ *
+ */
+struct FAzSpeechSynthesizerPoolKey
+{
+	FAzSpeechSynthesizerPoolKey() = default;
+	FAzSpeechSynthesizerPoolKey(const FAzSpeechSubscriptionOptions& InSubscriptionOptions, const FAzSpeechSynthesisOptions& InSynthesisOptions,
+	                            const bool bInIsSSMLBased);
+
+	bool operator==(const FAzSpeechSynthesizerPoolKey& Other) const;
+	friend uint32 GetTypeHash(const FAzSpeechSynthesizerPoolKey& Key);
+
+	FName SubscriptionKey = NAME_None;
+	FName RegionID = NAME_None;
+	FName PrivateEndpoint = NAME_None;
+	bool bUsePrivateEndpoint = false;
+
+	FName Locale = NAME_None;
+	FName Voice = NAME_None;
+	EAzSpeechSynthesisOutputFormat OutputFormat = EAzSpeechSynthesisOutputFormat::Riff16Khz16BitMonoPcm;
+	EAzSpeechProfanityFilter ProfanityFilter = EAzSpeechProfanityFilter::Raw;
+	bool bUseLanguageIdentification = false;
+	EAzSpeechLanguageIdentificationMode LanguageIdentificationMode = EAzSpeechLanguageIdentificationMode::AtStart;
+	bool bIsSSMLBased = false;
+};
+
+/**
+ *
+ */
+class FAzSpeechSynthesizerPool
+{
+public:
+	FAzSpeechSynthesizerPool() = delete;
+	FAzSpeechSynthesizerPool(const int32 InMaxPooledSynthesizers, const float InIdleTimeout, const bool bInPreConnect);
+
+	~FAzSpeechSynthesizerPool();
+
+	/* Returns a warm synthesizer matching the key or nullptr if there's no synthesizer available */
+	std::shared_ptr<Microsoft::CognitiveServices::Speech::SpeechSynthesizer> Acquire(const FAzSpeechSynthesizerPoolKey& Key);
+
+	/* Gives the synthesizer back to the pool: It must be idle and without connected signals. New synthesizers are pre-connected once if enabled */
+	void Release(const FAzSpeechSynthesizerPoolKey& Key, const std::shared_ptr<Microsoft::CognitiveServices::Speech::SpeechSynthesizer>& Synthesizer,
+	             const bool bIsNewSynthesizer = false);
+
+	void EvictIdleSynthesizers();
+	void Empty();
+
+	const int32 Num() const;
+
+private:
+	struct FAzSpeechPooledSynthesizer
+	{
+		std::shared_ptr<Microsoft::CognitiveServices::Speech::SpeechSynthesizer> Synthesizer;
+		std::shared_ptr<Microsoft::CognitiveServices::Speech::Connection> Connection;
+		double LastUsedTime = 0.0;
+	};
+
+	void EvictIdleSynthesizers_Internal(const double CurrentTime);
+	void EvictOldestSynthesizer_Internal();
+	void CloseConnection(const FAzSpeechPooledSynthesizer& Item) const;
+
+	mutable FCriticalSection Mutex;
+	TMap<FAzSpeechSynthesizerPoolKey, TArray<FAzSpeechPooledSynthesizer>> PooledSynthesizers;
+	int32 NumPooledSynthesizers = 0;
+
+	int32 MaxPooledSynthesizers;
+	float IdleTimeout;
+	bool bPreConnect;
+};
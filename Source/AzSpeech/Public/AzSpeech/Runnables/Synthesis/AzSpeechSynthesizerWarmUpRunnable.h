@@ -0,0 +1,28 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeech/Runnables/Synthesis/AzSpeechSynthesisRunnable.h"
+
+/**
+ *
+ */
+class FAzSpeechSynthesizerWarmUpRunnable : public FAzSpeechSynthesisRunnable
+{
+public:
+	FAzSpeechSynthesizerWarmUpRunnable() = delete;
+	FAzSpeechSynthesizerWarmUpRunnable(UAzSpeechTaskBase* const InOwningTask,
+	                                   std::shared_ptr<Microsoft::CognitiveServices::Speech::Audio::AudioConfig>&& InAudioConfig);
+
+protected:
+	// FRunnable interface
+	virtual uint32 Run() override;
+	// End of FRunnable interface
+
+private:
+	const bool OpenSynthesizerConnection() const;
+	class UWarmUpSynthesizerAsync* GetOwningWarmUpTask() const;
+};
@@ -0,0 +1,32 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeechAudioBufferStats.generated.h"
+
+USTRUCT(BlueprintType, Category = "AzSpeech")
+struct AZSPEECH_API FAzSpeechAudioBufferStats
+{
+	GENERATED_BODY()
+
+	FAzSpeechAudioBufferStats() = default;
+
+	/* Number of audio buffers received from the SDK and shared without copies */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int64 NumSharedBuffers = 0;
+
+	/* Total of bytes received from the SDK and shared without copies */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int64 SharedBytes = 0;
+
+	/* Number of times the audio data was copied: Blueprint arrays, chunk concatenation and sound wave data */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int64 NumCopies = 0;
+
+	/* Total of bytes copied */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int64 CopiedBytes = 0;
+};
@@ -72,3 +72,23 @@ struct AZSPEECH_API FAzSpeechRecognitionMap
 		return GroupName == Rhs.GroupName || Data == Rhs.Data;
 	}
 };
+
+USTRUCT(BlueprintType, Category = "AzSpeech")
+struct AZSPEECH_API FAzSpeechRecognitionMatch
+{
+	GENERATED_BODY()
+
+	FAzSpeechRecognitionMatch() = default;
+
+	/* The name of the checked recognition data group */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	FName GroupName = NAME_None;
+
+	/* Value of the recognition data that best matches the string or -1 if there's no match */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int32 Value = -1;
+
+	/* Sum of the weights of the trigger keys found in the string */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int32 MatchPoints = 0;
+};
@@ -49,6 +49,15 @@ enum class EAzSpeechLanguageIdentificationMode : uint8
 	Continuous
 };
 
+UENUM(BlueprintType, Category = "AzSpeech")
+enum class EAzSpeechAudioInputMode : uint8
+{
+	/* The Azure SDK opens the microphone and sends all the captured audio */
+	SDKMicrophone,
+	/* The engine audio capture opens the microphone and feeds a push stream: Allows voice activity detection */
+	EngineAudioCapture
+};
+
 USTRUCT(BlueprintType, Category = "AzSpeech")
 struct AZSPEECH_API FAzSpeechSubscriptionOptions
 {
@@ -117,6 +126,27 @@ struct AZSPEECH_API FAzSpeechRecognitionOptions
 		Meta = (DisplayName = "Initial Silence Timeout in Miliseconds", ClampMin = "0", UIMin = "0"))
 	int32 InitialSilenceTimeoutMs;
 
+	/* Device used by microphone recognition tasks to capture the audio */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tasks", Meta = (DisplayName = "Audio Input Mode"))
+	EAzSpeechAudioInputMode AudioInputMode;
+
+	/* If enabled, only the audio with voice activity is sent to Azure: Reduces the bandwidth and the billed audio of open microphone sessions */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tasks",
+		Meta = (DisplayName = "Enable Voice Activity Detection", EditCondition = "AudioInputMode == EAzSpeechAudioInputMode::EngineAudioCapture"))
+	bool bEnableVoiceActivityDetection;
+
+	/* Minimum energy in dBFS to consider the captured audio as voice */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tasks",
+		Meta = (DisplayName = "Voice Activity Threshold in dBFS", EditCondition = "bEnableVoiceActivityDetection", ClampMin = "-90", UIMin = "-90",
+			ClampMax = "0", UIMax = "0"))
+	float VoiceActivityThresholdDb;
+
+	/* Time in miliseconds that the audio keeps being sent after the voice stops: Never shorter than the segmentation silence timeout, so the phrases can be completed */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tasks",
+		Meta = (DisplayName = "Voice Activity Hangover in Miliseconds", EditCondition = "bEnableVoiceActivityDetection", ClampMin = "0", UIMin = "0",
+			ClampMax = "5000", UIMax = "5000"))
+	int32 VoiceActivityHangoverMs;
+
 	/* Path to the keyword recognition model to use in Keyword Recognition tasks */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tasks", Meta = (DisplayName = "Keyword Recognition Model Path"))
 	FString KeywordRecognitionModelPath;
@@ -161,6 +191,10 @@ struct AZSPEECH_API FAzSpeechSynthesisOptions
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tasks", Meta = (DisplayName = "Profanity Filter"))
 	EAzSpeechProfanityFilter ProfanityFilter;
 
+	/* If enabled, speech tasks will start playing the audio as soon as the first chunk is received instead of waiting for the complete synthesis */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tasks", Meta = (DisplayName = "Enable Streaming Playback"))
+	bool bEnableStreamingPlayback;
+
 private:
 	void SetDefaults();
 };
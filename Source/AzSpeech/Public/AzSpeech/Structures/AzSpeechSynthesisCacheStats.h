@@ -0,0 +1,44 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeechSynthesisCacheStats.generated.h"
+
+USTRUCT(BlueprintType, Category = "AzSpeech")
+struct AZSPEECH_API FAzSpeechSynthesisCacheStats
+{
+	GENERATED_BODY()
+
+	FAzSpeechSynthesisCacheStats() = default;
+
+	/* Number of synthesis results stored in the cache */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int32 NumEntries = 0;
+
+	/* Memory used by the cached audio and viseme data */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int64 UsedBytes = 0;
+
+	/* Maximum memory that the cache can use before evicting the least recently used results */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int64 BudgetBytes = 0;
+
+	/* Number of tasks completed with a cached result */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int64 NumHits = 0;
+
+	/* Number of tasks that had to synthesize their result */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int64 NumMisses = 0;
+
+	/* Number of results removed to keep the cache in the memory budget */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int64 NumEvictions = 0;
+
+	/* Hits / (Hits + Misses): 0 to 1 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	float HitRate = 0.f;
+};
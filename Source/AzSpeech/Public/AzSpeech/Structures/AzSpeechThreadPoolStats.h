@@ -0,0 +1,44 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeechThreadPoolStats.generated.h"
+
+USTRUCT(BlueprintType, Category = "AzSpeech")
+struct AZSPEECH_API FAzSpeechThreadPoolStats
+{
+	GENERATED_BODY()
+
+	FAzSpeechThreadPoolStats() = default;
+
+	/* Number of worker threads owned by the pool */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int32 NumWorkers = 0;
+
+	/* Number of workers currently executing a runnable work */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int32 NumBusyWorkers = 0;
+
+	/* Number of runnable works waiting for a free worker */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int32 QueueDepth = 0;
+
+	/* Highest queue depth registered since the pool was created */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int32 PeakQueueDepth = 0;
+
+	/* Number of runnables started in the pool and not finished yet */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int32 NumActiveRunnables = 0;
+
+	/* Total of works executed by the pool workers */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	int64 NumCompletedWorks = 0;
+
+	/* Busy workers / Total workers: 0 to 1 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	float WorkerUtilization = 0.f;
+};
@@ -0,0 +1,64 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeechVoiceInfo.generated.h"
+
+UENUM(BlueprintType, Category = "AzSpeech")
+enum class EAzSpeechVoiceGender : uint8
+{
+	Unknown,
+	Female,
+	Male
+};
+
+UENUM(BlueprintType, Category = "AzSpeech")
+enum class EAzSpeechVoiceType : uint8
+{
+	Unknown,
+	OnlineNeural,
+	OnlineStandard,
+	OfflineNeural,
+	OfflineStandard
+};
+
+USTRUCT(BlueprintType, Category = "AzSpeech")
+struct AZSPEECH_API FAzSpeechVoiceInfo
+{
+	GENERATED_BODY()
+
+	FAzSpeechVoiceInfo() = default;
+
+	/* Full voice name: e.g. Microsoft Server Speech Text to Speech Voice (en-US, JennyNeural) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	FString Name;
+
+	/* Name used by the synthesis options: e.g. en-US-JennyNeural */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	FString ShortName;
+
+	/* Voice name in the language of the voice */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	FString LocalName;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	FString Locale;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	EAzSpeechVoiceGender Gender = EAzSpeechVoiceGender::Unknown;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	EAzSpeechVoiceType VoiceType = EAzSpeechVoiceType::Unknown;
+
+	/* Speaking styles supported by the voice: Used by the mstts:express-as SSML element */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AzSpeech")
+	TArray<FString> StyleList;
+
+	friend FArchive& operator<<(FArchive& Ar, FAzSpeechVoiceInfo& Voice)
+	{
+		return Ar << Voice.Name << Voice.ShortName << Voice.LocalName << Voice.Locale << Voice.Gender << Voice.VoiceType << Voice.StyleList;
+	}
+};
@@ -9,6 +9,7 @@
 #include <Kismet/BlueprintFunctionLibrary.h>
 #include "AzSpeech/Structures/AzSpeechSettingsOptions.h"
 #include "LogAzSpeech.h"
+#include <atomic>
 
 THIRD_PARTY_INCLUDES_START
 #include <speechapi_cxx_audio_config.h>
@@ -18,6 +19,16 @@ THIRD_PARTY_INCLUDES_END
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FAzSpeechTaskGenericDelegate);
 
+/* Transitions: Inactive -> Active -> Finished -> Destroying -> ReadyToDestroy. Any state can move to Destroying only once */
+enum class EAzSpeechTaskState : uint8
+{
+	Inactive,
+	Active,
+	Finished,
+	Destroying,
+	ReadyToDestroy
+};
+
 /**
  *
  */
@@ -60,9 +71,13 @@ protected:
 
 	mutable FCriticalSection Mutex;
 
+	/* Atomically moves the task from the expected state to the new state: Only one thread can win each transition */
+	const bool TrySetTaskState(EAzSpeechTaskState ExpectedState, const EAzSpeechTaskState NewState);
+	const EAzSpeechTaskState GetTaskState() const;
+
 #if WITH_EDITOR
 	bool bIsEditorTask = false;
-	bool bEndingPIE = false;
+	std::atomic<bool> bEndingPIE = false;
 
 	virtual void PrePIEEnded(bool bIsSimulating);
 #endif
@@ -103,8 +118,8 @@ protected:
 	using FAzSpeechTaskGenericDelegate_Internal = TDelegate<void(struct FAzSpeechTaskData)>;
 
 private:
-	bool bIsTaskActive = false;
-	bool bIsReadyToDestroy = false;
+	// Read by SDK callback threads without locking: Only the transitions are serialized
+	std::atomic<EAzSpeechTaskState> TaskState = EAzSpeechTaskState::Inactive;
 
 	FAzSpeechTaskGenericDelegate_Internal InternalOnTaskFinished;
 };
@@ -0,0 +1,51 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeech/Tasks/Recognition/Bases/AzSpeechRecognizerTaskBase.h"
+#include "AzSpeech/AzSpeechAudioBuffer.h"
+#include "AudioDataToTextAsync.generated.h"
+
+/**
+ * Recognizes audio data held in memory: A wav file content or raw 16 kHz 16 bits mono PCM samples
+ * The data is read by the SDK directly from the buffer, without writing it to a file
+ */
+UCLASS(NotPlaceable, Category = "AzSpeech")
+class AZSPEECH_API UAudioDataToTextAsync : public UAzSpeechRecognizerTaskBase
+{
+	GENERATED_BODY()
+
+public:
+	/* Creates a AudioData-To-Text task that will convert your wav or raw PCM (16 kHz, 16 bits, mono) data to string */
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Default",
+		meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Audio Data To Text with Default Options",
+			AutoCreateRefTerm = "PhraseListGroup"))
+	static UAudioDataToTextAsync* AudioDataToText_DefaultOptions(UObject* const WorldContextObject, const TArray<uint8>& AudioData,
+	                                                             const FString& Locale = "Default", const FName& PhraseListGroup = NAME_None);
+
+	/* Creates a AudioData-To-Text task that will convert your wav or raw PCM (16 kHz, 16 bits, mono) data to string */
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Custom",
+		meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Audio Data To Text with Custom Options",
+			AutoCreateRefTerm = "PhraseListGroup"))
+	static UAudioDataToTextAsync* AudioDataToText_CustomOptions(UObject* const WorldContextObject,
+	                                                            const FAzSpeechSubscriptionOptions& SubscriptionOptions,
+	                                                            const FAzSpeechRecognitionOptions& RecognitionOptions, const TArray<uint8>& AudioData,
+	                                                            const FName& PhraseListGroup = NAME_None);
+
+	/* Creates the task sharing the buffer: Use it with the audio of synthesis tasks or with FAzSpeechAudioBuffer::FromArray to avoid copying the data */
+	static UAudioDataToTextAsync* AudioBufferToText(UObject* const WorldContextObject, const FAzSpeechSubscriptionOptions& SubscriptionOptions,
+	                                                const FAzSpeechRecognitionOptions& RecognitionOptions, const FAzSpeechAudioBuffer& AudioData,
+	                                                const FName& PhraseListGroup = NAME_None);
+
+protected:
+	virtual bool StartAzureTaskWork() override;
+
+private:
+	FAzSpeechAudioBuffer AudioData;
+
+	/* Creates a pull stream that reads the samples of the buffer: Returns nullptr if the data isn't valid */
+	std::shared_ptr<Microsoft::CognitiveServices::Speech::Audio::AudioConfig> CreateAudioDataConfig() const;
+};
@@ -6,6 +6,7 @@
 
 #include <CoreMinimal.h>
 #include "AzSpeech/Tasks/Bases/AzSpeechTaskBase.h"
+#include "AzSpeech/Structures/AzSpeechAudioInputDeviceInfo.h"
 
 THIRD_PARTY_INCLUDES_START
 #include <speechapi_cxx_recognition_base_async_recognizer.h>
@@ -18,6 +19,17 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRecognitionUpdatedDelegate, const F
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRecognitionCompletedDelegate, const FString, FinalString);
 
+/**
+ *
+ */
+struct FAzSpeechRecognitionResultSnapshot
+{
+	FString RecognizedString;
+
+	int64 RecognitionDuration = 0;
+	int32 RecognitionLatency = 0;
+};
+
 /**
  *
  */
@@ -61,18 +73,26 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AzSpeech")
 	const int32 GetRecognitionLatency() const;
 
+	/* Get an immutable snapshot of the current result: It's safe to read it from any thread without locking the task */
+	const std::shared_ptr<const FAzSpeechRecognitionResultSnapshot> GetRecognitionResult() const;
+
+	virtual void SetReadyToDestroy() override;
+
 protected:
 	FName PhraseListGroup = NAME_None;
 	FAzSpeechRecognitionOptions RecognitionOptions;
 
 	virtual void StartRecognitionWork(std::shared_ptr<Microsoft::CognitiveServices::Speech::Audio::AudioConfig>&& InAudioConfig);
 
+	/* Creates the audio config of microphone tasks: Uses the engine audio capture if enabled in the recognition options */
+	std::shared_ptr<Microsoft::CognitiveServices::Speech::Audio::AudioConfig> CreateMicrophoneAudioConfig(
+		const FAzSpeechAudioInputDeviceInfo& DeviceInfo, const bool bUseDefaultDevice);
+
 	virtual void BroadcastFinalResult() override;
 	virtual void OnRecognitionUpdated(const std::shared_ptr<Microsoft::CognitiveServices::Speech::SpeechRecognitionResult>& LastResult);
 
 private:
-	std::string RecognizedText;
+	TSharedPtr<class FAzSpeechMicrophoneCapture, ESPMode::ThreadSafe> MicrophoneCapture;
 
-	int64 RecognitionDuration = 0;
-	int32 RecognitionLatency = 0;
+	std::shared_ptr<const FAzSpeechRecognitionResultSnapshot> RecognitionResult = std::make_shared<const FAzSpeechRecognitionResultSnapshot>();
 };
@@ -18,6 +18,8 @@ class AZSPEECH_API UAzSpeechAudioDataSynthesisBase : public UAzSpeechSynthesizer
 
 protected:
 	virtual bool StartAzureTaskWork() override;
+	virtual const bool CanUseSynthesizerPool() const override;
+	virtual const bool CanUseSynthesisCache() const override;
 
 	TWeakObjectPtr<UObject> WorldContextObject;
 };
@@ -6,9 +6,11 @@
 
 #include <CoreMinimal.h>
 #include "AzSpeech/Tasks/Synthesis/Bases/AzSpeechAudioDataSynthesisBase.h"
+#include <atomic>
 #include "AzSpeechSpeechSynthesisBase.generated.h"
 
 class UAudioComponent;
+class USoundWaveProcedural;
 
 /**
  *
@@ -28,16 +30,35 @@ public:
 	virtual void StopAzSpeechTask() override;
 	virtual void SetReadyToDestroy() override;
 
+	/* Thread safe: Playback time of the synthesized audio in milliseconds or a negative value if the audio isn't playing */
+	const float GetPlaybackTimeMilliseconds() const;
+
 protected:
 	virtual void BroadcastFinalResult() override;
+	virtual void OnSynthesisAudioChunk(const FAzSpeechAudioBuffer& ChunkData) override;
 
 	UFUNCTION()
 	void OnAudioPlayStateChanged(const EAudioComponentPlayState PlayState);
 
+	void OnAudioPlaybackPercent(const UAudioComponent* InAudioComponent, const USoundWave* InSoundWave, const float Percent);
+
 private:
 	bool bAutoPlayAudio = true;
 	FAzSpeechTaskGenericDelegate_Internal InternalAudioFinished;
 	TWeakObjectPtr<class UAudioComponent> AudioComponent;
 
+	bool bStreamingPlaybackStarted = false;
+	TWeakObjectPtr<USoundWaveProcedural> StreamingSoundWave;
+	std::atomic<bool> bStreamingInputFinished = false;
+	std::atomic<bool> bStreamingStopRequested = false;
+
+	/* Platform time when the audio started playing: Read by animation worker threads */
+	std::atomic<double> PlaybackStartTime = -1.0;
+
 	void PlayAudio();
+	const bool PlaySound(class USoundWave* const SoundWave);
+	void UnbindPlaybackPercent();
+
+	void StartStreamingPlayback();
+	void OnStreamingAudioUnderflow(USoundWaveProcedural* InProceduralWave, const int32 SamplesRequired);
 };
@@ -8,6 +8,9 @@
 #include "AzSpeech/Tasks/Bases/AzSpeechTaskBase.h"
 #include "AzSpeech/Structures/AzSpeechVisemeData.h"
 #include "AzSpeech/Structures/AzSpeechAnimationData.h"
+#include "AzSpeech/AzSpeechAudioBuffer.h"
+#include "AzSpeech/AzSpeechVisemeTrack.h"
+#include "AzSpeech/AzSpeechSegmentList.h"
 
 THIRD_PARTY_INCLUDES_START
 #include <speechapi_cxx_speech_synthesis_result.h>
@@ -19,12 +22,41 @@ class USoundWave;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FVisemeReceived, const FAzSpeechVisemeData, VisemeData);
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FVisemeBatchReceived, const TArray<FAzSpeechVisemeData>&, VisemeBatch);
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAudioDataSynthesisDelegate, const TArray<uint8>&, FinalAudioData);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSoundWaveSynthesisDelegate, USoundWave*, GeneratedSound);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FBooleanSynthesisDelegate, const bool, bSuccess);
 
+/**
+ *
+ */
+struct AZSPEECH_API FAzSpeechSynthesisResultSnapshot
+{
+	FAzSpeechAudioBuffer AudioData;
+
+	/* Audio chunks and viseme batches received so far: Shared with the previous snapshots, so publishing a new one never copies them */
+	TAzSpeechSegmentList<FAzSpeechAudioBuffer> AudioChunks;
+	TAzSpeechSegmentList<FAzSpeechVisemeTrack> VisemeBatches;
+
+	bool bLastResultIsValid = false;
+
+	int64 AudioDuration = 0;
+
+	int32 ConnectionLatency = 0;
+	int32 FinishLatency = 0;
+	int32 FirstByteLatency = 0;
+	int32 NetworkLatency = 0;
+	int32 ServiceLatency = 0;
+
+	int32 TimeToFirstAudio = 0;
+
+	/* Merges the viseme batches into a single track: Each call copies the visemes received so far */
+	const FAzSpeechVisemeTrack GetVisemeTrack() const;
+};
+
 /**
  *
  */
@@ -52,6 +84,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "AzSpeech")
 	FVisemeReceived VisemeReceived;
 
+	/* Task delegate that will be called once for each batch of viseme data received in the same frame */
+	UPROPERTY(BlueprintAssignable, Category = "AzSpeech")
+	FVisemeBatchReceived VisemeBatchReceived;
+
 	/* Get the last viseme data received by this task */
 	UFUNCTION(BlueprintPure, Category = "AzSpeech")
 	const FAzSpeechVisemeData GetLastVisemeData() const;
@@ -59,9 +95,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AzSpeech")
 	const TArray<FAzSpeechVisemeData> GetVisemeDataArray() const;
 
+	/* Get a copy of the audio data: While the synthesis is running, it contains the audio chunks received so far */
 	UFUNCTION(BlueprintPure, Category = "AzSpeech")
 	const TArray<uint8> GetAudioData() const;
 
+	/* Get the audio data without copying it: Prefer it over GetAudioData in C++. While the synthesis is running, each call copies the chunks received so far */
+	const FAzSpeechAudioBuffer GetAudioBuffer() const;
+
 	/* Get the extracted animation data from the last viseme data received by this task */
 	UFUNCTION(BlueprintPure, Category = "AzSpeech")
 	const FAzSpeechAnimationData GetLastExtractedAnimationData() const;
@@ -103,25 +143,44 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AzSpeech")
 	const int32 GetServiceLatency() const;
 
+	/* Get the time in milliseconds between the start of the synthesis and the first audio chunk received in the game thread */
+	UFUNCTION(BlueprintPure, Category = "AzSpeech")
+	const int32 GetTimeToFirstAudio() const;
+
+	/* Get an immutable snapshot of the current result: It's safe to read it from any thread without locking the task */
+	const std::shared_ptr<const FAzSpeechSynthesisResultSnapshot> GetSynthesisResult() const;
+
 protected:
 	FString SynthesisText;
 	FAzSpeechSynthesisOptions SynthesisOptions;
 
+	virtual void BroadcastFinalResult() override;
+
 	void StartSynthesisWork(std::shared_ptr<Microsoft::CognitiveServices::Speech::Audio::AudioConfig>&& InAudioConfig);
 
-	virtual void OnVisemeReceived(const FAzSpeechVisemeData& VisemeData);
+	/* Tasks that only consume the result audio data can share synthesizers without an audio output */
+	virtual const bool CanUseSynthesizerPool() const;
+
+	/* Tasks that only consume the result audio data can be completed with a result synthesized by a previous task */
+	virtual const bool CanUseSynthesisCache() const;
+	const bool IsCompletedFromCache() const;
+
+	virtual void OnVisemeBatchReceived(const FAzSpeechVisemeTrack& VisemeBatch);
 	virtual void OnSynthesisUpdate(const std::shared_ptr<Microsoft::CognitiveServices::Speech::SpeechSynthesisResult>& LastResult);
 
+	/* Called in the game thread for each audio chunk received while the synthesis is running: The chunk contains only PCM data */
+	virtual void OnSynthesisAudioChunk(const FAzSpeechAudioBuffer& ChunkData);
+
 private:
-	std::vector<uint8_t> AudioData;
-	TArray<FAzSpeechVisemeData> VisemeDataArray;
-	bool bLastResultIsValid = false;
+	const bool CompleteFromSynthesisCache();
+	void AddResultToSynthesisCache() const;
 
-	int64 AudioDuration = 0;
+	/* Copies the current snapshot, applies the changes and publishes it with a single pointer swap: Game thread only. The copy shares the segments */
+	void UpdateSynthesisResult(const TFunctionRef<void(FAzSpeechSynthesisResultSnapshot&)> Updater);
 
-	int32 ConnectionLatency = 0;
-	int32 FinishLatency = 0;
-	int32 FirstByteLatency = 0;
-	int32 NetworkLatency = 0;
-	int32 ServiceLatency = 0;
+	std::shared_ptr<const FAzSpeechSynthesisResultSnapshot> SynthesisResult = std::make_shared<const FAzSpeechSynthesisResultSnapshot>();
+
+	double SynthesisStartTime = 0.0;
+
+	bool bCompletedFromCache = false;
 };
@@ -27,6 +27,7 @@ public:
 protected:
 	virtual bool StartAzureTaskWork() override;
 	virtual void BroadcastFinalResult() override;
+	virtual const bool CanUseSynthesisCache() const override;
 
 	FString FilePath;
 	FString FileName;
@@ -0,0 +1,54 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "AzSpeech/Tasks/Synthesis/Bases/AzSpeechSynthesizerTaskBase.h"
+#include "WarmUpSynthesizerAsync.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAzSpeechWarmUpDelegate, const float, WarmUpTimeMilliseconds);
+
+/**
+ *
+ */
+UCLASS(NotPlaceable, Category = "AzSpeech")
+class AZSPEECH_API UWarmUpSynthesizerAsync : public UAzSpeechSynthesizerTaskBase
+{
+	GENERATED_BODY()
+
+	friend class FAzSpeechSynthesizerWarmUpRunnable;
+
+public:
+	/* Task delegate that will be called when the synthesizer is connected and ready to be used by the next matching task */
+	UPROPERTY(BlueprintAssignable, Category = "AzSpeech")
+	FAzSpeechWarmUpDelegate WarmUpCompleted;
+
+	/* Creates a task that will open a synthesizer connection ahead of time: The next synthesis task with the same options will reuse it */
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Default",
+		meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Warm Up Synthesizer with Default Options"))
+	static UWarmUpSynthesizerAsync* WarmUpSynthesizer_DefaultOptions(UObject* const WorldContextObject, const FString& Voice = "Default",
+	                                                                 const FString& Locale = "Default");
+
+	/* Creates a task that will open a synthesizer connection ahead of time: The next synthesis task with the same options will reuse it */
+	UFUNCTION(BlueprintCallable, Category = "AzSpeech | Custom",
+		meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Warm Up Synthesizer with Custom Options"))
+	static UWarmUpSynthesizerAsync* WarmUpSynthesizer_CustomOptions(UObject* const WorldContextObject,
+	                                                                const FAzSpeechSubscriptionOptions& SubscriptionOptions,
+	                                                                const FAzSpeechSynthesisOptions& SynthesisOptions, const bool bWarmUpSSMLTasks = false);
+
+	/* Get the time in milliseconds spent creating the synthesizer and opening its connection */
+	UFUNCTION(BlueprintPure, Category = "AzSpeech")
+	const float GetWarmUpTime() const;
+
+protected:
+	virtual bool StartAzureTaskWork() override;
+	virtual void BroadcastFinalResult() override;
+	virtual const bool CanUseSynthesizerPool() const override;
+
+private:
+	// Written by the warm up runnable thread
+	std::atomic<float> WarmUpTime = 0.f;
+	std::atomic<bool> bWarmUpSucceeded = false;
+};
@@ -8,8 +8,6 @@
 #include <Kismet/BlueprintAsyncActionBase.h>
 #include "RecognitionMapCheckAsync.generated.h"
 
-struct FAzSpeechRecognitionMap;
-
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FAzSpeechMapCheckDelegate_Generic);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAzSpeechMapCheckDelegate_WithValue, const int32, RecognitionResult);
@@ -49,10 +47,4 @@ protected:
 private:
 	void BroadcastResult(const int32 Result);
 	const int32 CheckRecognitionResult() const;
-	const bool CheckStringContains(const FString& KeyType, const FString& Key) const;
-
-	const FName GetStringDelimiters() const;
-	const bool CheckStringDelimiters(const int32 Index) const;
-
-	const FAzSpeechRecognitionMap GetRecognitionMap(const FName& InGroup) const;
 };
@@ -6,6 +6,8 @@
 
 #include <CoreMinimal.h>
 #include <Runtime/Launch/Resources/Version.h>
+#include <GenericPlatform/GenericPlatformAffinity.h>
+#include "AzSpeech/Structures/AzSpeechSettingsOptions.h"
 #include <string>
 
 struct FAzSpeechRecognitionMap;
@@ -47,8 +49,60 @@ namespace AzSpeech::Internal
 		return HasEmptyParam(Arg1) || HasEmptyParam(std::forward<Args>(args)...);
 	}
 
+	constexpr const EThreadPriority GetCPUThreadPriority(const EAzSpeechThreadPriority Priority)
+	{
+		switch (Priority)
+		{
+		case EAzSpeechThreadPriority::Lowest:
+			return TPri_Lowest;
+
+		case EAzSpeechThreadPriority::BelowNormal:
+			return TPri_BelowNormal;
+
+		case EAzSpeechThreadPriority::Normal:
+			return TPri_Normal;
+
+		case EAzSpeechThreadPriority::AboveNormal:
+			return TPri_AboveNormal;
+
+		case EAzSpeechThreadPriority::Highest:
+			return TPri_Highest;
+
+		default:
+			break;
+		}
+
+		return TPri_Normal;
+	}
+
+	constexpr const int32 GetSampleRate(const EAzSpeechSynthesisOutputFormat Format)
+	{
+		switch (Format)
+		{
+		case EAzSpeechSynthesisOutputFormat::Riff16Khz16BitMonoPcm:
+			return 16000;
+
+		case EAzSpeechSynthesisOutputFormat::Riff24Khz16BitMonoPcm:
+			return 24000;
+
+		case EAzSpeechSynthesisOutputFormat::Riff48Khz16BitMonoPcm:
+			return 48000;
+
+		case EAzSpeechSynthesisOutputFormat::Riff22050Hz16BitMonoPcm:
+			return 22050;
+
+		case EAzSpeechSynthesisOutputFormat::Riff44100Hz16BitMonoPcm:
+			return 44100;
+
+		default:
+			break;
+		}
+
+		return 16000;
+	}
+
 	template <typename ReturnTy, typename IteratorTy>
-	constexpr const ReturnTy GetDataFromMapGroup(const FName& InGroup, const TArray<IteratorTy> InContainer)
+	constexpr const ReturnTy GetDataFromMapGroup(const FName& InGroup, const TArray<IteratorTy>& InContainer)
 	{
 		if (HasEmptyParam(InGroup))
 		{
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <Logging/LogMacros.h>
+#include <Stats/Stats.h>
 
 /**
  *
@@ -14,3 +15,6 @@ DECLARE_LOG_CATEGORY_EXTERN(LogAzSpeech, Display, All);
 DECLARE_LOG_CATEGORY_EXTERN(LogAzSpeech_Internal, NoLogging, All);
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAzSpeech_Debugging, NoLogging, All);
+
+/* Cycle counters available with the console command 'stat AzSpeech' */
+DECLARE_STATS_GROUP(TEXT("AzSpeech"), STATGROUP_AzSpeech, STATCAT_Advanced);
@@ -0,0 +1,171 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AnimNode_AzSpeechLipSync.h"
+#include "AzSpeechBlendShapeRetargetAsset.h"
+#include "AzSpeechBlendShapeRetargetMatrix.h"
+#include <AzSpeech/Tasks/Synthesis/Bases/AzSpeechSpeechSynthesisBase.h>
+#include <Animation/AnimInstanceProxy.h>
+#include <Animation/Skeleton.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AnimNode_AzSpeechLipSync)
+#endif
+
+DECLARE_CYCLE_STAT(TEXT("AzSpeech Lip Sync Update"), STAT_AzSpeech_LipSyncUpdate, STATGROUP_Anim);
+
+FAnimNode_AzSpeechLipSync::FAnimNode_AzSpeechLipSync() : CurveNames(GetAzureBlendShapeNames())
+{
+}
+
+const TArray<FName>& FAnimNode_AzSpeechLipSync::GetAzureBlendShapeNames()
+{
+	static const TArray<FName> BlendShapeNames = {
+		TEXT("eyeBlinkLeft"), TEXT("eyeLookDownLeft"), TEXT("eyeLookInLeft"), TEXT("eyeLookOutLeft"), TEXT("eyeLookUpLeft"), TEXT("eyeSquintLeft"),
+		TEXT("eyeWideLeft"), TEXT("eyeBlinkRight"), TEXT("eyeLookDownRight"), TEXT("eyeLookInRight"), TEXT("eyeLookOutRight"), TEXT("eyeLookUpRight"),
+		TEXT("eyeSquintRight"), TEXT("eyeWideRight"), TEXT("jawForward"), TEXT("jawLeft"), TEXT("jawRight"), TEXT("jawOpen"), TEXT("mouthClose"),
+		TEXT("mouthFunnel"), TEXT("mouthPucker"), TEXT("mouthLeft"), TEXT("mouthRight"), TEXT("mouthSmileLeft"), TEXT("mouthSmileRight"),
+		TEXT("mouthFrownLeft"), TEXT("mouthFrownRight"), TEXT("mouthDimpleLeft"), TEXT("mouthDimpleRight"), TEXT("mouthStretchLeft"),
+		TEXT("mouthStretchRight"), TEXT("mouthRollLower"), TEXT("mouthRollUpper"), TEXT("mouthShrugLower"), TEXT("mouthShrugUpper"),
+		TEXT("mouthPressLeft"), TEXT("mouthPressRight"), TEXT("mouthLowerDownLeft"), TEXT("mouthLowerDownRight"), TEXT("mouthUpperUpLeft"),
+		TEXT("mouthUpperUpRight"), TEXT("browDownLeft"), TEXT("browDownRight"), TEXT("browInnerUp"), TEXT("browOuterUpLeft"), TEXT("browOuterUpRight"),
+		TEXT("cheekPuff"), TEXT("cheekSquintLeft"), TEXT("cheekSquintRight"), TEXT("noseSneerLeft"), TEXT("noseSneerRight"), TEXT("tongueOut"),
+		TEXT("headRoll"), TEXT("leftEyeRoll"), TEXT("rightEyeRoll")
+	};
+
+	return BlendShapeNames;
+}
+
+void FAnimNode_AzSpeechLipSync::Initialize_AnyThread(const FAnimationInitializeContext& Context)
+{
+	FAnimNode_Base::Initialize_AnyThread(Context);
+	Source.Initialize(Context);
+
+	Timeline.Empty();
+	TimelineTask = nullptr;
+	bHasSampledWeights = false;
+
+	RetargetMatrix = RetargetAsset ? RetargetAsset->GetRetargetMatrix() : nullptr;
+}
+
+void FAnimNode_AzSpeechLipSync::CacheBones_AnyThread(const FAnimationCacheBonesContext& Context)
+{
+	Source.CacheBones(Context);
+
+#if !AZSPEECH_NAMED_ANIM_CURVES
+	const TArray<FName>& OutputCurveNames = GetOutputCurveNames();
+	CurveUIDs.Reset(OutputCurveNames.Num());
+
+	const USkeleton* const Skeleton = Context.AnimInstanceProxy->GetSkeleton();
+	for (const FName& CurveName : OutputCurveNames)
+	{
+		CurveUIDs.Add(Skeleton && !CurveName.IsNone() ? Skeleton->GetUIDByName(USkeleton::AnimCurveMappingName, CurveName) : SmartName::MaxUID);
+	}
+#endif
+}
+
+void FAnimNode_AzSpeechLipSync::Update_AnyThread(const FAnimationUpdateContext& Context)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_LipSyncUpdate);
+
+	GetEvaluateGraphExposedInputs().Execute(Context);
+	Source.Update(Context);
+
+	bHasSampledWeights = false;
+
+	if (!IsValid(SynthesisTask))
+	{
+		TimelineTask = nullptr;
+		return;
+	}
+
+	// A new task was assigned: The frames of the previous one are no longer valid
+	if (TimelineTask != SynthesisTask)
+	{
+		Timeline.Empty();
+		TimelineTask = SynthesisTask;
+	}
+
+	SampledTime = PlaybackTimeMilliseconds;
+	if (SampledTime < 0.f)
+	{
+		const UAzSpeechSpeechSynthesisBase* const SpeechTask = Cast<UAzSpeechSpeechSynthesisBase>(SynthesisTask);
+		SampledTime = SpeechTask ? SpeechTask->GetPlaybackTimeMilliseconds() : -1.f;
+	}
+
+	if (SampledTime < 0.f)
+	{
+		return;
+	}
+
+	// Lock-free: The snapshot stays alive while the new frames are appended, even if the task publishes a new result meanwhile
+	if (const std::shared_ptr<const FAzSpeechSynthesisResultSnapshot> SynthesisResult = SynthesisTask->GetSynthesisResult())
+	{
+		Timeline.Update(SynthesisResult->VisemeBatches);
+	}
+
+	SampledTime += TimeOffsetMilliseconds;
+	bHasSampledWeights = Timeline.Sample(SampledTime, SampledWeights);
+
+	if (bHasSampledWeights && RetargetMatrix)
+	{
+		RetargetedWeights.SetNumUninitialized(RetargetMatrix->GetNumTargets(), false);
+		RetargetMatrix->ApplyFrame(SampledWeights, RetargetedWeights);
+	}
+}
+
+void FAnimNode_AzSpeechLipSync::Evaluate_AnyThread(FPoseContext& Output)
+{
+	Source.Evaluate(Output);
+
+	if (!bHasSampledWeights || Alpha <= 0.f)
+	{
+		return;
+	}
+
+	const TArray<float>& OutputWeights = RetargetMatrix ? RetargetedWeights : SampledWeights;
+
+#if AZSPEECH_NAMED_ANIM_CURVES
+	const TArray<FName>& OutputCurveNames = GetOutputCurveNames();
+	const int32 NumCurves = FMath::Min(OutputCurveNames.Num(), OutputWeights.Num());
+#else
+	const int32 NumCurves = FMath::Min(CurveUIDs.Num(), OutputWeights.Num());
+#endif
+
+	for (int32 Index = 0; Index < NumCurves; ++Index)
+	{
+#if AZSPEECH_NAMED_ANIM_CURVES
+		const FName& CurveName = OutputCurveNames[Index];
+		if (CurveName.IsNone())
+		{
+			continue;
+		}
+
+		Output.Curve.Set(CurveName, FMath::Lerp(Output.Curve.Get(CurveName), OutputWeights[Index], Alpha));
+#else
+		const SmartName::UID_Type CurveUID = CurveUIDs[Index];
+		if (CurveUID == SmartName::MaxUID)
+		{
+			continue;
+		}
+
+		Output.Curve.Set(CurveUID, FMath::Lerp(Output.Curve.Get(CurveUID), OutputWeights[Index], Alpha));
+#endif
+	}
+}
+
+const TArray<FName>& FAnimNode_AzSpeechLipSync::GetOutputCurveNames() const
+{
+	return RetargetMatrix ? RetargetMatrix->GetTargetCurves() : CurveNames;
+}
+
+void FAnimNode_AzSpeechLipSync::GatherDebugData(FNodeDebugData& DebugData)
+{
+	FString DebugLine = DebugData.GetNodeName(this);
+	DebugLine += FString::Printf(TEXT("(Time: %.1f ms, Frames: %d, Sampled: %s)"), SampledTime, Timeline.GetNumFrames(),
+	                             bHasSampledWeights ? TEXT("true") : TEXT("false"));
+
+	DebugData.AddDebugItem(DebugLine);
+	Source.GatherDebugData(DebugData);
+}
@@ -0,0 +1,7 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include <Modules/ModuleManager.h>
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, AzSpeechAnimation)
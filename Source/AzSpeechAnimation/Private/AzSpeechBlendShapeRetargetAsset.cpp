@@ -0,0 +1,135 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeechBlendShapeRetargetAsset.h"
+#include "AzSpeechBlendShapeRetargetMatrix.h"
+#include "AnimNode_AzSpeechLipSync.h"
+#include "LogAzSpeechAnimation.h"
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechBlendShapeRetargetAsset)
+#endif
+
+const std::shared_ptr<const FAzSpeechBlendShapeRetargetMatrix> UAzSpeechBlendShapeRetargetAsset::GetRetargetMatrix() const
+{
+	return std::atomic_load_explicit(&RetargetMatrix, std::memory_order_acquire);
+}
+
+void UAzSpeechBlendShapeRetargetAsset::CompileMappings()
+{
+	const TArray<FName>& SourceNames = FAnimNode_AzSpeechLipSync::GetAzureBlendShapeNames();
+	const std::shared_ptr<FAzSpeechBlendShapeRetargetMatrix> NewMatrix = std::make_shared<FAzSpeechBlendShapeRetargetMatrix>(
+		SourceNames.Num(), bClampOutput);
+
+	// Mappings with the same target curve are merged into a single row
+	TMap<FName, TMap<int32, float>> Rows;
+	TArray<FName> TargetOrder;
+
+	for (const FAzSpeechBlendShapeCurveMapping& Mapping : CurveMappings)
+	{
+		if (Mapping.TargetCurve.IsNone())
+		{
+			continue;
+		}
+
+		TMap<int32, float>* Row = Rows.Find(Mapping.TargetCurve);
+		if (!Row)
+		{
+			Row = &Rows.Add(Mapping.TargetCurve);
+			TargetOrder.Add(Mapping.TargetCurve);
+		}
+
+		for (const FAzSpeechBlendShapeInfluence& Influence : Mapping.Influences)
+		{
+			const int32 SourceIndex = SourceNames.IndexOfByKey(Influence.SourceBlendShape);
+			if (SourceIndex == INDEX_NONE)
+			{
+				UE_LOG(LogAzSpeechAnimation, Warning, TEXT("%s: %s: Unknown source blend shape '%s' mapped to '%s'"), *FString(__FUNCTION__), *GetName(),
+				       *Influence.SourceBlendShape.ToString(), *Mapping.TargetCurve.ToString());
+				continue;
+			}
+
+			Row->FindOrAdd(SourceIndex) += Influence.Weight;
+		}
+	}
+
+	TArray<TPair<int32, float>> Influences;
+	for (const FName& TargetCurve : TargetOrder)
+	{
+		Influences = Rows.FindChecked(TargetCurve).Array();
+
+		// Sorted sources keep the reads of each frame in increasing address order
+		Influences.Sort([](const TPair<int32, float>& Lhs, const TPair<int32, float>& Rhs)
+		{
+			return Lhs.Key < Rhs.Key;
+		});
+
+		NewMatrix->AddTarget(TargetCurve, Influences);
+	}
+
+	UE_LOG(LogAzSpeechAnimation, Verbose, TEXT("%s: %s: Compiled %d target curves with %d influences"), *FString(__FUNCTION__), *GetName(),
+	       NewMatrix->GetNumTargets(), NewMatrix->GetNumInfluences());
+
+	std::atomic_store_explicit(&RetargetMatrix, std::shared_ptr<const FAzSpeechBlendShapeRetargetMatrix>(NewMatrix), std::memory_order_release);
+}
+
+TArray<FName> UAzSpeechBlendShapeRetargetAsset::GetTargetCurveNames() const
+{
+	const std::shared_ptr<const FAzSpeechBlendShapeRetargetMatrix> Matrix = GetRetargetMatrix();
+	return Matrix ? Matrix->GetTargetCurves() : TArray<FName>();
+}
+
+TArray<float> UAzSpeechBlendShapeRetargetAsset::RetargetBlendShapes(const TArray<float>& BlendShapes) const
+{
+	TArray<float> Output;
+
+	if (const std::shared_ptr<const FAzSpeechBlendShapeRetargetMatrix> Matrix = GetRetargetMatrix())
+	{
+		Output.SetNumZeroed(Matrix->GetNumTargets());
+		Matrix->ApplyFrame(BlendShapes, Output);
+	}
+
+	return Output;
+}
+
+#if WITH_EDITOR
+void UAzSpeechBlendShapeRetargetAsset::ResetToARKitMapping()
+{
+	Modify();
+
+	CurveMappings.Empty();
+
+	for (const FName& BlendShapeName : FAnimNode_AzSpeechLipSync::GetAzureBlendShapeNames())
+	{
+		FAzSpeechBlendShapeCurveMapping& NewMapping = CurveMappings.AddDefaulted_GetRef();
+		NewMapping.TargetCurve = BlendShapeName;
+		NewMapping.Influences.AddDefaulted_GetRef().SourceBlendShape = BlendShapeName;
+	}
+
+	CompileMappings();
+}
+#endif
+
+void UAzSpeechBlendShapeRetargetAsset::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	CompileMappings();
+}
+
+void UAzSpeechBlendShapeRetargetAsset::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileMappings();
+}
+
+#if WITH_EDITOR
+void UAzSpeechBlendShapeRetargetAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	CompileMappings();
+}
+#endif
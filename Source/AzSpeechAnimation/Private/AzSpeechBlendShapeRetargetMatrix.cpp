@@ -0,0 +1,150 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeechBlendShapeRetargetMatrix.h"
+#include <AzSpeech/AzSpeechBlendShapeTimeline.h>
+
+DECLARE_CYCLE_STAT(TEXT("AzSpeech Retarget Blend Shapes"), STAT_AzSpeech_RetargetBlendShapes, STATGROUP_Anim);
+
+FAzSpeechBlendShapeRetargetMatrix::FAzSpeechBlendShapeRetargetMatrix(const int32 InNumSources, const bool bInClampOutput)
+	: NumSources(FMath::Max(0, InNumSources)), bClampOutput(bInClampOutput)
+{
+}
+
+void FAzSpeechBlendShapeRetargetMatrix::AddTarget(const FName& TargetCurve, const TArrayView<const TPair<int32, float>> Influences)
+{
+	TargetCurves.Add(TargetCurve);
+
+	for (const TPair<int32, float>& Influence : Influences)
+	{
+		if (Influence.Key < 0 || Influence.Key >= NumSources || Influence.Value == 0.f)
+		{
+			continue;
+		}
+
+		SourceIndices.Add(Influence.Key);
+		InfluenceWeights.Add(Influence.Value);
+	}
+
+	RowOffsets.Add(SourceIndices.Num());
+}
+
+void FAzSpeechBlendShapeRetargetMatrix::ApplyFrame(const TArrayView<const float> Sources, const TArrayView<float> OutTargets) const
+{
+	const int32 NumTargets = FMath::Min(GetNumTargets(), OutTargets.Num());
+
+	for (int32 Target = 0; Target < NumTargets; ++Target)
+	{
+		float Value = 0.f;
+		for (int32 Influence = RowOffsets[Target]; Influence < RowOffsets[Target + 1]; ++Influence)
+		{
+			if (Sources.IsValidIndex(SourceIndices[Influence]))
+			{
+				Value += Sources[SourceIndices[Influence]] * InfluenceWeights[Influence];
+			}
+		}
+
+		OutTargets[Target] = bClampOutput ? FMath::Clamp(Value, 0.f, 1.f) : Value;
+	}
+}
+
+void FAzSpeechBlendShapeRetargetMatrix::Apply(const TArrayView<const float> SourceFrames, const int32 NumFrames, TArray<float>& OutTargetFrames) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_AzSpeech_RetargetBlendShapes);
+
+	const int32 NumTargets = GetNumTargets();
+	const int32 NumValidFrames = NumSources > 0 ? FMath::Min(NumFrames, SourceFrames.Num() / NumSources) : 0;
+
+	OutTargetFrames.SetNumZeroed(NumValidFrames * NumTargets, false);
+
+	if (NumValidFrames <= 0 || NumTargets <= 0)
+	{
+		return;
+	}
+
+	// Curve major buffers: Each influence becomes a multiply-add of two contiguous rows of frames, 4 frames at a time
+	const int32 Stride = Align(NumValidFrames, 4);
+
+	TArray<float> SourceCurves;
+	SourceCurves.SetNumZeroed(NumSources * Stride);
+
+	for (int32 Frame = 0; Frame < NumValidFrames; ++Frame)
+	{
+		const float* const SourceFrame = SourceFrames.GetData() + Frame * NumSources;
+		for (int32 Source = 0; Source < NumSources; ++Source)
+		{
+			SourceCurves[Source * Stride + Frame] = SourceFrame[Source];
+		}
+	}
+
+	TArray<float> TargetCurveValues;
+	TargetCurveValues.SetNumZeroed(NumTargets * Stride);
+
+	const VectorRegister Zero = VectorZero();
+	const VectorRegister One = VectorOne();
+
+	for (int32 Target = 0; Target < NumTargets; ++Target)
+	{
+		float* const TargetRow = TargetCurveValues.GetData() + Target * Stride;
+
+		for (int32 Influence = RowOffsets[Target]; Influence < RowOffsets[Target + 1]; ++Influence)
+		{
+			const float* const SourceRow = SourceCurves.GetData() + SourceIndices[Influence] * Stride;
+			const VectorRegister Weight = VectorSetFloat1(InfluenceWeights[Influence]);
+
+			for (int32 Frame = 0; Frame < Stride; Frame += 4)
+			{
+				VectorStore(VectorMultiplyAdd(VectorLoad(SourceRow + Frame), Weight, VectorLoad(TargetRow + Frame)), TargetRow + Frame);
+			}
+		}
+
+		if (bClampOutput)
+		{
+			for (int32 Frame = 0; Frame < Stride; Frame += 4)
+			{
+				VectorStore(VectorMin(VectorMax(VectorLoad(TargetRow + Frame), Zero), One), TargetRow + Frame);
+			}
+		}
+	}
+
+	for (int32 Frame = 0; Frame < NumValidFrames; ++Frame)
+	{
+		float* const TargetFrame = OutTargetFrames.GetData() + Frame * NumTargets;
+		for (int32 Target = 0; Target < NumTargets; ++Target)
+		{
+			TargetFrame[Target] = TargetCurveValues[Target * Stride + Frame];
+		}
+	}
+}
+
+void FAzSpeechBlendShapeRetargetMatrix::Apply(const FAzSpeechBlendShapeTimeline& Timeline, TArray<float>& OutTargetFrames) const
+{
+	if (Timeline.GetNumBlendShapes() != NumSources)
+	{
+		OutTargetFrames.Reset();
+		return;
+	}
+
+	Apply(Timeline.GetWeights(), Timeline.GetNumFrames(), OutTargetFrames);
+}
+
+const int32 FAzSpeechBlendShapeRetargetMatrix::GetNumSources() const
+{
+	return NumSources;
+}
+
+const int32 FAzSpeechBlendShapeRetargetMatrix::GetNumTargets() const
+{
+	return TargetCurves.Num();
+}
+
+const int32 FAzSpeechBlendShapeRetargetMatrix::GetNumInfluences() const
+{
+	return SourceIndices.Num();
+}
+
+const TArray<FName>& FAzSpeechBlendShapeRetargetMatrix::GetTargetCurves() const
+{
+	return TargetCurves;
+}
@@ -0,0 +1,83 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Runtime/Launch/Resources/Version.h>
+#include <Animation/AnimNodeBase.h>
+#include <AzSpeech/AzSpeechBlendShapeTimeline.h>
+#include <memory>
+#include "AnimNode_AzSpeechLipSync.generated.h"
+
+/* Since 5.3, the anim curves are identified by name instead of skeleton UIDs */
+#define AZSPEECH_NAMED_ANIM_CURVES (ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3))
+
+class UAzSpeechSynthesizerTaskBase;
+class UAzSpeechBlendShapeRetargetAsset;
+class FAzSpeechBlendShapeRetargetMatrix;
+
+/**
+ *
+ */
+USTRUCT(BlueprintInternalUseOnly)
+struct AZSPEECHANIMATION_API FAnimNode_AzSpeechLipSync : public FAnimNode_Base
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Links")
+	FPoseLink Source;
+
+	/* Synthesis task providing the facial expression animation: The synthesis options must have viseme and facial expression enabled */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", meta = (PinShownByDefault))
+	UAzSpeechSynthesizerTaskBase* SynthesisTask = nullptr;
+
+	/* Audio time in milliseconds to sample. Negative values use the playback time of the audio played by the task */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", meta = (PinHiddenByDefault))
+	float PlaybackTimeMilliseconds = -1.f;
+
+	/* Added to the playback time to compensate the audio output latency */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", meta = (PinHiddenByDefault))
+	float TimeOffsetMilliseconds = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", meta = (PinShownByDefault, ClampMin = "0", ClampMax = "1"))
+	float Alpha = 1.f;
+
+	/* Curve driven by each blend shape sent by Azure, in the same order. Empty names skip the blend shape. Ignored if a retarget asset is set */
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	TArray<FName> CurveNames;
+
+	/* Maps the blend shapes sent by Azure to the curves of the target rig */
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	UAzSpeechBlendShapeRetargetAsset* RetargetAsset = nullptr;
+
+	FAnimNode_AzSpeechLipSync();
+
+	/* Names of the 55 blend shapes sent by Azure, in the order of the facial expression animation */
+	static const TArray<FName>& GetAzureBlendShapeNames();
+
+	// FAnimNode_Base interface
+	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
+	virtual void CacheBones_AnyThread(const FAnimationCacheBonesContext& Context) override;
+	virtual void Update_AnyThread(const FAnimationUpdateContext& Context) override;
+	virtual void Evaluate_AnyThread(FPoseContext& Output) override;
+	virtual void GatherDebugData(FNodeDebugData& DebugData) override;
+	// End of FAnimNode_Base interface
+
+private:
+	const TArray<FName>& GetOutputCurveNames() const;
+
+	FAzSpeechBlendShapeTimeline Timeline;
+	const UAzSpeechSynthesizerTaskBase* TimelineTask = nullptr;
+
+	TArray<float> SampledWeights;
+	TArray<float> RetargetedWeights;
+	std::shared_ptr<const FAzSpeechBlendShapeRetargetMatrix> RetargetMatrix;
+	float SampledTime = -1.f;
+	bool bHasSampledWeights = false;
+
+#if !AZSPEECH_NAMED_ANIM_CURVES
+	TArray<SmartName::UID_Type> CurveUIDs;
+#endif
+};
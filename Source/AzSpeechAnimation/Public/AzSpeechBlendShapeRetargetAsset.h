@@ -0,0 +1,92 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Engine/DataAsset.h>
+#include <memory>
+#include "AzSpeechBlendShapeRetargetAsset.generated.h"
+
+class FAzSpeechBlendShapeRetargetMatrix;
+
+/**
+ *
+ */
+USTRUCT(BlueprintType, Category = "AzSpeech")
+struct AZSPEECHANIMATION_API FAzSpeechBlendShapeInfluence
+{
+	GENERATED_BODY()
+
+	/* Name of the blend shape sent by Azure, e.g. jawOpen */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AzSpeech")
+	FName SourceBlendShape = NAME_None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AzSpeech")
+	float Weight = 1.f;
+};
+
+/**
+ *
+ */
+USTRUCT(BlueprintType, Category = "AzSpeech")
+struct AZSPEECHANIMATION_API FAzSpeechBlendShapeCurveMapping
+{
+	GENERATED_BODY()
+
+	/* Name of the curve driven in the target rig */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AzSpeech")
+	FName TargetCurve = NAME_None;
+
+	/* The curve value is the weighted sum of these blend shapes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AzSpeech")
+	TArray<FAzSpeechBlendShapeInfluence> Influences;
+};
+
+/**
+ *
+ */
+UCLASS(BlueprintType, Category = "AzSpeech")
+class AZSPEECHANIMATION_API UAzSpeechBlendShapeRetargetAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Retarget")
+	TArray<FAzSpeechBlendShapeCurveMapping> CurveMappings;
+
+	/* Clamp the retargeted values to [0, 1] */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Retarget")
+	bool bClampOutput = true;
+
+	/* Thread safe: Compiled mapping, rebuilt when the asset is loaded or edited */
+	const std::shared_ptr<const FAzSpeechBlendShapeRetargetMatrix> GetRetargetMatrix() const;
+
+	/* Rebuilds the sparse matrix from the curve mappings */
+	void CompileMappings();
+
+	UFUNCTION(BlueprintPure, Category = "AzSpeech | Animation")
+	TArray<FName> GetTargetCurveNames() const;
+
+	/* Retargets the 55 blend shape values of a frame sent by Azure to the target curves, in the order of GetTargetCurveNames */
+	UFUNCTION(BlueprintPure, Category = "AzSpeech | Animation")
+	TArray<float> RetargetBlendShapes(const TArray<float>& BlendShapes) const;
+
+#if WITH_EDITOR
+	/* Replaces the mappings by a 1:1 mapping to the ARKit curve names used by Live Link Face and MetaHuman ARKit poses */
+	UFUNCTION(CallInEditor, Category = "Retarget")
+	void ResetToARKitMapping();
+#endif
+
+protected:
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	std::shared_ptr<const FAzSpeechBlendShapeRetargetMatrix> RetargetMatrix;
+};
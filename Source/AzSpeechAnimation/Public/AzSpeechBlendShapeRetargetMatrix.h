@@ -0,0 +1,45 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+class FAzSpeechBlendShapeTimeline;
+
+/**
+ *
+ */
+class AZSPEECHANIMATION_API FAzSpeechBlendShapeRetargetMatrix
+{
+public:
+	FAzSpeechBlendShapeRetargetMatrix() = default;
+	FAzSpeechBlendShapeRetargetMatrix(const int32 InNumSources, const bool bInClampOutput);
+
+	/* Adds a target curve computed as the weighted sum of the source blend shapes: Pairs of source index and weight */
+	void AddTarget(const FName& TargetCurve, const TArrayView<const TPair<int32, float>> Influences);
+
+	/* Retargets a single frame: OutTargets must have GetNumTargets values */
+	void ApplyFrame(const TArrayView<const float> Sources, const TArrayView<float> OutTargets) const;
+
+	/* Retargets NumFrames contiguous frames with a stride of GetNumSources, outputting contiguous frames with a stride of GetNumTargets */
+	void Apply(const TArrayView<const float> SourceFrames, const int32 NumFrames, TArray<float>& OutTargetFrames) const;
+	void Apply(const FAzSpeechBlendShapeTimeline& Timeline, TArray<float>& OutTargetFrames) const;
+
+	const int32 GetNumSources() const;
+	const int32 GetNumTargets() const;
+	const int32 GetNumInfluences() const;
+
+	const TArray<FName>& GetTargetCurves() const;
+
+private:
+	int32 NumSources = 0;
+	bool bClampOutput = true;
+
+	/* Compressed sparse rows: The influences of the target N are in [RowOffsets[N], RowOffsets[N + 1]) */
+	TArray<FName> TargetCurves;
+	TArray<int32> RowOffsets = {0};
+	TArray<int32> SourceIndices;
+	TArray<float> InfluenceWeights;
+};
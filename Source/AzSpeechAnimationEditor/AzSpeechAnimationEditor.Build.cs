@@ -0,0 +1,29 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+using UnrealBuildTool;
+
+public class AzSpeechAnimationEditor : ModuleRules
+{
+	public AzSpeechAnimationEditor(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+		CppStandard = CppStandardVersion.Cpp17;
+
+		PublicDependencyModuleNames.AddRange(new[]
+		{
+			"Core",
+			"AzSpeechAnimation"
+		});
+
+		PrivateDependencyModuleNames.AddRange(new[]
+		{
+			"Engine",
+			"CoreUObject",
+			"AnimGraph",
+			"BlueprintGraph",
+			"UnrealEd"
+		});
+	}
+}
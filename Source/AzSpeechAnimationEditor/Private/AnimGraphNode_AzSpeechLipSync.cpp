@@ -0,0 +1,28 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AnimGraphNode_AzSpeechLipSync.h"
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AnimGraphNode_AzSpeechLipSync)
+#endif
+
+#define LOCTEXT_NAMESPACE "AnimGraphNode_AzSpeechLipSync"
+
+FText UAnimGraphNode_AzSpeechLipSync::GetNodeTitle([[maybe_unused]] ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("NodeTitle", "AzSpeech Lip Sync");
+}
+
+FText UAnimGraphNode_AzSpeechLipSync::GetTooltipText() const
+{
+	return LOCTEXT("NodeTooltip", "Drives the facial curves with the facial expression animation of an AzSpeech synthesis task, synced to the audio playback");
+}
+
+FString UAnimGraphNode_AzSpeechLipSync::GetNodeCategory() const
+{
+	return TEXT("AzSpeech");
+}
+
+#undef LOCTEXT_NAMESPACE
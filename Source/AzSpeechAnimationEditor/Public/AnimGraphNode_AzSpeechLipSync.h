@@ -0,0 +1,32 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <AnimGraphNode_Base.h>
+#include <AnimNode_AzSpeechLipSync.h>
+#include "AnimGraphNode_AzSpeechLipSync.generated.h"
+
+/**
+ *
+ */
+UCLASS(MinimalAPI)
+class UAnimGraphNode_AzSpeechLipSync : public UAnimGraphNode_Base
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category = "Settings")
+	FAnimNode_AzSpeechLipSync Node;
+
+	// UEdGraphNode interface
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	// End of UEdGraphNode interface
+
+	// UAnimGraphNode_Base interface
+	virtual FString GetNodeCategory() const override;
+	// End of UAnimGraphNode_Base interface
+};
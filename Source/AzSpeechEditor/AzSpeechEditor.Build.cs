@@ -22,6 +22,7 @@ public class AzSpeechEditor : ModuleRules
 		{
 			"Engine",
 			"CoreUObject",
+			"Json",
 			"Slate",
 			"SlateCore",
 			"UnrealEd",
@@ -0,0 +1,345 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeechBatchSynthesisCommandlet.h"
+#include "Batch/AzSpeechBatchSynthesisRow.h"
+#include <AzSpeechInternalFuncs.h>
+#include <AzSpeech/AzSpeechSettings.h>
+#include <AzSpeech/AzSpeechHelper.h>
+#include <AzSpeech/AzSpeechEngineSubsystem.h>
+#include <AzSpeech/AzSpeechAudioBuffer.h>
+#include <AzSpeech/Cache/AzSpeechSynthesisCache.h>
+#include <AzSpeech/Tasks/Synthesis/TextToAudioDataAsync.h>
+#include <AzSpeech/Tasks/Synthesis/SSMLToAudioDataAsync.h>
+#include <Engine/DataTable.h>
+#include <Engine/Engine.h>
+#include <Misc/FileHelper.h>
+#include <Misc/PackageName.h>
+#include <Sound/SoundWave.h>
+#include <UObject/UObjectGlobals.h>
+#include <UObject/StrongObjectPtr.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechBatchSynthesisCommandlet)
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogAzSpeechBatchSynthesis, Display, All);
+
+namespace AzSpeechBatchSynthesis
+{
+	// Unique line to synthesize: Rows with the same content and options share the same audio data
+	struct FBatchLine
+	{
+		FString SynthesisText;
+		FString Voice;
+		FString Locale;
+		bool bIsSSMLBased = false;
+		TArray<FString> AssetNames;
+	};
+
+	// Saved Sound Waves are kept in memory until the next garbage collection
+	constexpr int32 GarbageCollectionInterval = 256;
+	constexpr double ReportInterval = 5.0;
+
+	// Default synthesis: An AzSpeech audio data task, kept alive until the line is processed
+	class FAzSpeechTaskAdapter final : public IAzSpeechBatchSynthesisTask
+	{
+	public:
+		explicit FAzSpeechTaskAdapter(UAzSpeechAudioDataSynthesisBase* const InTask) : Task(InTask)
+		{
+		}
+
+		virtual const bool IsFinished() const override
+		{
+			return !Task.IsValid() || UAzSpeechTaskStatus::IsTaskReadyToDestroy(Task.Get());
+		}
+
+		virtual const FAzSpeechAudioBuffer GetResult() const override
+		{
+			return Task.IsValid() && Task->IsLastResultValid() ? Task->GetAudioBuffer() : FAzSpeechAudioBuffer();
+		}
+
+	private:
+		TStrongObjectPtr<UAzSpeechAudioDataSynthesisBase> Task;
+	};
+}
+
+UAzSpeechBatchSynthesisCommandlet::UAzSpeechBatchSynthesisCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer), InputTable(nullptr)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAzSpeechBatchSynthesisCommandlet::Main(const FString& Params)
+{
+	if (!TaskFactory && !UAzSpeechSettings::CheckAzSpeechSettings())
+	{
+		return 1;
+	}
+
+	InputTable = LoadInputTable(Params);
+	if (!InputTable)
+	{
+		return 1;
+	}
+
+	if (!FParse::Value(*Params, TEXT("Module="), OutputModule))
+	{
+		OutputModule = TEXT("Game");
+	}
+
+	if (!FParse::Value(*Params, TEXT("Path="), OutputDirectory))
+	{
+		OutputDirectory = TEXT("AzSpeech");
+	}
+
+	if (!UAzSpeechHelper::IsContentModuleAvailable(OutputModule))
+	{
+		UE_LOG(LogAzSpeechBatchSynthesis, Error, TEXT("%s: Module '%s' is not available"), *FString(__FUNCTION__), *OutputModule);
+		return 1;
+	}
+
+	int32 MaxParallelTasks = UAzSpeechSettings::Get()->ThreadPoolSize;
+	FParse::Value(*Params, TEXT("Parallel="), MaxParallelTasks);
+	MaxParallelTasks = FMath::Clamp(MaxParallelTasks, 1, 64);
+
+	const bool bForce = FParse::Param(*Params, TEXT("Force"));
+	const bool bDryRun = FParse::Param(*Params, TEXT("DryRun"));
+
+	// Deduplicate the rows and skip the lines that were already baked by a previous run
+	TArray<AzSpeechBatchSynthesis::FBatchLine> Lines;
+	TMap<uint64, int32> LineIndices;
+	int32 NumRows = 0;
+	int32 NumSkippedRows = 0;
+
+	for (const TPair<FName, uint8*>& Iterator : InputTable->GetRowMap())
+	{
+		const FAzSpeechBatchSynthesisRow* const Row = reinterpret_cast<const FAzSpeechBatchSynthesisRow*>(Iterator.Value);
+		++NumRows;
+
+		if (AzSpeech::Internal::HasEmptyParam(Row->SynthesisText))
+		{
+			UE_LOG(LogAzSpeechBatchSynthesis, Warning, TEXT("%s: Row '%s' has no synthesis text"), *FString(__FUNCTION__), *Iterator.Key.ToString());
+			++NumSkippedRows;
+			continue;
+		}
+
+		const FString AssetName = AzSpeech::Internal::HasEmptyParam(Row->AssetName) ? Iterator.Key.ToString() : Row->AssetName;
+		if (!bForce && FPackageName::DoesPackageExist(GetPackageName(AssetName)))
+		{
+			++NumSkippedRows;
+			continue;
+		}
+
+		const FAzSpeechSynthesisOptions SynthesisOptions = Row->bIsSSMLBased
+			                                                   ? FAzSpeechSynthesisOptions()
+			                                                   : FAzSpeechSynthesisOptions(*Row->Locale, *Row->Voice);
+
+		const uint64 LineKey = FAzSpeechSynthesisCache::MakeKey(Row->SynthesisText, Row->bIsSSMLBased, SynthesisOptions);
+
+		if (const int32* const ExistingIndex = LineIndices.Find(LineKey))
+		{
+			Lines[*ExistingIndex].AssetNames.Add(AssetName);
+			continue;
+		}
+
+		AzSpeechBatchSynthesis::FBatchLine& NewLine = Lines.AddDefaulted_GetRef();
+		NewLine.SynthesisText = Row->SynthesisText;
+		NewLine.Voice = Row->Voice;
+		NewLine.Locale = Row->Locale;
+		NewLine.bIsSSMLBased = Row->bIsSSMLBased;
+		NewLine.AssetNames.Add(AssetName);
+
+		LineIndices.Add(LineKey, Lines.Num() - 1);
+	}
+
+	UE_LOG(LogAzSpeechBatchSynthesis, Display, TEXT("%s: Rows: %d; Skipped rows: %d; Unique lines to synthesize: %d; Parallel tasks: %d"),
+	       *FString(__FUNCTION__), NumRows, NumSkippedRows, Lines.Num(), MaxParallelTasks);
+
+	if (bDryRun || Lines.IsEmpty())
+	{
+		return 0;
+	}
+
+	TArray<int32> ActiveLineIndices;
+	int32 NextLineIndex = 0;
+
+	int32 NumSynthesizedLines = 0;
+	int32 NumFailedLines = 0;
+	int32 NumSavedAssets = 0;
+	int32 NumAssetsSinceCollection = 0;
+	int64 NumSynthesizedBytes = 0;
+
+	const double StartTime = FPlatformTime::Seconds();
+	double LastReportTime = StartTime;
+
+	const auto ReportThroughput = [&](const TCHAR* const Label)
+	{
+		const double ElapsedTime = FMath::Max(FPlatformTime::Seconds() - StartTime, 0.001);
+
+		UE_LOG(LogAzSpeechBatchSynthesis, Display,
+		       TEXT("%s: Lines: %d/%d; Failed: %d; Assets: %d; Elapsed: %.1fs; Throughput: %.2f lines/sec, %.1f KB/sec"), Label,
+		       NumSynthesizedLines + NumFailedLines, Lines.Num(), NumFailedLines, NumSavedAssets, ElapsedTime,
+		       static_cast<double>(NumSynthesizedLines) / ElapsedTime, static_cast<double>(NumSynthesizedBytes) / 1024.0 / ElapsedTime);
+	};
+
+	while (NextLineIndex < Lines.Num() || !ActiveTasks.IsEmpty())
+	{
+		while (ActiveTasks.Num() < MaxParallelTasks && NextLineIndex < Lines.Num())
+		{
+			const AzSpeechBatchSynthesis::FBatchLine& Line = Lines[NextLineIndex];
+			ActiveTasks.Add(StartSynthesisTask(Line.SynthesisText, Line.Voice, Line.Locale, Line.bIsSSMLBased));
+			ActiveLineIndices.Add(NextLineIndex);
+
+			++NextLineIndex;
+		}
+
+		// Tasks deliver their results to the game thread: There's no engine loop running in commandlets
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+
+		if (const UAzSpeechEngineSubsystem* const AzSpeechSubsystem = GEngine ? GEngine->GetEngineSubsystem<UAzSpeechEngineSubsystem>() : nullptr)
+		{
+			AzSpeechSubsystem->DispatchPendingEvents();
+		}
+
+		for (int32 Index = ActiveTasks.Num() - 1; Index >= 0; --Index)
+		{
+			const TSharedRef<IAzSpeechBatchSynthesisTask>& Task = ActiveTasks[Index];
+			if (!Task->IsFinished())
+			{
+				continue;
+			}
+
+			const AzSpeechBatchSynthesis::FBatchLine& Line = Lines[ActiveLineIndices[Index]];
+			const FAzSpeechAudioBuffer AudioBuffer = Task->GetResult();
+
+			if (!AudioBuffer.IsEmpty())
+			{
+				++NumSynthesizedLines;
+				NumSynthesizedBytes += AudioBuffer.Num();
+
+				for (const FString& AssetName : Line.AssetNames)
+				{
+					if (USoundWave* const SoundWave = UAzSpeechHelper::ConvertAudioBufferToSoundWave(AudioBuffer, OutputModule, OutputDirectory, AssetName))
+					{
+						// The package is already saved: Let the garbage collector release the audio data
+						SoundWave->ClearFlags(RF_Standalone);
+						++NumSavedAssets;
+						++NumAssetsSinceCollection;
+					}
+					else
+					{
+						UE_LOG(LogAzSpeechBatchSynthesis, Error, TEXT("%s: Failed to save asset '%s'"), *FString(__FUNCTION__), *AssetName);
+					}
+				}
+
+				if (NumAssetsSinceCollection >= AzSpeechBatchSynthesis::GarbageCollectionInterval)
+				{
+					CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+					NumAssetsSinceCollection = 0;
+				}
+			}
+			else
+			{
+				++NumFailedLines;
+				UE_LOG(LogAzSpeechBatchSynthesis, Error, TEXT("%s: Failed to synthesize line for asset '%s'"), *FString(__FUNCTION__),
+				       *Line.AssetNames[0]);
+			}
+
+			ActiveTasks.RemoveAtSwap(Index, 1, false);
+			ActiveLineIndices.RemoveAtSwap(Index, 1, false);
+		}
+
+		if (const double CurrentTime = FPlatformTime::Seconds(); CurrentTime - LastReportTime >= AzSpeechBatchSynthesis::ReportInterval)
+		{
+			LastReportTime = CurrentTime;
+			ReportThroughput(*FString(__FUNCTION__));
+		}
+
+		FPlatformProcess::Sleep(0.005f);
+	}
+
+	ReportThroughput(*FString(__FUNCTION__));
+
+	return NumFailedLines > 0 ? 1 : 0;
+}
+
+UDataTable* UAzSpeechBatchSynthesisCommandlet::LoadInputTable(const FString& Params)
+{
+	if (FString TablePath; FParse::Value(*Params, TEXT("Table="), TablePath))
+	{
+		UDataTable* const Table = LoadObject<UDataTable>(nullptr, *TablePath);
+		if (!Table || Table->GetRowStruct() != FAzSpeechBatchSynthesisRow::StaticStruct())
+		{
+			UE_LOG(LogAzSpeechBatchSynthesis, Error, TEXT("%s: '%s' is not a DataTable of FAzSpeechBatchSynthesisRow"), *FString(__FUNCTION__),
+			       *TablePath);
+			return nullptr;
+		}
+
+		return Table;
+	}
+
+	if (FString CSVPath; FParse::Value(*Params, TEXT("CSV="), CSVPath))
+	{
+		FString CSVContent;
+		if (!FFileHelper::LoadFileToString(CSVContent, *CSVPath))
+		{
+			UE_LOG(LogAzSpeechBatchSynthesis, Error, TEXT("%s: Failed to read '%s'"), *FString(__FUNCTION__), *CSVPath);
+			return nullptr;
+		}
+
+		// Same format of the DataTable CSV import: The first column is the row name
+		UDataTable* const Table = NewObject<UDataTable>(GetTransientPackage());
+		Table->RowStruct = FAzSpeechBatchSynthesisRow::StaticStruct();
+
+		for (const FString& Problem : Table->CreateTableFromCSVString(CSVContent))
+		{
+			UE_LOG(LogAzSpeechBatchSynthesis, Warning, TEXT("%s: %s"), *FString(__FUNCTION__), *Problem);
+		}
+
+		return Table;
+	}
+
+	UE_LOG(LogAzSpeechBatchSynthesis, Error, TEXT("%s: Missing input. Use -Table=/Game/Path/Table or -CSV=Path/File.csv"), *FString(__FUNCTION__));
+	return nullptr;
+}
+
+void UAzSpeechBatchSynthesisCommandlet::SetTaskFactory(FAzSpeechBatchSynthesisTaskFactory&& InTaskFactory)
+{
+	TaskFactory = MoveTemp(InTaskFactory);
+}
+
+TSharedRef<IAzSpeechBatchSynthesisTask> UAzSpeechBatchSynthesisCommandlet::StartSynthesisTask(const FString& SynthesisText, const FString& Voice,
+                                                                                             const FString& Locale, const bool bIsSSMLBased) const
+{
+	if (TaskFactory)
+	{
+		return TaskFactory(SynthesisText, Voice, Locale, bIsSSMLBased);
+	}
+
+	UAzSpeechAudioDataSynthesisBase* Task = nullptr;
+	if (bIsSSMLBased)
+	{
+		Task = USSMLToAudioDataAsync::SSMLToAudioData_DefaultOptions(nullptr, SynthesisText);
+	}
+	else
+	{
+		Task = UTextToAudioDataAsync::TextToAudioData_DefaultOptions(nullptr, SynthesisText, Voice, Locale);
+	}
+
+	Task->Activate();
+
+	return MakeShared<AzSpeechBatchSynthesis::FAzSpeechTaskAdapter>(Task);
+}
+
+const FString UAzSpeechBatchSynthesisCommandlet::GetPackageName(const FString& AssetName) const
+{
+	FString Output = FPaths::Combine(UAzSpeechHelper::QualifyModulePath(OutputModule), OutputDirectory, AssetName);
+	FPaths::NormalizeFilename(Output);
+
+	return Output;
+}
@@ -0,0 +1,67 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Commandlets/Commandlet.h>
+#include <AzSpeech/AzSpeechAudioBuffer.h>
+#include "AzSpeechBatchSynthesisCommandlet.generated.h"
+
+/**
+ * Synthesis of a single batch line: Polled by the commandlet until it's finished
+ */
+class IAzSpeechBatchSynthesisTask
+{
+public:
+	virtual ~IAzSpeechBatchSynthesisTask() = default;
+
+	virtual const bool IsFinished() const = 0;
+
+	/* Synthesized audio data, including the wav header, or an empty buffer if the synthesis failed */
+	virtual const FAzSpeechAudioBuffer GetResult() const = 0;
+};
+
+/* Creates and starts the synthesis of a line */
+using FAzSpeechBatchSynthesisTaskFactory = TFunction<TSharedRef<IAzSpeechBatchSynthesisTask>(const FString& SynthesisText, const FString& Voice,
+                                                                                             const FString& Locale, const bool bIsSSMLBased)>;
+
+/**
+ * Synthesizes the lines of a DataTable or CSV file (rows: FAzSpeechBatchSynthesisRow) and saves them as Sound Wave assets
+ *
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=AzSpeechBatchSynthesis (-Table=/Game/Path/Table | -CSV=C:/Path/Lines.csv)
+ *        [-Module=Game] [-Path=AzSpeech] [-Parallel=4] [-Force] [-DryRun]
+ *
+ * Lines with the same content and options are synthesized once. Lines with existing assets are skipped unless -Force is used, so an
+ * interrupted run can be resumed by running the same command again.
+ */
+UCLASS(MinimalAPI, NotBlueprintable, NotPlaceable, Category = "Implementation")
+class UAzSpeechBatchSynthesisCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	explicit UAzSpeechBatchSynthesisCommandlet(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual int32 Main(const FString& Params) override;
+
+	/* Replaces the AzSpeech tasks used to synthesize the lines, e.g. by a fake synthesizer: The subscription settings aren't checked when it's set */
+	void SetTaskFactory(FAzSpeechBatchSynthesisTaskFactory&& InTaskFactory);
+
+private:
+	class UDataTable* LoadInputTable(const FString& Params);
+	TSharedRef<IAzSpeechBatchSynthesisTask> StartSynthesisTask(const FString& SynthesisText, const FString& Voice, const FString& Locale,
+	                                                           const bool bIsSSMLBased) const;
+
+	const FString GetPackageName(const FString& AssetName) const;
+
+	UPROPERTY()
+	class UDataTable* InputTable;
+
+	TArray<TSharedRef<IAzSpeechBatchSynthesisTask>> ActiveTasks;
+	FAzSpeechBatchSynthesisTaskFactory TaskFactory;
+
+	FString OutputModule;
+	FString OutputDirectory;
+};
@@ -0,0 +1,249 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeechBatchSynthesisTestCommandlet.h"
+#include "Batch/AzSpeechBatchSynthesisCommandlet.h"
+#include <HAL/FileManager.h>
+#include <Misc/FileHelper.h>
+#include <Misc/PackageName.h>
+#include <Misc/Paths.h>
+#include <UObject/StrongObjectPtr.h>
+#include <Audio.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechBatchSynthesisTestCommandlet)
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogAzSpeechBatchSynthesisTest, Display, All);
+
+namespace AzSpeechBatchSynthesisTest
+{
+	// Lines containing this marker are failed by the fake synthesizer
+	const FString FailureMarker = TEXT("[Fail]");
+
+	// Row name, synthesis text, voice, locale and SSML flag: Line_02 is a duplicate of Line_01 and Line_04 always fails
+	const TCHAR* const InputCSV = TEXT(
+		"---,SynthesisText,Voice,Locale,bIsSSMLBased,AssetName\n"
+		"Line_01,\"Hello there\",en-US-JennyNeural,en-US,False,\n"
+		"Line_02,\"Hello there\",en-US-JennyNeural,en-US,False,\n"
+		"Line_03,\"General Kenobi\",en-US-JennyNeural,en-US,False,\n"
+		"Line_04,\"[Fail] This line is rejected by the service\",en-US-JennyNeural,en-US,False,\n"
+		"Line_05,\"Hello there\",en-US-GuyNeural,en-US,False,\n"
+		"Line_06,\"You are a bold one\",en-US-GuyNeural,en-US,False,\n"
+		"Line_07,\"Back away\",en-US-GuyNeural,en-US,False,\n"
+		"Line_08,\"I will deal with this Jedi slime myself\",en-US-GuyNeural,en-US,False,\n"
+		"Line_09,\"Your move\",en-GB-RyanNeural,en-GB,False,\n"
+		"Line_10,\"You fool\",en-GB-RyanNeural,en-GB,False,\n"
+		"Line_11,\"<speak version='1.0' xml:lang='en-US'>So uncivilized</speak>\",,,True,Line_11_SSML\n");
+
+	constexpr int32 NumRows = 11;
+	constexpr int32 NumUniqueLines = 10;
+	constexpr int32 NumFailedRows = 1;
+
+	struct FFakeSynthesizerStats
+	{
+		TMap<FString, int32> NumRequests;
+		int32 NumTotalRequests = 0;
+		int32 NumActiveTasks = 0;
+		int32 MaxActiveTasks = 0;
+	};
+
+	// Finishes after a random delay, like the service: Everything runs in the game thread loop of the commandlet
+	class FFakeSynthesisTask final : public IAzSpeechBatchSynthesisTask
+	{
+	public:
+		FFakeSynthesisTask(const TSharedRef<FFakeSynthesizerStats>& InStats, const FString& InSynthesisText, const float Delay)
+			: Stats(InStats), SynthesisText(InSynthesisText), FinishTime(FPlatformTime::Seconds() + Delay)
+		{
+			++Stats->NumRequests.FindOrAdd(SynthesisText);
+			++Stats->NumTotalRequests;
+			Stats->MaxActiveTasks = FMath::Max(Stats->MaxActiveTasks, ++Stats->NumActiveTasks);
+		}
+
+		virtual ~FFakeSynthesisTask() override
+		{
+			--Stats->NumActiveTasks;
+		}
+
+		virtual const bool IsFinished() const override
+		{
+			return FPlatformTime::Seconds() >= FinishTime;
+		}
+
+		virtual const FAzSpeechAudioBuffer GetResult() const override
+		{
+			if (SynthesisText.Contains(FailureMarker))
+			{
+				return FAzSpeechAudioBuffer();
+			}
+
+			// 100 ms of silence in the default output format
+			constexpr int32 SampleRate = 16000;
+
+			TArray<int16> Silence;
+			Silence.SetNumZeroed(SampleRate / 10);
+
+			TArray<uint8> WaveData;
+			SerializeWaveFile(WaveData, reinterpret_cast<const uint8*>(Silence.GetData()), Silence.Num() * sizeof(int16), 1, SampleRate);
+
+			return FAzSpeechAudioBuffer::FromArray(MoveTemp(WaveData));
+		}
+
+	private:
+		TSharedRef<FFakeSynthesizerStats> Stats;
+		FString SynthesisText;
+		double FinishTime;
+	};
+
+	struct FRunResult
+	{
+		int32 ExitCode = 0;
+		FFakeSynthesizerStats Stats;
+	};
+
+	FRunResult RunBatch(const FString& Params, FRandomStream& Random)
+	{
+		const TSharedRef<FFakeSynthesizerStats> Stats = MakeShared<FFakeSynthesizerStats>();
+
+		const TStrongObjectPtr<UAzSpeechBatchSynthesisCommandlet> Commandlet(NewObject<UAzSpeechBatchSynthesisCommandlet>());
+		Commandlet->SetTaskFactory([Stats, &Random](const FString& SynthesisText, [[maybe_unused]] const FString& Voice,
+		                                            [[maybe_unused]] const FString& Locale, [[maybe_unused]] const bool bIsSSMLBased)
+		{
+			return MakeShared<FFakeSynthesisTask>(Stats, SynthesisText, Random.FRandRange(0.005f, 0.05f));
+		});
+
+		FRunResult Output;
+		Output.ExitCode = Commandlet->Main(Params);
+		Output.Stats = *Stats;
+
+		return Output;
+	}
+
+	void DeleteOutputDirectory(const FString& OutputPath)
+	{
+		if (FString OutputDirectory; FPackageName::TryConvertLongPackageNameToFilename(FPaths::Combine(TEXT("/Game"), OutputPath) + TEXT("/"),
+		                                                                              OutputDirectory))
+		{
+			IFileManager::Get().DeleteDirectory(*OutputDirectory, false, true);
+		}
+	}
+}
+
+UAzSpeechBatchSynthesisTestCommandlet::UAzSpeechBatchSynthesisTestCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAzSpeechBatchSynthesisTestCommandlet::Main(const FString& Params)
+{
+	using namespace AzSpeechBatchSynthesisTest;
+
+	int32 MaxParallelTasks = 3;
+	FString OutputPath = TEXT("AzSpeechBatchSynthesisTest");
+
+	FParse::Value(*Params, TEXT("Parallel="), MaxParallelTasks);
+	FParse::Value(*Params, TEXT("Path="), OutputPath);
+
+	MaxParallelTasks = FMath::Clamp(MaxParallelTasks, 2, NumUniqueLines - 1);
+
+	const FString CSVPath = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("AzSpeech"),
+	                                                                          TEXT("BatchSynthesisTest.csv")));
+
+	if (!FFileHelper::SaveStringToFile(InputCSV, *CSVPath))
+	{
+		UE_LOG(LogAzSpeechBatchSynthesisTest, Error, TEXT("%s: Failed to write '%s'"), *FString(__FUNCTION__), *CSVPath);
+		return 1;
+	}
+
+	DeleteOutputDirectory(OutputPath);
+
+	int32 NumFailedChecks = 0;
+	const auto Check = [&NumFailedChecks](const bool bCondition, const FString& Description)
+	{
+		if (bCondition)
+		{
+			UE_LOG(LogAzSpeechBatchSynthesisTest, Display, TEXT("Passed: %s"), *Description);
+		}
+		else
+		{
+			UE_LOG(LogAzSpeechBatchSynthesisTest, Error, TEXT("Failed: %s"), *Description);
+			++NumFailedChecks;
+		}
+	};
+
+	const auto CountExistingAssets = [&OutputPath]
+	{
+		int32 Output = 0;
+		for (int32 Index = 1; Index <= NumRows; ++Index)
+		{
+			const FString AssetName = Index == NumRows ? FString::Printf(TEXT("Line_%02d_SSML"), Index) : FString::Printf(TEXT("Line_%02d"), Index);
+			Output += FPackageName::DoesPackageExist(FPaths::Combine(TEXT("/Game"), OutputPath, AssetName)) ? 1 : 0;
+		}
+
+		return Output;
+	};
+
+	const FString BatchParams = FString::Printf(TEXT("-CSV=\"%s\" -Module=Game -Path=%s -Parallel=%d"), *CSVPath, *OutputPath, MaxParallelTasks);
+	FRandomStream Random(42);
+
+	// First run: Every unique line is synthesized once and only the failed line has no asset
+	{
+		const FRunResult Result = RunBatch(BatchParams, Random);
+
+		Check(Result.ExitCode == 1, TEXT("First run reports the failed line in the exit code"));
+		Check(Result.Stats.NumTotalRequests == NumUniqueLines,
+		      FString::Printf(TEXT("First run synthesizes the %d unique lines once (requests: %d)"), NumUniqueLines, Result.Stats.NumTotalRequests));
+		Check(Result.Stats.NumRequests.FindRef(TEXT("Hello there")) == 2,
+		      TEXT("Rows with the same text and options are deduplicated, rows with another voice are not"));
+		Check(Result.Stats.MaxActiveTasks == MaxParallelTasks,
+		      FString::Printf(TEXT("First run keeps %d tasks in parallel (max: %d)"), MaxParallelTasks, Result.Stats.MaxActiveTasks));
+		Check(Result.Stats.NumActiveTasks == 0, TEXT("First run releases every task"));
+		Check(CountExistingAssets() == NumRows - NumFailedRows,
+		      FString::Printf(TEXT("First run saves an asset for each successful row (assets: %d)"), CountExistingAssets()));
+	}
+
+	// Resumed run: Only the line without an asset is requested again
+	{
+		const FRunResult Result = RunBatch(BatchParams, Random);
+
+		Check(Result.ExitCode == 1, TEXT("Resumed run still reports the failed line"));
+		bool bOnlyFailedLines = true;
+		for (const TPair<FString, int32>& Iterator : Result.Stats.NumRequests)
+		{
+			bOnlyFailedLines &= Iterator.Key.Contains(FailureMarker);
+		}
+
+		Check(Result.Stats.NumTotalRequests == NumFailedRows && bOnlyFailedLines,
+		      FString::Printf(TEXT("Resumed run only requests the failed line (requests: %d)"), Result.Stats.NumTotalRequests));
+	}
+
+	// Forced run: Existing assets are synthesized and saved again
+	{
+		const FRunResult Result = RunBatch(BatchParams + TEXT(" -Force"), Random);
+
+		Check(Result.ExitCode == 1, TEXT("Forced run still reports the failed line"));
+		Check(Result.Stats.NumTotalRequests == NumUniqueLines,
+		      FString::Printf(TEXT("Forced run synthesizes every unique line again (requests: %d)"), Result.Stats.NumTotalRequests));
+		Check(CountExistingAssets() == NumRows - NumFailedRows, TEXT("Forced run keeps an asset for each successful row"));
+	}
+
+	// Dry run: The lines are only counted
+	{
+		const FRunResult Result = RunBatch(BatchParams + TEXT(" -Force -DryRun"), Random);
+
+		Check(Result.ExitCode == 0 && Result.Stats.NumTotalRequests == 0, TEXT("Dry run doesn't request any line"));
+	}
+
+	DeleteOutputDirectory(OutputPath);
+	IFileManager::Get().Delete(*CSVPath);
+
+	UE_LOG(LogAzSpeechBatchSynthesisTest, Display, TEXT("%s: %s; Failed checks: %d"), *FString(__FUNCTION__),
+	       NumFailedChecks == 0 ? TEXT("Success") : TEXT("Failure"), NumFailedChecks);
+
+	return NumFailedChecks == 0 ? 0 : 1;
+}
@@ -0,0 +1,28 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Commandlets/Commandlet.h>
+#include "AzSpeechBatchSynthesisTestCommandlet.generated.h"
+
+/**
+ * Runs the AzSpeechBatchSynthesis commandlet against a fake synthesizer: Checks the line deduplication, the resume and -Force runs, the parallel
+ * tasks limit and the failed lines
+ *
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=AzSpeechBatchSynthesisTest [-Parallel=3] [-Path=AzSpeechBatchSynthesisTest]
+ *
+ * The assets are written to the Game content directory, in the given path, and deleted at the end of the test.
+ */
+UCLASS(MinimalAPI, NotBlueprintable, NotPlaceable, Category = "Implementation")
+class UAzSpeechBatchSynthesisTestCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	explicit UAzSpeechBatchSynthesisTestCommandlet(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,209 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeechAudioConverterBenchmarkCommandlet.h"
+#include <AzSpeech/AzSpeechAudioConverter.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechAudioConverterBenchmarkCommandlet)
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogAzSpeechAudioConverterBenchmark, Display, All);
+
+namespace AzSpeechAudioConverterBenchmark
+{
+	// Same callback size of the microphone capture: About 10 ms at 48 kHz
+	constexpr int32 NumCallbackFrames = 480;
+
+	// Previous implementation of the microphone capture: Scalar downmix, linear resampling and 16 bits conversion
+	struct FScalarReference
+	{
+		double Position = 0.0;
+		float LastSample = 0.f;
+
+		TArray<float> MonoBuffer;
+		TArray<float> ResampledBuffer;
+		TArray<int16> PCMBuffer;
+
+		void Process(const float* const InAudio, const int32 NumFrames, const int32 NumChannels, const int32 SampleRate, const int32 OutputSampleRate)
+		{
+			MonoBuffer.SetNumUninitialized(NumFrames, false);
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				float Sum = 0.f;
+				for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+				{
+					Sum += InAudio[Frame * NumChannels + Channel];
+				}
+
+				MonoBuffer[Frame] = Sum / NumChannels;
+			}
+
+			const double Step = static_cast<double>(SampleRate) / OutputSampleRate;
+			ResampledBuffer.Reset(static_cast<int32>(NumFrames / Step) + 2);
+
+			while (Position < NumFrames - 1)
+			{
+				const int32 Index = FMath::FloorToInt(Position);
+				const float Alpha = static_cast<float>(Position - Index);
+
+				ResampledBuffer.Add(FMath::Lerp(Index < 0 ? LastSample : MonoBuffer[Index], MonoBuffer[Index + 1], Alpha));
+				Position += Step;
+			}
+
+			Position -= NumFrames;
+			LastSample = MonoBuffer.Last();
+
+			PCMBuffer.SetNumUninitialized(ResampledBuffer.Num(), false);
+			for (int32 Index = 0; Index < ResampledBuffer.Num(); ++Index)
+			{
+				PCMBuffer[Index] = static_cast<int16>(FMath::Clamp(ResampledBuffer[Index], -1.f, 1.f) * 32767.f);
+			}
+		}
+	};
+
+	// Runs the function on every callback of the input and returns the best time of the iterations
+	template <typename FunctionType>
+	double Measure(const int32 NumIterations, const int32 NumFrames, FunctionType&& Function)
+	{
+		double BestTime = TNumericLimits<double>::Max();
+
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Frame = 0; Frame < NumFrames; Frame += NumCallbackFrames)
+			{
+				Function(Frame, FMath::Min(NumCallbackFrames, NumFrames - Frame));
+			}
+
+			BestTime = FMath::Min(BestTime, FPlatformTime::Seconds() - StartTime);
+		}
+
+		return BestTime;
+	}
+
+	void Report(const TCHAR* const Name, const double ElapsedTime, const int32 NumFrames, const int32 NumChannels, const double AudioDuration,
+	            const double ReferenceTime)
+	{
+		const double SamplesPerSecond = ElapsedTime > 0.0 ? static_cast<double>(NumFrames) * NumChannels / ElapsedTime : 0.0;
+		const double RealTimeFactor = ElapsedTime > 0.0 ? AudioDuration / ElapsedTime : 0.0;
+
+		UE_LOG(LogAzSpeechAudioConverterBenchmark, Display,
+		       TEXT("%-12s %8.2f ms; %8.1f M input samples/s per core; %8.0fx real time; %.2fx the scalar reference"), Name, ElapsedTime * 1000.0,
+		       SamplesPerSecond / 1000000.0, RealTimeFactor, ElapsedTime > 0.0 ? ReferenceTime / ElapsedTime : 0.0);
+	}
+}
+
+UAzSpeechAudioConverterBenchmarkCommandlet::UAzSpeechAudioConverterBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAzSpeechAudioConverterBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace AzSpeechAudioConverterBenchmark;
+
+	int32 InputRate = 48000;
+	int32 NumChannels = 2;
+	int32 NumSeconds = 60;
+	int32 NumIterations = 5;
+
+	FParse::Value(*Params, TEXT("InputRate="), InputRate);
+	FParse::Value(*Params, TEXT("Channels="), NumChannels);
+	FParse::Value(*Params, TEXT("Seconds="), NumSeconds);
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+
+	InputRate = FMath::Max(InputRate, 8000);
+	NumChannels = FMath::Clamp(NumChannels, 1, 8);
+	NumSeconds = FMath::Max(NumSeconds, 1);
+	NumIterations = FMath::Max(NumIterations, 1);
+
+	constexpr int32 OutputRate = 16000;
+	const int32 NumFrames = InputRate * NumSeconds;
+
+	// Synthetic voice-like signal: Harmonics of a varying pitch with noise, slightly different per channel
+	TArray<float> Input;
+	Input.SetNumUninitialized(NumFrames * NumChannels);
+
+	FRandomStream Random(42);
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const float Time = static_cast<float>(Frame) / InputRate;
+		const float Pitch = 140.f + 40.f * FMath::Sin(2.f * PI * 0.5f * Time);
+
+		float Voice = 0.f;
+		for (int32 Harmonic = 1; Harmonic <= 8; ++Harmonic)
+		{
+			Voice += FMath::Sin(2.f * PI * Pitch * Harmonic * Time) / Harmonic;
+		}
+
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			Input[Frame * NumChannels + Channel] = 0.2f * Voice * (1.f - 0.1f * Channel) + 0.01f * Random.FRandRange(-1.f, 1.f);
+		}
+	}
+
+	const double AudioDuration = static_cast<double>(NumSeconds);
+
+	TArray<float> MonoBuffer;
+	MonoBuffer.SetNumUninitialized(NumCallbackFrames);
+
+	FAzSpeechAudioConverter Converter(InputRate, NumChannels, OutputRate, NumCallbackFrames);
+
+	TArray<float> ResampledBuffer;
+	ResampledBuffer.SetNumUninitialized(Converter.GetMaxOutputFrames(NumCallbackFrames));
+
+	TArray<int16> PCMBuffer;
+	PCMBuffer.SetNumUninitialized(ResampledBuffer.Num());
+
+	FScalarReference Reference;
+	const double ReferenceTime = Measure(NumIterations, NumFrames, [&](const int32 Frame, const int32 NumCallbackSamples)
+	{
+		Reference.Process(Input.GetData() + Frame * NumChannels, NumCallbackSamples, NumChannels, InputRate, OutputRate);
+	});
+
+	const double DownmixTime = Measure(NumIterations, NumFrames, [&](const int32 Frame, const int32 NumCallbackSamples)
+	{
+		FAzSpeechAudioConverter::Downmix(Input.GetData() + Frame * NumChannels, NumCallbackSamples, NumChannels, MonoBuffer.GetData());
+	});
+
+	int64 NumOutputSamples = 0;
+	const double ResampleTime = Measure(NumIterations, NumFrames, [&](const int32 Frame, const int32 NumCallbackSamples)
+	{
+		NumOutputSamples += Converter.Process(Input.GetData() + Frame * NumChannels, NumCallbackSamples, ResampledBuffer);
+	});
+	NumOutputSamples /= NumIterations;
+
+	const double ConversionTime = Measure(NumIterations, NumFrames, [&](const int32 Frame, const int32 NumCallbackSamples)
+	{
+		const int32 NumSamples = FMath::Min(ResampledBuffer.Num(), NumCallbackSamples);
+		FAzSpeechAudioConverter::FloatToInt16(ResampledBuffer.GetData(), NumSamples, PCMBuffer.GetData());
+	});
+
+	Converter.Reset();
+	const double PipelineTime = Measure(NumIterations, NumFrames, [&](const int32 Frame, const int32 NumCallbackSamples)
+	{
+		const int32 NumSamples = Converter.Process(Input.GetData() + Frame * NumChannels, NumCallbackSamples, ResampledBuffer);
+		FAzSpeechAudioConverter::FloatToInt16(ResampledBuffer.GetData(), NumSamples, PCMBuffer.GetData());
+	});
+
+	UE_LOG(LogAzSpeechAudioConverterBenchmark, Display, TEXT("Input: %d Hz; %d channels; %d s; Output: %d Hz mono; %lld samples; Best of %d runs"),
+	       InputRate, NumChannels, NumSeconds, OutputRate, NumOutputSamples, NumIterations);
+
+	Report(TEXT("Reference:"), ReferenceTime, NumFrames, NumChannels, AudioDuration, ReferenceTime);
+	Report(TEXT("Downmix:"), DownmixTime, NumFrames, NumChannels, AudioDuration, ReferenceTime);
+	Report(TEXT("Resample:"), ResampleTime, NumFrames, NumChannels, AudioDuration, ReferenceTime);
+	Report(TEXT("Int16:"), ConversionTime, NumFrames, NumChannels, AudioDuration, ReferenceTime);
+	Report(TEXT("Pipeline:"), PipelineTime, NumFrames, NumChannels, AudioDuration, ReferenceTime);
+
+	// Number of microphones that a single core can convert at the same time
+	UE_LOG(LogAzSpeechAudioConverterBenchmark, Display, TEXT("Simultaneous captures per core: %.0f (scalar reference: %.0f)"),
+	       PipelineTime > 0.0 ? AudioDuration / PipelineTime : 0.0, ReferenceTime > 0.0 ? AudioDuration / ReferenceTime : 0.0);
+
+	return 0;
+}
@@ -0,0 +1,25 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Commandlets/Commandlet.h>
+#include "AzSpeechAudioConverterBenchmarkCommandlet.generated.h"
+
+/**
+ * Measures the audio conversion used by the engine microphone capture against a scalar reference: Downmix, resampling to 16 kHz and 16 bits conversion
+ *
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=AzSpeechAudioConverterBenchmark [-InputRate=48000] [-Channels=2] [-Seconds=60] [-Iterations=5]
+ */
+UCLASS(MinimalAPI, NotBlueprintable, NotPlaceable, Category = "Implementation")
+class UAzSpeechAudioConverterBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	explicit UAzSpeechAudioConverterBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual int32 Main(const FString& Params) override;
+};
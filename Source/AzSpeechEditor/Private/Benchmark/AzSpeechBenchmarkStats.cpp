@@ -0,0 +1,39 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeechBenchmarkStats.h"
+
+FAzSpeechBenchmarkStats::FAzSpeechBenchmarkStats(const TArray<double>& SortedSamples) : NumSamples(SortedSamples.Num())
+{
+	if (NumSamples == 0)
+	{
+		return;
+	}
+
+	double Sum = 0.0;
+	for (const double Sample : SortedSamples)
+	{
+		Sum += Sample;
+	}
+
+	const auto Percentile = [&SortedSamples](const double Value)
+	{
+		return SortedSamples[FMath::Clamp(FMath::FloorToInt(Value * (SortedSamples.Num() - 1)), 0, SortedSamples.Num() - 1)];
+	};
+
+	Mean = Sum / NumSamples;
+	P50 = Percentile(0.5);
+	P95 = Percentile(0.95);
+	Max = SortedSamples.Last();
+}
+
+const FString FAzSpeechBenchmarkStats::ToString(const TCHAR* const Unit) const
+{
+	if (NumSamples == 0)
+	{
+		return TEXT("No samples");
+	}
+
+	return FString::Printf(TEXT("Mean: %9.3f %s; P50: %9.3f %s; P95: %9.3f %s; Max: %9.3f %s"), Mean, Unit, P50, Unit, P95, Unit, Max, Unit);
+}
@@ -0,0 +1,27 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+/**
+ * Summary of the samples measured by the benchmark commandlets: Mean, median, 95th percentile and maximum
+ */
+struct FAzSpeechBenchmarkStats
+{
+	FAzSpeechBenchmarkStats() = default;
+
+	/* The samples must be sorted in ascending order */
+	explicit FAzSpeechBenchmarkStats(const TArray<double>& SortedSamples);
+
+	/* Formats the summary with the given unit, e.g.: Mean: 1.234 ms; P50: 1.000 ms; P95: 2.000 ms; Max: 3.000 ms */
+	const FString ToString(const TCHAR* const Unit) const;
+
+	int32 NumSamples = 0;
+	double Mean = 0.0;
+	double P50 = 0.0;
+	double P95 = 0.0;
+	double Max = 0.0;
+};
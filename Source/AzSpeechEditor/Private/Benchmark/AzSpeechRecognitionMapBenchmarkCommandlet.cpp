@@ -0,0 +1,172 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeechRecognitionMapBenchmarkCommandlet.h"
+#include <AzSpeech/AzSpeechRecognitionMatcher.h>
+#include <AzSpeech/Structures/AzSpeechRecognitionMap.h>
+#include <Math/RandomStream.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechRecognitionMapBenchmarkCommandlet)
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogAzSpeechRecognitionMapBenchmark, Display, All);
+
+namespace AzSpeechRecognitionMapBenchmark
+{
+	const FString StringDelimiters = TEXT(R"( ,.;:[]{}!'"?)");
+
+	FString MakeWord(FRandomStream& Stream)
+	{
+		FString Output;
+
+		const int32 Length = Stream.RandRange(3, 9);
+		for (int32 Index = 0; Index < Length; ++Index)
+		{
+			Output.AppendChar(static_cast<TCHAR>(TEXT('a') + Stream.RandRange(0, 25)));
+		}
+
+		return Output;
+	}
+
+	/* Same semantics as the previous recognition map check: A case insensitive search per key */
+	bool ContainsKey(const FString& InString, const FString& Key)
+	{
+		const int32 Index = InString.Find(Key, ESearchCase::IgnoreCase, ESearchDir::FromStart, -1);
+		if (Index == INDEX_NONE)
+		{
+			return false;
+		}
+
+		const int32 End = Index + Key.Len();
+		return (Index == 0 || StringDelimiters.Contains(InString.Mid(Index - 1, 1))) && (End == InString.Len() || StringDelimiters.Contains(
+			InString.Mid(End, 1)));
+	}
+
+	int32 NaiveMatch(const FAzSpeechRecognitionMap& InMap, const FString& InString)
+	{
+		int32 Output = -1;
+		uint32 MatchPoints = 0u;
+
+		for (const FAzSpeechRecognitionData& Data : InMap.Data)
+		{
+			uint32 DataMatchPoints = 0u;
+			for (const FString& Trigger : Data.TriggerKeys)
+			{
+				if (ContainsKey(InString, Trigger))
+				{
+					DataMatchPoints += Data.Weight;
+				}
+			}
+
+			if (DataMatchPoints > MatchPoints)
+			{
+				MatchPoints = DataMatchPoints;
+				Output = Data.Value;
+			}
+		}
+
+		return Output;
+	}
+}
+
+UAzSpeechRecognitionMapBenchmarkCommandlet::UAzSpeechRecognitionMapBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAzSpeechRecognitionMapBenchmarkCommandlet::Main(const FString& Params)
+{
+	int32 NumKeys = 10000;
+	int32 NumEntries = 1000;
+	int32 NumIterations = 1000;
+
+	FParse::Value(*Params, TEXT("Keys="), NumKeys);
+	FParse::Value(*Params, TEXT("Entries="), NumEntries);
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+
+	NumKeys = FMath::Max(1, NumKeys);
+	NumEntries = FMath::Clamp(NumEntries, 1, NumKeys);
+	NumIterations = FMath::Max(1, NumIterations);
+
+	FRandomStream Stream(1234);
+
+	FAzSpeechRecognitionMap RecognitionMap;
+	RecognitionMap.GroupName = TEXT("Benchmark");
+
+	for (int32 Index = 0; Index < NumEntries; ++Index)
+	{
+		RecognitionMap.Data.Emplace(Index, Stream.RandRange(1, 3));
+	}
+
+	TArray<FString> AllKeys;
+	for (int32 Index = 0; Index < NumKeys; ++Index)
+	{
+		FString& NewKey = AllKeys.Add_GetRef(AzSpeechRecognitionMapBenchmark::MakeWord(Stream));
+		RecognitionMap.Data[Index % NumEntries].TriggerKeys.Add(NewKey);
+	}
+
+	// Recognized sentences of about 12 words, with a few keys from the map
+	TArray<FString> Sentences;
+	for (int32 Index = 0; Index < 64; ++Index)
+	{
+		TArray<FString> Words;
+		for (int32 Word = 0; Word < 12; ++Word)
+		{
+			Words.Add(Stream.FRand() < 0.25f ? AllKeys[Stream.RandRange(0, NumKeys - 1)].ToUpper() : AzSpeechRecognitionMapBenchmark::MakeWord(Stream));
+		}
+
+		Sentences.Add(FString::Join(Words, TEXT(" ")) + TEXT("."));
+	}
+
+	double StartTime = FPlatformTime::Seconds();
+	const FAzSpeechRecognitionMatcher Matcher(RecognitionMap, AzSpeechRecognitionMapBenchmark::StringDelimiters);
+	const double CompileTime = FPlatformTime::Seconds() - StartTime;
+
+	int32 NumMismatches = 0;
+	for (const FString& Sentence : Sentences)
+	{
+		uint32 MatchPoints = 0u;
+		if (Matcher.Match(Sentence, false, MatchPoints) != AzSpeechRecognitionMapBenchmark::NaiveMatch(RecognitionMap, Sentence))
+		{
+			++NumMismatches;
+		}
+	}
+
+	StartTime = FPlatformTime::Seconds();
+	int64 Checksum = 0;
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		uint32 MatchPoints = 0u;
+		Checksum += Matcher.Match(Sentences[Iteration % Sentences.Num()], false, MatchPoints);
+	}
+	const double CompiledTime = FPlatformTime::Seconds() - StartTime;
+
+	// The per key search is much slower: Limit the iterations to keep the benchmark short
+	const int32 NumNaiveIterations = FMath::Min(NumIterations, 100);
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumNaiveIterations; ++Iteration)
+	{
+		Checksum += AzSpeechRecognitionMapBenchmark::NaiveMatch(RecognitionMap, Sentences[Iteration % Sentences.Num()]);
+	}
+	const double NaiveTime = FPlatformTime::Seconds() - StartTime;
+
+	const double CompiledAverage = CompiledTime * 1000000.0 / NumIterations;
+	const double NaiveAverage = NaiveTime * 1000000.0 / NumNaiveIterations;
+
+	UE_LOG(LogAzSpeechRecognitionMapBenchmark, Display, TEXT("Keys: %d; Entries: %d; Compiled size: %llu KB; Compile time: %.2f ms"), NumKeys, NumEntries,
+	       static_cast<uint64>(Matcher.GetAllocatedSize() / 1024), CompileTime * 1000.0);
+	UE_LOG(LogAzSpeechRecognitionMapBenchmark, Display, TEXT("Compiled match: %.2f us/string; Per key search: %.2f us/string; Speedup: %.1fx"),
+	       CompiledAverage, NaiveAverage, CompiledAverage > 0.0 ? NaiveAverage / CompiledAverage : 0.0);
+	// The per key search only checks the first occurrence of each key: A key inside a longer word hides a later occurrence at word boundaries
+	UE_LOG(LogAzSpeechRecognitionMapBenchmark, Display, TEXT("Results different from the per key search: %d of %d; Checksum: %lld"), NumMismatches,
+	       Sentences.Num(), Checksum);
+
+	return 0;
+}
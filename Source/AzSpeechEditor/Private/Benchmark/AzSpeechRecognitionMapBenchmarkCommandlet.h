@@ -0,0 +1,25 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Commandlets/Commandlet.h>
+#include "AzSpeechRecognitionMapBenchmarkCommandlet.generated.h"
+
+/**
+ * Compares the compiled recognition map matcher with the per key search on a generated recognition map group
+ *
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=AzSpeechRecognitionMapBenchmark [-Keys=10000] [-Entries=1000] [-Iterations=1000]
+ */
+UCLASS(MinimalAPI, NotBlueprintable, NotPlaceable, Category = "Implementation")
+class UAzSpeechRecognitionMapBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	explicit UAzSpeechRecognitionMapBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,166 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeechSoundWaveBenchmarkCommandlet.h"
+#include "AzSpeechBenchmarkStats.h"
+#include <AzSpeech/AzSpeechAudioBuffer.h>
+#include <AzSpeech/AzSpeechHelper.h>
+#include <Sound/SoundWave.h>
+#include <Audio.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechSoundWaveBenchmarkCommandlet)
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogAzSpeechSoundWaveBenchmark, Display, All);
+
+namespace AzSpeechSoundWaveBenchmark
+{
+	// Synthetic voice-like line in the riff format of the synthesis output: Harmonics of a varying pitch
+	FAzSpeechAudioBuffer MakeLine(const int32 SampleRate, const float Duration, FRandomStream& Random)
+	{
+		const int32 NumSamples = FMath::Max(1, static_cast<int32>(SampleRate * Duration));
+		const float BasePitch = Random.FRandRange(100.f, 220.f);
+
+		TArray<int16> Samples;
+		Samples.SetNumUninitialized(NumSamples);
+
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			const float Time = static_cast<float>(Index) / SampleRate;
+			const float Pitch = BasePitch + 40.f * FMath::Sin(2.f * PI * 0.5f * Time);
+
+			float Voice = 0.f;
+			for (int32 Harmonic = 1; Harmonic <= 4; ++Harmonic)
+			{
+				Voice += FMath::Sin(2.f * PI * Pitch * Harmonic * Time) / Harmonic;
+			}
+
+			Samples[Index] = static_cast<int16>(FMath::Clamp(0.2f * Voice, -1.f, 1.f) * 32767.f);
+		}
+
+		TArray<uint8> WaveData;
+		SerializeWaveFile(WaveData, reinterpret_cast<const uint8*>(Samples.GetData()), Samples.Num() * sizeof(int16), 1, SampleRate);
+
+		return FAzSpeechAudioBuffer::FromArray(MoveTemp(WaveData));
+	}
+
+	struct FResult
+	{
+		TArray<double> LineTimes;
+		double BestTotalTime = TNumericLimits<double>::Max();
+		int64 CopiedBytesPerRun = 0;
+		int32 NumFailures = 0;
+	};
+
+	// Converts every line once per iteration: The sound waves of each iteration are collected before the next one
+	template <typename FunctionType>
+	FResult Measure(const TArray<FAzSpeechAudioBuffer>& Lines, const int32 NumIterations, FunctionType&& Function)
+	{
+		FResult Output;
+		Output.LineTimes.Reserve(Lines.Num() * NumIterations);
+
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			FAzSpeechAudioBuffer::ResetStats();
+
+			double TotalTime = 0.0;
+			for (const FAzSpeechAudioBuffer& Line : Lines)
+			{
+				const double StartTime = FPlatformTime::Seconds();
+				const USoundWave* const SoundWave = Function(Line);
+				const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+				Output.NumFailures += SoundWave ? 0 : 1;
+				Output.LineTimes.Add(ElapsedTime * 1000000.0);
+				TotalTime += ElapsedTime;
+			}
+
+			Output.BestTotalTime = FMath::Min(Output.BestTotalTime, TotalTime);
+			Output.CopiedBytesPerRun = FAzSpeechAudioBuffer::GetStats().CopiedBytes;
+
+			CollectGarbage(RF_NoFlags);
+		}
+
+		Output.LineTimes.Sort();
+
+		return Output;
+	}
+
+	void Report(const TCHAR* const Name, const FResult& Result, const int32 NumLines, const double ReferenceTime)
+	{
+		UE_LOG(LogAzSpeechSoundWaveBenchmark, Display, TEXT("%-11s Per line: %s; Total: %8.2f ms; Copied: %.1f KB per line; %.2fx the asset path"), Name,
+		       *FAzSpeechBenchmarkStats(Result.LineTimes).ToString(TEXT("us")), Result.BestTotalTime * 1000.0,
+		       static_cast<double>(Result.CopiedBytesPerRun) / NumLines / 1024.0, Result.BestTotalTime > 0.0 ? ReferenceTime / Result.BestTotalTime : 0.0);
+
+		if (Result.NumFailures > 0)
+		{
+			UE_LOG(LogAzSpeechSoundWaveBenchmark, Error, TEXT("%-11s %d conversions failed"), Name, Result.NumFailures);
+		}
+	}
+}
+
+UAzSpeechSoundWaveBenchmarkCommandlet::UAzSpeechSoundWaveBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAzSpeechSoundWaveBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace AzSpeechSoundWaveBenchmark;
+
+	int32 NumLines = 200;
+	float MinSeconds = 1.f;
+	float MaxSeconds = 6.f;
+	int32 SampleRate = 16000;
+	int32 NumIterations = 5;
+
+	FParse::Value(*Params, TEXT("Lines="), NumLines);
+	FParse::Value(*Params, TEXT("MinSeconds="), MinSeconds);
+	FParse::Value(*Params, TEXT("MaxSeconds="), MaxSeconds);
+	FParse::Value(*Params, TEXT("SampleRate="), SampleRate);
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+
+	NumLines = FMath::Max(NumLines, 1);
+	MinSeconds = FMath::Max(MinSeconds, 0.1f);
+	MaxSeconds = FMath::Max(MaxSeconds, MinSeconds);
+	SampleRate = FMath::Max(SampleRate, 8000);
+	NumIterations = FMath::Max(NumIterations, 1);
+
+	FRandomStream Random(42);
+
+	TArray<FAzSpeechAudioBuffer> Lines;
+	Lines.Reserve(NumLines);
+
+	double AudioDuration = 0.0;
+	for (int32 Index = 0; Index < NumLines; ++Index)
+	{
+		const float Duration = Random.FRandRange(MinSeconds, MaxSeconds);
+		Lines.Add(MakeLine(SampleRate, Duration, Random));
+		AudioDuration += Duration;
+	}
+
+	// Same call of the sound wave tasks before the transient path: No output module, so the sound wave is created in the transient package
+	const FResult AssetResult = Measure(Lines, NumIterations, [](const FAzSpeechAudioBuffer& Line)
+	{
+		return UAzSpeechHelper::ConvertAudioBufferToSoundWave(Line);
+	});
+
+	const FResult TransientResult = Measure(Lines, NumIterations, [](const FAzSpeechAudioBuffer& Line)
+	{
+		return UAzSpeechHelper::ConvertAudioBufferToTransientSoundWave(Line);
+	});
+
+	UE_LOG(LogAzSpeechSoundWaveBenchmark, Display, TEXT("%d lines; %.1f s of audio at %d Hz; Best total of %d runs"), NumLines, AudioDuration,
+	       SampleRate, NumIterations);
+
+	Report(TEXT("Asset:"), AssetResult, NumLines, AssetResult.BestTotalTime);
+	Report(TEXT("Transient:"), TransientResult, NumLines, AssetResult.BestTotalTime);
+
+	return 0;
+}
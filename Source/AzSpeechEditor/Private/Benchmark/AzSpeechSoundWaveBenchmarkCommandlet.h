@@ -0,0 +1,25 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Commandlets/Commandlet.h>
+#include "AzSpeechSoundWaveBenchmarkCommandlet.generated.h"
+
+/**
+ * Measures the sound wave creation of the synthesized lines: The asset conversion path against the transient runtime path
+ *
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=AzSpeechSoundWaveBenchmark [-Lines=200] [-MinSeconds=1] [-MaxSeconds=6] [-SampleRate=16000] [-Iterations=5]
+ */
+UCLASS(MinimalAPI, NotBlueprintable, NotPlaceable, Category = "Implementation")
+class UAzSpeechSoundWaveBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	explicit UAzSpeechSoundWaveBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,84 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeechStopLatencyBenchmarkCommandlet.h"
+#include "AzSpeechBenchmarkStats.h"
+#include <AzSpeech/Runnables/Bases/AzSpeechRunnableStopSignal.h>
+#include <Async/Async.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechStopLatencyBenchmarkCommandlet)
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogAzSpeechStopLatencyBenchmark, Display, All);
+
+namespace AzSpeechStopLatencyBenchmark
+{
+	// Returns the latency in milliseconds of each stop request: The request is sent at a random time, like the final result of a task
+	TArray<double> Measure(const int32 NumIterations, const float PollInterval, FRandomStream& Random)
+	{
+		TArray<double> Latencies;
+		Latencies.Reserve(NumIterations);
+
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			FAzSpeechRunnableStopSignal StopSignal;
+
+			// Same wait of the dedicated runnable threads
+			TFuture<double> WakeTime = Async(EAsyncExecution::Thread, [&StopSignal, PollInterval]
+			{
+				StopSignal.Wait(PollInterval);
+				return FPlatformTime::Seconds();
+			});
+
+			FPlatformProcess::Sleep(Random.FRandRange(0.001f, 0.05f));
+			StopSignal.Request();
+
+			Latencies.Add((WakeTime.Get() - StopSignal.GetRequestTime()) * 1000.0);
+		}
+
+		Latencies.Sort();
+
+		return Latencies;
+	}
+
+	void Report(const TCHAR* const Name, const TArray<double>& Latencies)
+	{
+		UE_LOG(LogAzSpeechStopLatencyBenchmark, Display, TEXT("%-18s %s"), Name, *FAzSpeechBenchmarkStats(Latencies).ToString(TEXT("ms")));
+	}
+}
+
+UAzSpeechStopLatencyBenchmarkCommandlet::UAzSpeechStopLatencyBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAzSpeechStopLatencyBenchmarkCommandlet::Main(const FString& Params)
+{
+	int32 NumIterations = 200;
+	float PollInterval = 0.016667f;
+
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+	FParse::Value(*Params, TEXT("Interval="), PollInterval);
+
+	NumIterations = FMath::Max(NumIterations, 1);
+	PollInterval = FMath::Clamp(PollInterval, 0.0001f, 1.f);
+
+	FRandomStream Random(42);
+
+	const TArray<double> EventLatencies = AzSpeechStopLatencyBenchmark::Measure(NumIterations, 0.f, Random);
+	const TArray<double> PollingLatencies = AzSpeechStopLatencyBenchmark::Measure(NumIterations, PollInterval, Random);
+
+	UE_LOG(LogAzSpeechStopLatencyBenchmark, Display, TEXT("Stop request to thread wake up; %d requests per mode; Poll interval: %.3f ms"),
+	       NumIterations, PollInterval * 1000.f);
+
+	AzSpeechStopLatencyBenchmark::Report(TEXT("Stop event:"), EventLatencies);
+	AzSpeechStopLatencyBenchmark::Report(TEXT("Polling (legacy):"), PollingLatencies);
+
+	return 0;
+}
@@ -0,0 +1,25 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Commandlets/Commandlet.h>
+#include "AzSpeechStopLatencyBenchmarkCommandlet.generated.h"
+
+/**
+ * Measures the time between the stop request of a runnable and the wake up of its dedicated thread: Stop event against the legacy polling
+ *
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=AzSpeechStopLatencyBenchmark [-Iterations=200] [-Interval=0.016667]
+ */
+UCLASS(MinimalAPI, NotBlueprintable, NotPlaceable, Category = "Implementation")
+class UAzSpeechStopLatencyBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	explicit UAzSpeechStopLatencyBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,285 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeechStreamingPlaybackBenchmarkCommandlet.h"
+#include "AzSpeechBenchmarkStats.h"
+#include <AzSpeech/AzSpeechAudioBuffer.h>
+#include <AzSpeech/AzSpeechHelper.h>
+#include <Sound/SoundWave.h>
+#include <Sound/SoundWaveProcedural.h>
+#include <Misc/FileHelper.h>
+#include <Containers/Queue.h>
+#include <Async/Async.h>
+#include <Audio.h>
+#include <atomic>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechStreamingPlaybackBenchmarkCommandlet)
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogAzSpeechStreamingPlaybackBenchmark, Display, All);
+
+namespace AzSpeechStreamingPlaybackBenchmark
+{
+	// Same request size of the audio mixer when it pulls a procedural sound wave
+	constexpr int32 NumMixerSamples = 1024;
+
+	// Synthetic voice-like signal used when no recording is given: Harmonics of a varying pitch, 16 kHz mono like the default output format
+	TArray<uint8> MakeSyntheticRecording(const int32 NumSeconds)
+	{
+		constexpr int32 SampleRate = 16000;
+		const int32 NumSamples = SampleRate * NumSeconds;
+
+		TArray<int16> Samples;
+		Samples.SetNumUninitialized(NumSamples);
+
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			const float Time = static_cast<float>(Index) / SampleRate;
+			const float Pitch = 140.f + 40.f * FMath::Sin(2.f * PI * 0.5f * Time);
+
+			float Voice = 0.f;
+			for (int32 Harmonic = 1; Harmonic <= 8; ++Harmonic)
+			{
+				Voice += FMath::Sin(2.f * PI * Pitch * Harmonic * Time) / Harmonic;
+			}
+
+			Samples[Index] = static_cast<int16>(FMath::Clamp(0.2f * Voice, -1.f, 1.f) * 32767.f);
+		}
+
+		TArray<uint8> Output;
+		SerializeWaveFile(Output, reinterpret_cast<const uint8*>(Samples.GetData()), Samples.Num() * sizeof(int16), 1, SampleRate);
+
+		return Output;
+	}
+
+	// Splits the recording like the Synthesizing events of a riff output format: The first chunk also carries the wav header
+	TArray<FAzSpeechAudioBuffer> MakeChunks(const TArray<uint8>& Recording, const int32 ChunkMilliseconds, int32& OutChunkBytes)
+	{
+		TArray<FAzSpeechAudioBuffer> Output;
+
+		FWaveModInfo WaveInfo;
+		if (!WaveInfo.ReadWaveInfo(Recording.GetData(), Recording.Num()))
+		{
+			return Output;
+		}
+
+		const int32 BytesPerFrame = *WaveInfo.pChannels * (*WaveInfo.pBitsPerSample / 8);
+		OutChunkBytes = FMath::Max(1, static_cast<int32>(*WaveInfo.pSamplesPerSec) * ChunkMilliseconds / 1000) * BytesPerFrame;
+
+		const int32 HeaderBytes = static_cast<int32>(WaveInfo.SampleDataStart - Recording.GetData());
+		const int32 EndBytes = HeaderBytes + static_cast<int32>(WaveInfo.SampleDataSize);
+
+		for (int32 Offset = 0; Offset < EndBytes;)
+		{
+			const int32 NumBytes = FMath::Min((Offset == 0 ? HeaderBytes : 0) + OutChunkBytes, EndBytes - Offset);
+			Output.Add(FAzSpeechAudioBuffer::FromArray(TArray<uint8>(Recording.GetData() + Offset, NumBytes)));
+			Offset += NumBytes;
+		}
+
+		return Output;
+	}
+
+	struct FSettings
+	{
+		float FirstByteSeconds = 0.15f;
+		float ChunkIntervalSeconds = 0.f;
+		double FrameSeconds = 0.0;
+		int32 SampleRate = 16000;
+	};
+
+	// Returns the time to first audio in milliseconds: From the synthesis start to the first audio that the mixer can pull
+	double MeasureOnce(const TArray<FAzSpeechAudioBuffer>& Chunks, const FSettings& Settings, const bool bStreaming)
+	{
+		TQueue<FAzSpeechAudioBuffer, EQueueMode::Spsc> ReceivedChunks;
+		std::atomic<bool> bSynthesisFinished = false;
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		// Fake synthesizer: Sends the chunks from a SDK-like thread with the service latency and the synthesis speed
+		TFuture<void> Synthesizer = Async(EAsyncExecution::Thread, [&ReceivedChunks, &bSynthesisFinished, &Chunks, &Settings]
+		{
+			FPlatformProcess::Sleep(Settings.FirstByteSeconds);
+
+			for (const FAzSpeechAudioBuffer& Chunk : Chunks)
+			{
+				ReceivedChunks.Enqueue(Chunk);
+				FPlatformProcess::Sleep(Settings.ChunkIntervalSeconds);
+			}
+
+			bSynthesisFinished = true;
+		});
+
+		TArray<uint8> MixerBuffer;
+		MixerBuffer.SetNumUninitialized(NumMixerSamples * sizeof(int16));
+
+		TArray<FAzSpeechAudioBuffer> BufferedChunks;
+		USoundWaveProcedural* StreamingSoundWave = nullptr;
+
+		double FirstAudioTime = -1.0;
+		double NextFrameTime = StartTime;
+
+		// Game thread: The chunks are dispatched by the runnables and only handled in the next tick
+		while (FirstAudioTime < 0.0)
+		{
+			NextFrameTime += Settings.FrameSeconds;
+			FPlatformProcess::Sleep(FMath::Max(0.f, static_cast<float>(NextFrameTime - FPlatformTime::Seconds())));
+
+			const bool bFinished = bSynthesisFinished;
+
+			FAzSpeechAudioBuffer Chunk;
+			while (ReceivedChunks.Dequeue(Chunk))
+			{
+				if (!bStreaming)
+				{
+					BufferedChunks.Add(MoveTemp(Chunk));
+					continue;
+				}
+
+				if (!StreamingSoundWave)
+				{
+					StreamingSoundWave = UAzSpeechHelper::CreateStreamingSoundWave(Settings.SampleRate);
+				}
+
+				UAzSpeechHelper::QueueStreamingAudioChunk(StreamingSoundWave, Chunk);
+			}
+
+			if (bStreaming)
+			{
+				// Audio render thread: Pulls the queued audio on its next callback
+				if (StreamingSoundWave && StreamingSoundWave->GeneratePCMData(MixerBuffer.GetData(), NumMixerSamples) > 0)
+				{
+					FirstAudioTime = FPlatformTime::Seconds();
+				}
+			}
+			else if (bFinished)
+			{
+				// Same conversion of the default playback after the final result
+				if (UAzSpeechHelper::ConvertAudioBufferToTransientSoundWave(FAzSpeechAudioBuffer::Concatenate(BufferedChunks)))
+				{
+					FirstAudioTime = FPlatformTime::Seconds();
+				}
+			}
+
+			// Every chunk was already queued and the mixer still got nothing: The recording has no audio data
+			if (bFinished && FirstAudioTime < 0.0)
+			{
+				break;
+			}
+		}
+
+		Synthesizer.Wait();
+
+		return FirstAudioTime < 0.0 ? -1.0 : (FirstAudioTime - StartTime) * 1000.0;
+	}
+
+	TArray<double> Measure(const TArray<FAzSpeechAudioBuffer>& Chunks, const FSettings& Settings, const int32 NumIterations, const bool bStreaming)
+	{
+		TArray<double> Times;
+		Times.Reserve(NumIterations);
+
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			if (const double Time = MeasureOnce(Chunks, Settings, bStreaming); Time >= 0.0)
+			{
+				Times.Add(Time);
+			}
+		}
+
+		Times.Sort();
+
+		return Times;
+	}
+
+	double Report(const TCHAR* const Name, const TArray<double>& Times)
+	{
+		if (Times.Num() == 0)
+		{
+			UE_LOG(LogAzSpeechStreamingPlaybackBenchmark, Error, TEXT("%-10s No audio was produced"), Name);
+			return 0.0;
+		}
+
+		const FAzSpeechBenchmarkStats Stats(Times);
+		UE_LOG(LogAzSpeechStreamingPlaybackBenchmark, Display, TEXT("%-10s Time to first audio: %s"), Name, *Stats.ToString(TEXT("ms")));
+
+		return Stats.Mean;
+	}
+}
+
+UAzSpeechStreamingPlaybackBenchmarkCommandlet::UAzSpeechStreamingPlaybackBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAzSpeechStreamingPlaybackBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace AzSpeechStreamingPlaybackBenchmark;
+
+	FString FilePath;
+	int32 NumIterations = 20;
+	int32 ChunkMilliseconds = 50;
+	int32 FirstByteMilliseconds = 150;
+	float RealTimeFactor = 8.f;
+	float FrameRate = 60.f;
+
+	FParse::Value(*Params, TEXT("File="), FilePath);
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+	FParse::Value(*Params, TEXT("ChunkMs="), ChunkMilliseconds);
+	FParse::Value(*Params, TEXT("FirstByteMs="), FirstByteMilliseconds);
+	FParse::Value(*Params, TEXT("RealTimeFactor="), RealTimeFactor);
+	FParse::Value(*Params, TEXT("FrameRate="), FrameRate);
+
+	NumIterations = FMath::Max(NumIterations, 1);
+	ChunkMilliseconds = FMath::Clamp(ChunkMilliseconds, 5, 1000);
+	FirstByteMilliseconds = FMath::Max(FirstByteMilliseconds, 0);
+	RealTimeFactor = FMath::Max(RealTimeFactor, 0.1f);
+
+	TArray<uint8> Recording;
+	if (FilePath.IsEmpty())
+	{
+		Recording = MakeSyntheticRecording(10);
+	}
+	else if (!FFileHelper::LoadFileToArray(Recording, *FilePath))
+	{
+		UE_LOG(LogAzSpeechStreamingPlaybackBenchmark, Error, TEXT("Failed to load the recording: %s"), *FilePath);
+		return 1;
+	}
+
+	FWaveModInfo WaveInfo;
+	if (!WaveInfo.ReadWaveInfo(Recording.GetData(), Recording.Num()) || *WaveInfo.pChannels != 1 || *WaveInfo.pBitsPerSample != 16)
+	{
+		UE_LOG(LogAzSpeechStreamingPlaybackBenchmark, Error, TEXT("The recording must be a 16 bits mono wav file, like the synthesis output"));
+		return 1;
+	}
+
+	int32 ChunkBytes = 0;
+	const TArray<FAzSpeechAudioBuffer> Chunks = MakeChunks(Recording, ChunkMilliseconds, ChunkBytes);
+
+	FSettings Settings;
+	Settings.FirstByteSeconds = FirstByteMilliseconds / 1000.f;
+	Settings.ChunkIntervalSeconds = ChunkMilliseconds / 1000.f / RealTimeFactor;
+	Settings.FrameSeconds = FrameRate > 0.f ? 1.0 / FrameRate : 0.0;
+	Settings.SampleRate = *WaveInfo.pSamplesPerSec;
+
+	const float AudioDuration = static_cast<float>(WaveInfo.SampleDataSize) / (Settings.SampleRate * sizeof(int16));
+
+	UE_LOG(LogAzSpeechStreamingPlaybackBenchmark, Display,
+	       TEXT("Audio: %.2f s at %d Hz; %d chunks of %d bytes; First byte: %d ms; Synthesis speed: %.1fx real time; Frame rate: %.0f; %d runs"),
+	       AudioDuration, Settings.SampleRate, Chunks.Num(), ChunkBytes, FirstByteMilliseconds, RealTimeFactor, FrameRate, NumIterations);
+
+	const double StreamingMean = Report(TEXT("Streaming:"), Measure(Chunks, Settings, NumIterations, true));
+	const double BufferedMean = Report(TEXT("Buffered:"), Measure(Chunks, Settings, NumIterations, false));
+
+	if (StreamingMean > 0.0)
+	{
+		UE_LOG(LogAzSpeechStreamingPlaybackBenchmark, Display, TEXT("Streaming playback starts %.2f ms earlier (%.1fx faster)"),
+		       BufferedMean - StreamingMean, BufferedMean / StreamingMean);
+	}
+
+	return 0;
+}
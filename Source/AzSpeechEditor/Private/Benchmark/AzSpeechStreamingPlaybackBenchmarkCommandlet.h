@@ -0,0 +1,25 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Commandlets/Commandlet.h>
+#include "AzSpeechStreamingPlaybackBenchmarkCommandlet.generated.h"
+
+/**
+ * Measures the time to first audio of the streaming playback against the buffered playback, feeding recorded PCM chunks from a fake synthesizer
+ *
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=AzSpeechStreamingPlaybackBenchmark [-File=Recording.wav] [-Iterations=20] [-ChunkMs=50] [-FirstByteMs=150] [-RealTimeFactor=8] [-FrameRate=60]
+ */
+UCLASS(MinimalAPI, NotBlueprintable, NotPlaceable, Category = "Implementation")
+class UAzSpeechStreamingPlaybackBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	explicit UAzSpeechStreamingPlaybackBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual int32 Main(const FString& Params) override;
+};
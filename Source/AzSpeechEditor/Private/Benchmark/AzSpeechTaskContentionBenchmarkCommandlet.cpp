@@ -0,0 +1,411 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeechTaskContentionBenchmarkCommandlet.h"
+#include "AzSpeechBenchmarkStats.h"
+#include <AzSpeech/Tasks/Synthesis/Bases/AzSpeechSynthesizerTaskBase.h>
+#include <AzSpeech/AzSpeechAudioBuffer.h>
+#include <AzSpeech/AzSpeechVisemeTrack.h>
+#include <Async/Async.h>
+#include <atomic>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechTaskContentionBenchmarkCommandlet)
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogAzSpeechTaskContentionBenchmark, Display, All);
+
+namespace AzSpeechTaskContentionBenchmark
+{
+	// 100 ms of 16 kHz mono audio and 6 frames of 55 blend shapes for each update, like a synthesis with facial expression
+	constexpr int32 ChunkBytes = 3200;
+	constexpr int32 NumFrames = 6;
+	constexpr int32 NumBlendShapes = 55;
+
+	// Only one of this number of polls is timed: The timer would cost more than the lock-free getters
+	constexpr int32 PollSampleInterval = 16;
+
+	FAzSpeechVisemeTrack MakeVisemeBatch(FRandomStream& Random)
+	{
+		FString Animation = TEXT("{\"FrameIndex\":0,\"BlendShapes\":[");
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Animation += Frame == 0 ? TEXT("[") : TEXT(",[");
+			for (int32 BlendShape = 0; BlendShape < NumBlendShapes; ++BlendShape)
+			{
+				Animation += FString::Printf(BlendShape == 0 ? TEXT("%.3f") : TEXT(",%.3f"), Random.FRand());
+			}
+
+			Animation += TEXT("]");
+		}
+
+		Animation += TEXT("]}");
+
+		FAzSpeechVisemeData VisemeData;
+		VisemeData.VisemeID = Random.RandRange(0, 21);
+		VisemeData.AudioOffsetMilliseconds = 0;
+		VisemeData.Animation = Animation;
+
+		FAzSpeechVisemeTrack Output;
+		Output.Add(VisemeData);
+
+		return Output;
+	}
+
+	// Getters polled by the game code and animation nodes: Each one reads the result on its own, like the task getters
+	template <typename TaskType>
+	int64 Poll(const TaskType& Task)
+	{
+		int64 Output = Task.IsLastResultValid() ? 1 : 0;
+		Output += Task.GetAudioDuration();
+		Output += Task.GetFirstByteLatency() + Task.GetNetworkLatency() + Task.GetServiceLatency();
+		Output += Task.GetLastVisemeID() + Task.GetNumAudioChunks();
+
+		return Output;
+	}
+
+	// Previous path: Every update and every getter take the task mutex
+	class FLockedTask
+	{
+	public:
+		void Update(const FAzSpeechAudioBuffer& Chunk, const FAzSpeechVisemeTrack& VisemeBatch)
+		{
+			FScopeLock Lock(&Mutex);
+
+			AudioChunks.Add(Chunk);
+			VisemeTrack.Append(VisemeBatch);
+			AudioDuration += 100;
+			bLastResultIsValid = true;
+		}
+
+		const bool IsLastResultValid() const
+		{
+			FScopeLock Lock(&Mutex);
+			return bLastResultIsValid;
+		}
+
+		const int64 GetAudioDuration() const
+		{
+			FScopeLock Lock(&Mutex);
+			return AudioDuration;
+		}
+
+		const int32 GetFirstByteLatency() const
+		{
+			FScopeLock Lock(&Mutex);
+			return Latency;
+		}
+
+		const int32 GetNetworkLatency() const
+		{
+			FScopeLock Lock(&Mutex);
+			return Latency;
+		}
+
+		const int32 GetServiceLatency() const
+		{
+			FScopeLock Lock(&Mutex);
+			return Latency;
+		}
+
+		const int32 GetLastVisemeID() const
+		{
+			FScopeLock Lock(&Mutex);
+			return VisemeTrack.IsEmpty() ? -1 : VisemeTrack.GetVisemeID(VisemeTrack.Num() - 1);
+		}
+
+		const int32 GetNumAudioChunks() const
+		{
+			FScopeLock Lock(&Mutex);
+			return AudioChunks.Num();
+		}
+
+	private:
+		mutable FCriticalSection Mutex;
+
+		TArray<FAzSpeechAudioBuffer> AudioChunks;
+		FAzSpeechVisemeTrack VisemeTrack;
+		int64 AudioDuration = 0;
+		int32 Latency = 0;
+		bool bLastResultIsValid = false;
+	};
+
+	// Shared by both snapshot paths: The getters only load the current snapshot
+	template <typename SnapshotType>
+	class TSnapshotTask
+	{
+	public:
+		template <typename UpdaterType>
+		void Update(UpdaterType&& Updater)
+		{
+			// Same steps of the task: Copy the current snapshot, apply the changes and publish it with a single pointer swap
+			const std::shared_ptr<SnapshotType> NewSnapshot = std::make_shared<SnapshotType>(*GetSnapshot());
+			Updater(*NewSnapshot);
+
+			std::atomic_store_explicit(&Snapshot, std::shared_ptr<const SnapshotType>(NewSnapshot), std::memory_order_release);
+		}
+
+		const bool IsLastResultValid() const
+		{
+			return GetSnapshot()->bLastResultIsValid;
+		}
+
+		const int64 GetAudioDuration() const
+		{
+			return GetSnapshot()->AudioDuration;
+		}
+
+		const int32 GetFirstByteLatency() const
+		{
+			return GetSnapshot()->FirstByteLatency;
+		}
+
+		const int32 GetNetworkLatency() const
+		{
+			return GetSnapshot()->NetworkLatency;
+		}
+
+		const int32 GetServiceLatency() const
+		{
+			return GetSnapshot()->ServiceLatency;
+		}
+
+	protected:
+		const std::shared_ptr<const SnapshotType> GetSnapshot() const
+		{
+			return std::atomic_load_explicit(&Snapshot, std::memory_order_acquire);
+		}
+
+	private:
+		std::shared_ptr<const SnapshotType> Snapshot = std::make_shared<const SnapshotType>();
+	};
+
+	// Previous snapshot layout: The chunks and the viseme track are copied into each new snapshot
+	struct FCopiedSnapshot
+	{
+		TArray<FAzSpeechAudioBuffer> AudioChunks;
+		FAzSpeechVisemeTrack VisemeTrack;
+		bool bLastResultIsValid = false;
+		int64 AudioDuration = 0;
+		int32 FirstByteLatency = 0;
+		int32 NetworkLatency = 0;
+		int32 ServiceLatency = 0;
+	};
+
+	class FCopiedSnapshotTask final : public TSnapshotTask<FCopiedSnapshot>
+	{
+	public:
+		void Update(const FAzSpeechAudioBuffer& Chunk, const FAzSpeechVisemeTrack& VisemeBatch)
+		{
+			TSnapshotTask::Update([&Chunk, &VisemeBatch](FCopiedSnapshot& Result)
+			{
+				Result.AudioChunks.Add(Chunk);
+				Result.VisemeTrack.Append(VisemeBatch);
+				Result.AudioDuration += 100;
+				Result.bLastResultIsValid = true;
+			});
+		}
+
+		const int32 GetLastVisemeID() const
+		{
+			const std::shared_ptr<const FCopiedSnapshot> Result = GetSnapshot();
+			return Result->VisemeTrack.IsEmpty() ? -1 : Result->VisemeTrack.GetVisemeID(Result->VisemeTrack.Num() - 1);
+		}
+
+		const int32 GetNumAudioChunks() const
+		{
+			return GetSnapshot()->AudioChunks.Num();
+		}
+	};
+
+	// Current path: The snapshot of the synthesis tasks, sharing the chunks and viseme batches of the previous snapshots
+	class FSegmentedSnapshotTask final : public TSnapshotTask<FAzSpeechSynthesisResultSnapshot>
+	{
+	public:
+		void Update(const FAzSpeechAudioBuffer& Chunk, const FAzSpeechVisemeTrack& VisemeBatch)
+		{
+			TSnapshotTask::Update([&Chunk, &VisemeBatch](FAzSpeechSynthesisResultSnapshot& Result)
+			{
+				Result.AudioChunks.Add(Chunk);
+				Result.VisemeBatches.Add(VisemeBatch);
+				Result.AudioDuration += 100;
+				Result.bLastResultIsValid = true;
+			});
+		}
+
+		const int32 GetLastVisemeID() const
+		{
+			const std::shared_ptr<const FAzSpeechSynthesisResultSnapshot> Result = GetSnapshot();
+			if (Result->VisemeBatches.IsEmpty())
+			{
+				return -1;
+			}
+
+			const FAzSpeechVisemeTrack& LastBatch = Result->VisemeBatches.Last();
+			return LastBatch.GetVisemeID(LastBatch.Num() - 1);
+		}
+
+		const int32 GetNumAudioChunks() const
+		{
+			return GetSnapshot()->AudioChunks.Num();
+		}
+	};
+
+	struct FSettings
+	{
+		int32 NumTasks = 32;
+		int32 NumReaders = 8;
+		int32 NumUpdates = 300;
+	};
+
+	struct FReaderResult
+	{
+		TArray<double> PollTimes;
+		int64 NumPolls = 0;
+		int64 Checksum = 0;
+	};
+
+	struct FResult
+	{
+		TArray<double> UpdateTimes;
+		TArray<double> PollTimes;
+		double FirstUpdatesTime = 0.0;
+		double LastUpdatesTime = 0.0;
+		double TotalUpdateTime = 0.0;
+		double PollsPerSecond = 0.0;
+	};
+
+	// The game thread updates every task once per update while the readers poll them in a loop until the synthesis ends
+	template <typename TaskType>
+	FResult Measure(const FSettings& Settings, const FAzSpeechAudioBuffer& Chunk, const FAzSpeechVisemeTrack& VisemeBatch)
+	{
+		TArray<TUniquePtr<TaskType>> Tasks;
+		for (int32 Index = 0; Index < Settings.NumTasks; ++Index)
+		{
+			Tasks.Add(MakeUnique<TaskType>());
+		}
+
+		std::atomic<bool> bFinished = false;
+
+		TArray<TFuture<FReaderResult>> Readers;
+		for (int32 Reader = 0; Reader < Settings.NumReaders; ++Reader)
+		{
+			Readers.Add(Async(EAsyncExecution::Thread, [&Tasks, &bFinished, Reader]
+			{
+				FReaderResult Output;
+
+				for (int32 Index = Reader % Tasks.Num(); !bFinished; Index = (Index + 1) % Tasks.Num())
+				{
+					if (++Output.NumPolls % PollSampleInterval != 0)
+					{
+						Output.Checksum += Poll(*Tasks[Index]);
+						continue;
+					}
+
+					const double StartTime = FPlatformTime::Seconds();
+					Output.Checksum += Poll(*Tasks[Index]);
+					Output.PollTimes.Add((FPlatformTime::Seconds() - StartTime) * 1000000.0);
+				}
+
+				return Output;
+			}));
+		}
+
+		FResult Output;
+		Output.UpdateTimes.Reserve(Settings.NumUpdates * Settings.NumTasks);
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		for (int32 Update = 0; Update < Settings.NumUpdates; ++Update)
+		{
+			for (const TUniquePtr<TaskType>& Task : Tasks)
+			{
+				const double UpdateStartTime = FPlatformTime::Seconds();
+				Task->Update(Chunk, VisemeBatch);
+				Output.UpdateTimes.Add((FPlatformTime::Seconds() - UpdateStartTime) * 1000000.0);
+			}
+		}
+
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+		bFinished = true;
+
+		int64 NumPolls = 0;
+		for (TFuture<FReaderResult>& Reader : Readers)
+		{
+			FReaderResult ReaderResult = Reader.Get();
+			NumPolls += ReaderResult.NumPolls;
+			Output.PollTimes.Append(MoveTemp(ReaderResult.PollTimes));
+		}
+
+		// Mean update time of the first and last 10% of the synthesis: A copy of the whole result grows with the data received so far
+		const int32 NumEdgeUpdates = FMath::Max(1, Output.UpdateTimes.Num() / 10);
+		for (int32 Index = 0; Index < NumEdgeUpdates; ++Index)
+		{
+			Output.FirstUpdatesTime += Output.UpdateTimes[Index] / NumEdgeUpdates;
+			Output.LastUpdatesTime += Output.UpdateTimes[Output.UpdateTimes.Num() - 1 - Index] / NumEdgeUpdates;
+		}
+
+		Output.TotalUpdateTime = ElapsedTime * 1000.0;
+		Output.PollsPerSecond = ElapsedTime > 0.0 ? NumPolls / ElapsedTime : 0.0;
+
+		Output.UpdateTimes.Sort();
+		Output.PollTimes.Sort();
+
+		return Output;
+	}
+
+	void Report(const TCHAR* const Name, const FResult& Result, const double ReferencePollsPerSecond)
+	{
+		UE_LOG(LogAzSpeechTaskContentionBenchmark, Display, TEXT("%-9s Update: %s; First 10%%: %7.2f us; Last 10%%: %7.2f us; Total: %8.2f ms"), Name,
+		       *FAzSpeechBenchmarkStats(Result.UpdateTimes).ToString(TEXT("us")), Result.FirstUpdatesTime, Result.LastUpdatesTime, Result.TotalUpdateTime);
+
+		UE_LOG(LogAzSpeechTaskContentionBenchmark, Display, TEXT("%-9s Poll:   %s; %.2f M polls/s; %.2fx the locked path"), Name,
+		       *FAzSpeechBenchmarkStats(Result.PollTimes).ToString(TEXT("us")),
+		       Result.PollsPerSecond / 1000000.0, ReferencePollsPerSecond > 0.0 ? Result.PollsPerSecond / ReferencePollsPerSecond : 0.0);
+	}
+}
+
+UAzSpeechTaskContentionBenchmarkCommandlet::UAzSpeechTaskContentionBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAzSpeechTaskContentionBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace AzSpeechTaskContentionBenchmark;
+
+	FSettings Settings;
+	FParse::Value(*Params, TEXT("Tasks="), Settings.NumTasks);
+	FParse::Value(*Params, TEXT("Readers="), Settings.NumReaders);
+	FParse::Value(*Params, TEXT("Updates="), Settings.NumUpdates);
+
+	Settings.NumTasks = FMath::Max(Settings.NumTasks, 1);
+	Settings.NumReaders = FMath::Max(Settings.NumReaders, 1);
+	Settings.NumUpdates = FMath::Max(Settings.NumUpdates, 1);
+
+	FRandomStream Random(42);
+
+	TArray<uint8> ChunkData;
+	ChunkData.SetNumZeroed(ChunkBytes);
+
+	const FAzSpeechAudioBuffer Chunk = FAzSpeechAudioBuffer::FromArray(MoveTemp(ChunkData));
+	const FAzSpeechVisemeTrack VisemeBatch = MakeVisemeBatch(Random);
+
+	const FResult LockedResult = Measure<FLockedTask>(Settings, Chunk, VisemeBatch);
+	const FResult CopiedResult = Measure<FCopiedSnapshotTask>(Settings, Chunk, VisemeBatch);
+	const FResult SegmentedResult = Measure<FSegmentedSnapshotTask>(Settings, Chunk, VisemeBatch);
+
+	UE_LOG(LogAzSpeechTaskContentionBenchmark, Display, TEXT("%d tasks; %d reader threads; %d updates of %d bytes and %d frames per task"),
+	       Settings.NumTasks, Settings.NumReaders, Settings.NumUpdates, ChunkBytes, NumFrames);
+
+	Report(TEXT("Locked:"), LockedResult, LockedResult.PollsPerSecond);
+	Report(TEXT("Copied:"), CopiedResult, LockedResult.PollsPerSecond);
+	Report(TEXT("Segments:"), SegmentedResult, LockedResult.PollsPerSecond);
+
+	return 0;
+}
@@ -0,0 +1,26 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Commandlets/Commandlet.h>
+#include "AzSpeechTaskContentionBenchmarkCommandlet.generated.h"
+
+/**
+ * Measures the synthesis result getters polled by many threads while the tasks receive audio chunks and visemes: The previous locked path, the
+ * previous snapshots copied on each update and the current snapshots with shared segments
+ *
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=AzSpeechTaskContentionBenchmark [-Tasks=32] [-Readers=8] [-Updates=300]
+ */
+UCLASS(MinimalAPI, NotBlueprintable, NotPlaceable, Category = "Implementation")
+class UAzSpeechTaskContentionBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	explicit UAzSpeechTaskContentionBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual int32 Main(const FString& Params) override;
+};
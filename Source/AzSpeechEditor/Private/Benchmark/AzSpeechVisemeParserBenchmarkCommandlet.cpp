@@ -0,0 +1,284 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeechVisemeParserBenchmarkCommandlet.h"
+#include "AzSpeechBenchmarkStats.h"
+#include <AzSpeech/AzSpeechVisemeParser.h>
+#include <AzSpeech/Structures/AzSpeechAnimationData.h>
+#include <Dom/JsonObject.h>
+#include <Serialization/JsonReader.h>
+#include <Serialization/JsonSerializer.h>
+#include <Misc/FileHelper.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechVisemeParserBenchmarkCommandlet)
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogAzSpeechVisemeParserBenchmark, Display, All);
+
+namespace AzSpeechVisemeParserBenchmark
+{
+	// Same layout of the service: 55 blend shapes per frame at 60 frames per second, sent in groups of a few frames
+	constexpr int32 NumBlendShapes = 55;
+	constexpr int32 MinFramesPerViseme = 1;
+	constexpr int32 MaxFramesPerViseme = 12;
+
+	// Synthetic animation like the recorded ones: Most weights have 3 decimals, silent curves are sent as 0 or 0.0
+	FString MakeAnimation(const int32 FrameIndex, const int32 NumFrames, FRandomStream& Random)
+	{
+		FString Output = FString::Printf(TEXT("{\"FrameIndex\":%d,\"BlendShapes\":["), FrameIndex);
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Output += Frame == 0 ? TEXT("[") : TEXT(",[");
+
+			for (int32 BlendShape = 0; BlendShape < NumBlendShapes; ++BlendShape)
+			{
+				if (BlendShape > 0)
+				{
+					Output += TEXT(",");
+				}
+
+				const float Selector = Random.FRand();
+				if (Selector < 0.15f)
+				{
+					Output += TEXT("0");
+				}
+				else if (Selector < 0.25f)
+				{
+					Output += TEXT("0.0");
+				}
+				else if (Selector < 0.9f)
+				{
+					Output += FString::Printf(TEXT("%.3f"), Random.FRand());
+				}
+				else
+				{
+					Output += FString::Printf(TEXT("%.6f"), Random.FRand());
+				}
+			}
+
+			Output += TEXT("]");
+		}
+
+		Output += TEXT("]}");
+
+		return Output;
+	}
+
+	// Previous path of ExtractAnimationDataFromVisemeData: A Json object with a value per weight
+	const bool ParseJson(const FString& Animation, TArray<float>& OutBlendShapes)
+	{
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Animation);
+		TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+
+		if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+		{
+			return false;
+		}
+
+		FAzSpeechAnimationData Output;
+		Output.FrameIndex = JsonObject->GetIntegerField(TEXT("FrameIndex"));
+
+		for (const TSharedPtr<FJsonValue>& IteratorArray : JsonObject->GetArrayField(TEXT("BlendShapes")))
+		{
+			FAzSpeechBlendShapes CurrentBlendShapes;
+			for (const TSharedPtr<FJsonValue>& IteratorValue : IteratorArray->AsArray())
+			{
+				CurrentBlendShapes.Data.Add(static_cast<float>(IteratorValue->AsNumber()));
+			}
+
+			Output.BlendShapes.Add(CurrentBlendShapes);
+		}
+
+		// The parser writes the weights to a flat buffer: Same copy of ExtractAnimationDataFromVisemeData, in the opposite direction
+		OutBlendShapes.Reset();
+		for (const FAzSpeechBlendShapes& Iterator : Output.BlendShapes)
+		{
+			OutBlendShapes.Append(Iterator.Data);
+		}
+
+		return true;
+	}
+
+	struct FResult
+	{
+		TArray<double> VisemeTimes;
+		TArray<TArray<float>> BlendShapes;
+		double BestTotalTime = TNumericLimits<double>::Max();
+		int32 NumFailures = 0;
+	};
+
+	template <typename FunctionType>
+	FResult Measure(const int32 NumAnimations, const int32 NumIterations, FunctionType&& Function)
+	{
+		FResult Output;
+		Output.VisemeTimes.Reserve(NumAnimations * NumIterations);
+		Output.BlendShapes.SetNum(NumAnimations);
+
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			double TotalTime = 0.0;
+			for (int32 Index = 0; Index < NumAnimations; ++Index)
+			{
+				TArray<float>& BlendShapes = Output.BlendShapes[Index];
+				BlendShapes.Reset();
+
+				const double StartTime = FPlatformTime::Seconds();
+				const bool bSuccess = Function(Index, BlendShapes);
+				const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+				Output.NumFailures += bSuccess || Iteration > 0 ? 0 : 1;
+				Output.VisemeTimes.Add(ElapsedTime * 1000000.0);
+				TotalTime += ElapsedTime;
+			}
+
+			Output.BestTotalTime = FMath::Min(Output.BestTotalTime, TotalTime);
+		}
+
+		Output.VisemeTimes.Sort();
+
+		return Output;
+	}
+
+	// The parsers must produce the same weights of the Json path
+	const int32 CountMismatches(const FResult& Reference, const FResult& Result)
+	{
+		int32 Output = 0;
+		for (int32 Index = 0; Index < Reference.BlendShapes.Num(); ++Index)
+		{
+			const TArray<float>& Expected = Reference.BlendShapes[Index];
+			const TArray<float>& Actual = Result.BlendShapes[Index];
+
+			if (Expected.Num() != Actual.Num())
+			{
+				++Output;
+				continue;
+			}
+
+			for (int32 Value = 0; Value < Expected.Num(); ++Value)
+			{
+				if (!FMath::IsNearlyEqual(Expected[Value], Actual[Value], 1.e-6f))
+				{
+					++Output;
+					break;
+				}
+			}
+		}
+
+		return Output;
+	}
+
+	void Report(const TCHAR* const Name, const FResult& Result, const int64 NumBytes, const double ReferenceTime, const int32 NumMismatches)
+	{
+		UE_LOG(LogAzSpeechVisemeParserBenchmark, Display, TEXT("%-8s Per viseme: %s; Total: %8.2f ms; %7.1f MB/s; %.2fx the Json path"), Name,
+		       *FAzSpeechBenchmarkStats(Result.VisemeTimes).ToString(TEXT("us")), Result.BestTotalTime * 1000.0,
+		       Result.BestTotalTime > 0.0 ? NumBytes / Result.BestTotalTime / (1024.0 * 1024.0) : 0.0,
+		       Result.BestTotalTime > 0.0 ? ReferenceTime / Result.BestTotalTime : 0.0);
+
+		if (Result.NumFailures > 0 || NumMismatches > 0)
+		{
+			UE_LOG(LogAzSpeechVisemeParserBenchmark, Error, TEXT("%-8s %d animations failed; %d animations differ from the Json path"), Name,
+			       Result.NumFailures, NumMismatches);
+		}
+	}
+}
+
+UAzSpeechVisemeParserBenchmarkCommandlet::UAzSpeechVisemeParserBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAzSpeechVisemeParserBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace AzSpeechVisemeParserBenchmark;
+
+	FString FilePath;
+	int32 NumVisemes = 2000;
+	int32 NumIterations = 5;
+
+	FParse::Value(*Params, TEXT("File="), FilePath);
+	FParse::Value(*Params, TEXT("Visemes="), NumVisemes);
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+
+	NumVisemes = FMath::Max(NumVisemes, 1);
+	NumIterations = FMath::Max(NumIterations, 1);
+
+	TArray<FString> Animations;
+	if (FilePath.IsEmpty())
+	{
+		FRandomStream Random(42);
+
+		int32 FrameIndex = 0;
+		for (int32 Index = 0; Index < NumVisemes; ++Index)
+		{
+			const int32 NumFrames = Random.RandRange(MinFramesPerViseme, MaxFramesPerViseme);
+			Animations.Add(MakeAnimation(FrameIndex, NumFrames, Random));
+			FrameIndex += NumFrames;
+		}
+	}
+	else if (!FFileHelper::LoadFileToStringArray(Animations, *FilePath))
+	{
+		UE_LOG(LogAzSpeechVisemeParserBenchmark, Error, TEXT("Failed to load the animations: %s"), *FilePath);
+		return 1;
+	}
+
+	Animations.RemoveAll([](const FString& Animation)
+	{
+		return Animation.TrimStartAndEnd().IsEmpty();
+	});
+
+	if (Animations.Num() == 0)
+	{
+		UE_LOG(LogAzSpeechVisemeParserBenchmark, Error, TEXT("No animation to parse"));
+		return 1;
+	}
+
+	// The SDK sends the animations as UTF-8 strings: The synthesis runnable parses them without converting to TCHAR
+	TArray<TArray<ANSICHAR>> UTF8Animations;
+	UTF8Animations.Reserve(Animations.Num());
+
+	int64 NumBytes = 0;
+	for (const FString& Animation : Animations)
+	{
+		const FTCHARToUTF8 Converter(*Animation);
+		UTF8Animations.Emplace(Converter.Get(), Converter.Length());
+		NumBytes += Converter.Length();
+	}
+
+	const FResult JsonResult = Measure(Animations.Num(), NumIterations, [&Animations](const int32 Index, TArray<float>& OutBlendShapes)
+	{
+		return ParseJson(Animations[Index], OutBlendShapes);
+	});
+
+	const FResult ScalarResult = Measure(Animations.Num(), NumIterations, [&Animations](const int32 Index, TArray<float>& OutBlendShapes)
+	{
+		FAzSpeechVisemeAnimationInfo AnimationInfo;
+		int32 Stride = 0;
+
+		return FAzSpeechVisemeParser::ParseAnimation(*Animations[Index], Animations[Index].Len(), AnimationInfo, Stride, OutBlendShapes);
+	});
+
+	const FResult UTF8Result = Measure(Animations.Num(), NumIterations, [&UTF8Animations](const int32 Index, TArray<float>& OutBlendShapes)
+	{
+		FAzSpeechVisemeAnimationInfo AnimationInfo;
+		int32 Stride = 0;
+
+		return FAzSpeechVisemeParser::ParseAnimation(UTF8Animations[Index].GetData(), UTF8Animations[Index].Num(), AnimationInfo, Stride,
+		                                             OutBlendShapes);
+	});
+
+	UE_LOG(LogAzSpeechVisemeParserBenchmark, Display, TEXT("%d animations; %.1f KB; %s; Best total of %d runs"), Animations.Num(), NumBytes / 1024.0,
+	       FilePath.IsEmpty() ? TEXT("Synthetic") : *FilePath, NumIterations);
+
+	Report(TEXT("Json:"), JsonResult, NumBytes, JsonResult.BestTotalTime, 0);
+	Report(TEXT("Scalar:"), ScalarResult, NumBytes, JsonResult.BestTotalTime, CountMismatches(JsonResult, ScalarResult));
+	Report(TEXT("UTF-8:"), UTF8Result, NumBytes, JsonResult.BestTotalTime, CountMismatches(JsonResult, UTF8Result));
+
+	return 0;
+}
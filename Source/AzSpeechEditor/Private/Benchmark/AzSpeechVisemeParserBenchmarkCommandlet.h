@@ -0,0 +1,28 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Commandlets/Commandlet.h>
+#include "AzSpeechVisemeParserBenchmarkCommandlet.generated.h"
+
+/**
+ * Measures the parsing of the facial expression animations sent with the visemes: The previous Json path against the viseme parser, with the
+ * scalar path of TCHAR strings and the vectorized path of the UTF-8 strings received from the SDK
+ *
+ * File: Recorded animations, one per line. Synthetic animations with the same layout are used if no file is given
+ *
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=AzSpeechVisemeParserBenchmark [-File=Animations.txt] [-Visemes=2000] [-Iterations=5]
+ */
+UCLASS(MinimalAPI, NotBlueprintable, NotPlaceable, Category = "Implementation")
+class UAzSpeechVisemeParserBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	explicit UAzSpeechVisemeParserBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual int32 Main(const FString& Params) override;
+};
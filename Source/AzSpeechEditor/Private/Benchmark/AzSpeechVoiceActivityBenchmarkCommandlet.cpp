@@ -0,0 +1,129 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#include "AzSpeechVoiceActivityBenchmarkCommandlet.h"
+#include <AzSpeech/AzSpeechVoiceActivityDetector.h>
+#include <Audio.h>
+#include <Misc/FileHelper.h>
+
+#ifdef UE_INLINE_GENERATED_CPP_BY_NAME
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AzSpeechVoiceActivityBenchmarkCommandlet)
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogAzSpeechVoiceActivityBenchmark, Display, All);
+
+UAzSpeechVoiceActivityBenchmarkCommandlet::UAzSpeechVoiceActivityBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAzSpeechVoiceActivityBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString FilePath;
+	float Threshold = -45.f;
+	int32 Hangover = 1000;
+	int32 NumIterations = 10;
+
+	FParse::Value(*Params, TEXT("File="), FilePath);
+	FParse::Value(*Params, TEXT("Threshold="), Threshold);
+	FParse::Value(*Params, TEXT("Hangover="), Hangover);
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+
+	NumIterations = FMath::Max(1, NumIterations);
+
+	TArray<uint8> FileData;
+	if (FilePath.IsEmpty() || !FFileHelper::LoadFileToArray(FileData, *FilePath))
+	{
+		UE_LOG(LogAzSpeechVoiceActivityBenchmark, Error, TEXT("Failed to load '%s': Set a recorded wav file with -File="), *FilePath);
+		return 1;
+	}
+
+	FWaveModInfo WaveInfo;
+	if (!WaveInfo.ReadWaveInfo(FileData.GetData(), FileData.Num()) || *WaveInfo.pBitsPerSample != 16)
+	{
+		UE_LOG(LogAzSpeechVoiceActivityBenchmark, Error, TEXT("'%s' isn't a 16 bits PCM wav file"), *FilePath);
+		return 1;
+	}
+
+	const int32 NumChannels = FMath::Max<int32>(1, *WaveInfo.pChannels);
+	const int32 SampleRate = static_cast<int32>(*WaveInfo.pSamplesPerSec);
+	const int32 NumFrames = static_cast<int32>(WaveInfo.SampleDataSize / (sizeof(int16) * NumChannels));
+	const int16* const PCMData = reinterpret_cast<const int16*>(WaveInfo.SampleDataStart);
+
+	TArray<float> MonoData;
+	MonoData.SetNumUninitialized(NumFrames);
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		float Sum = 0.f;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			Sum += PCMData[Frame * NumChannels + Channel] / 32768.f;
+		}
+
+		MonoData[Frame] = Sum / NumChannels;
+	}
+
+	FAzSpeechVoiceActivitySettings Settings;
+	Settings.SampleRate = SampleRate;
+	Settings.EnergyThresholdDb = Threshold;
+	Settings.HangoverMs = Hangover;
+
+	// Same chunk size of the microphone capture callbacks: About 10 ms
+	const int32 ChunkSize = FMath::Max(SampleRate / 100, 1);
+
+	int64 NumForwardedSamples = 0;
+	int64 NumProcessedFrames = 0;
+	int64 NumForwardedFrames = 0;
+	int32 NumSegments = 0;
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		FAzSpeechVoiceActivityDetector Detector(Settings);
+
+		NumForwardedSamples = 0;
+		NumSegments = 0;
+		bool bWasActive = false;
+
+		for (int32 Index = 0; Index < NumFrames; Index += ChunkSize)
+		{
+			Detector.Process(MakeArrayView(MonoData.GetData() + Index, FMath::Min(ChunkSize, NumFrames - Index)),
+			                 [&NumForwardedSamples](const TArrayView<const float> Samples)
+			                 {
+				                 NumForwardedSamples += Samples.Num();
+			                 });
+
+			NumSegments += Detector.IsVoiceActive() && !bWasActive ? 1 : 0;
+			bWasActive = Detector.IsVoiceActive();
+		}
+
+		NumProcessedFrames = Detector.GetNumProcessedFrames();
+		NumForwardedFrames = Detector.GetNumForwardedFrames();
+	}
+	const double ElapsedTime = (FPlatformTime::Seconds() - StartTime) / NumIterations;
+
+	const double AudioDuration = static_cast<double>(NumFrames) / SampleRate;
+	const double ForwardedRatio = NumFrames > 0 ? static_cast<double>(NumForwardedSamples) / NumFrames : 0.0;
+
+	// Bandwidth of the stream sent to Azure: 16 kHz 16 bits mono
+	constexpr double StreamBytesPerSecond = 16000.0 * sizeof(int16);
+
+	UE_LOG(LogAzSpeechVoiceActivityBenchmark, Display, TEXT("File: %s; Duration: %.2f s; Sample rate: %d Hz; Channels: %d"), *FilePath, AudioDuration,
+	       SampleRate, NumChannels);
+	UE_LOG(LogAzSpeechVoiceActivityBenchmark, Display, TEXT("Threshold: %.1f dBFS; Hangover: %d ms; Voice segments: %d"), Threshold, Hangover,
+	       NumSegments);
+	UE_LOG(LogAzSpeechVoiceActivityBenchmark, Display, TEXT("Forwarded frames: %lld of %lld; Sent audio: %.2f s of %.2f s (%.1f%%)"), NumForwardedFrames,
+	       NumProcessedFrames, AudioDuration * ForwardedRatio, AudioDuration, ForwardedRatio * 100.0);
+	UE_LOG(LogAzSpeechVoiceActivityBenchmark, Display, TEXT("Upstream data: %.1f KB instead of %.1f KB"),
+	       AudioDuration * ForwardedRatio * StreamBytesPerSecond / 1024.0, AudioDuration * StreamBytesPerSecond / 1024.0);
+	UE_LOG(LogAzSpeechVoiceActivityBenchmark, Display, TEXT("Detection time: %.3f ms per run; %.0fx real time"), ElapsedTime * 1000.0,
+	       ElapsedTime > 0.0 ? AudioDuration / ElapsedTime : 0.0);
+
+	return 0;
+}
@@ -0,0 +1,25 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Commandlets/Commandlet.h>
+#include "AzSpeechVoiceActivityBenchmarkCommandlet.generated.h"
+
+/**
+ * Runs the voice activity detector on a recorded 16 bits PCM wav file and reports the audio that would be sent to Azure
+ *
+ * Usage: UnrealEditor-Cmd.exe Project.uproject -run=AzSpeechVoiceActivityBenchmark -File=Recording.wav [-Threshold=-45] [-Hangover=1000] [-Iterations=10]
+ */
+UCLASS(MinimalAPI, NotBlueprintable, NotPlaceable, Category = "Implementation")
+class UAzSpeechVoiceActivityBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	explicit UAzSpeechVoiceActivityBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,39 @@
+// Author: Lucas Vilas-Boas
+// Year: 2023
+// Repo: https://github.com/lucoiso/UEAzSpeech
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Engine/DataTable.h>
+#include "AzSpeechBatchSynthesisRow.generated.h"
+
+/**
+ * Row of the tables used by the AzSpeechBatchSynthesis commandlet to pre-bake dialogue lines
+ */
+USTRUCT(BlueprintType, Category = "AzSpeech")
+struct AZSPEECHEDITOR_API FAzSpeechBatchSynthesisRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	FAzSpeechBatchSynthesisRow() = default;
+
+	/* Text or SSML content to synthesize */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AzSpeech", Meta = (MultiLine = "true"))
+	FString SynthesisText;
+
+	/* Voice used by text based lines: Leave it empty to use the default voice */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AzSpeech")
+	FString Voice;
+
+	/* Locale used by text based lines: Leave it empty to use the default locale */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AzSpeech")
+	FString Locale;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AzSpeech", Meta = (DisplayName = "Is SSML Based"))
+	bool bIsSSMLBased = false;
+
+	/* Name of the generated Sound Wave: Leave it empty to use the row name */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AzSpeech")
+	FString AssetName;
+};